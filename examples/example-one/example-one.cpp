@@ -17,58 +17,52 @@ static uint1 code[] = { 0xff, 0xff, 0xff, 0x58, 0x5a, 0xc9, 0xc3 };
 
 int main(int argc, char *argv[])
 {
-    size_t fsize;
-    uint1* fbytes = nullptr;
-
-    if (argc == 2) {
-        fsize = filesystem::file_size (argv[1]);
-        fbytes = new uint1[fsize];
-        ifstream file (argv[1], ios::in | ios::binary);
-        file.read ((char*)fbytes, fsize);
-    }
-
     Hutch hutch_h;
     Hutch_Instructions insn;
 
     hutch_h.preconfigure (IA32);
 
-    auto img = (argc == 2) ? fbytes : code;
-    auto imgsize = (argc == 2) ? fsize : sizeof (code);
-
     // Need to translate the buffer into internal representation prior to use.
-    // Loaded image is persistent.
-    hutch_h.initialize (img, imgsize, 0x00000000);
-
-    vector<vector<Instruction>> gadget;
-
-    for (auto [retpos, buf] = pair{ 0, img }; retpos = bytePosition("\xc3", buf, imgsize); buf = nullptr ) {
-
-        // Find instructions that could be prepend the ret insn to begin forming
-        // a ROP gadget.
-        vector<Instruction> pinsn = hutch_h.inspectPreviousInstruction (
-            retpos, 15, insn, [](PcodeData pcode) -> bool {
-                return ((pcode.opc == CPUI_STORE) || (pcode.opc == CPUI_LOAD) ||
-                        (pcode.opc == CPUI_COPY));
-            });
-
-        if (pinsn.empty())
-            continue;
-        // Will reverse this later to put in proper order. Just under time
-        // crunch atm.
-        gadget.push_back(pinsn);
-    }
-
-    for (auto candidates : gadget) {
-        for (auto i : candidates) {
-            cout << "@0x" << hex << i.address << endl;
-            hutch_h.printInstructionBytes (i);
-            cout << i.assembly << endl;
+    // Loaded image is persistent. A file is mapped rather than read in.
+    if (argc == 2)
+        hutch_h.initialize (string (argv[1]), 0x00000000);
+    else
+        hutch_h.initialize (code, sizeof (code), 0x00000000);
+
+    auto img = hutch_h.getBuffer ();
+    auto imgsize = hutch_h.getBufferSize ();
+
+    // Every near/far RET, with or without an immediate.
+    ByteScanner rets;
+    rets.addByteSet ({ 0xc3, 0xc2, 0xcb, 0xca }, 0);
+    rets.compile ();
+    vector<ByteMatch> retlist;
+    rets.scan (img, imgsize, retlist);
+
+    vector<uintb> ends;
+    for (auto [retpos, id] : retlist)
+        ends.push_back (retpos);
+
+    // Chains of up to three instructions before each ret, where every
+    // instruction moves data around. Overlapping windows share their decoding.
+    vector<GadgetView> gadget = hutch_h.gadgets (
+        ends, 15, 3, insn, [](PcodeData pcode) -> bool {
+            return ((pcode.opc == CPUI_STORE) || (pcode.opc == CPUI_LOAD) ||
+                    (pcode.opc == CPUI_COPY));
+        });
+
+    for (auto& chain : gadget) {
+        for (auto i = 0; i != chain.size (); ++i) {
+            Instruction& instr = chain[i];
+            cout << "@0x" << hex << instr.address << endl;
+            hutch_h.printInstructionBytes (instr);
+            cout << instr.assembly << endl;
             cout << "insn semantics" << endl;
-            for (auto p : i.pcode) {
+            for (auto p : instr.pcode) {
                 printPcode (p);
             }
-            cout << endl;
         }
+        cout << endl;
     }
 
     // // Analyze each potiential instruction to determine whether suitable for ROP
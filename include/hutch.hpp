@@ -21,10 +21,15 @@
 #include "sleigh.hh"
 
 #include <vector>
+#include <deque>
+#include <algorithm>
+#include <map>
 #include <cstring>
 #include <optional>
 #include <any>
 #include <memory>
+#include <thread>
+#include <exception>
 
 // Forward Declaration(s)
 class Hutch_Emit;
@@ -43,12 +48,75 @@ const uint1 OPT_OUT_DISP_ADDR = 0, OPT_OUT_PCODE = 0, OPT_OUT_ASM = 0;
 //
 void printVarnodeData (ostream& s, VarnodeData* data);
 void printPcode (PcodeData pcode);
+// Deprecated: keeps its place between calls, use a ByteScanner instead.
+[[deprecated ("use ByteScanner")]]
 uintmax_t bytePosition (string byte, uint1* buf, size_t sz);
 
+/*****************************************************************************/
+// * ByteScanner
+//     Finds every occurrence of a group of byte patterns in a raw image in one
+//     pass. Patterns are single bytes, byte sets (e.g. the RET opcodes
+//     c3/c2/cb/ca), and byte strings with an optional per-byte mask. Byte sets
+//     of up to eight bytes, and a handful of strings, are found with SSE2 or
+//     AVX2 compares; larger groups of strings go through an Aho-Corasick
+//     automaton. A masked string is located by its longest unmasked run and
+//     then checked in full.
+//
+//     Add patterns, then compile(). scan() does not modify the scanner, so
+//     one compiled scanner can be shared by any number of threads.
+struct ByteMatch {
+    uintb offset;   // Offset of the first byte of the match
+    int4 id;        // Id the pattern was added with
+};
+
+class ByteScanner {
+public:
+    enum {
+        MAX_SET_BYTES   = 8,    // Largest byte set union searched with SIMD
+        DIRECT_PATTERNS = 4     // Most strings searched for one at a time
+    };
+
+private:
+    struct Pattern {
+        vector<uint1> bytes;
+        vector<uint1> mask;
+        int4 id;
+        int4 anchor = 0;        // Start of the longest unmasked run
+        int4 anchorlen = 0;     // Length of that run
+        bool matches (const uint1* p) const;
+    };
+    vector<Pattern> patterns;
+    vector<vector<int4>> byteids;   // Ids of the byte sets holding each byte
+    vector<uint1> setbytes;         // Every byte of every byte set
+    vector<int4> delta;             // Automaton transitions, 256 per state
+    vector<vector<int4>> output;    // Patterns whose anchor ends at a state
+    bool compiled = false;
+
+    void scanSets (const uint1* buf, size_t size, vector<ByteMatch>& res) const;
+    void scanDirect (const uint1* buf, size_t size, vector<ByteMatch>& res) const;
+    void scanAutomaton (const uint1* buf, size_t size,
+                        vector<ByteMatch>& res) const;
+
+public:
+    ByteScanner ();
+    void addByte (uint1 byte, int4 id);
+    void addByteSet (const vector<uint1>& set, int4 id);
+    void addPattern (const vector<uint1>& bytes, int4 id);
+    void addPattern (const vector<uint1>& bytes, const vector<uint1>& mask,
+                     int4 id);
+    // Hex bytes separated by spaces, "??" for any byte. ex. "48 8b ?? 24"
+    void addSignature (const string& sig, int4 id);
+    void compile ();
+    // Append every match in buf to res, ordered by offset then id. Returns the
+    // number of matches found.
+    size_t scan (const uint1* buf, size_t size, vector<ByteMatch>& res) const;
+};
+
 /*****************************************************************************/
 // * DefaultLoadImage
 //
 class DefaultLoadImage : public LoadImage {
+protected:
     uintb baseaddr = 0;
     uint1 const* buf = nullptr;
     uintb bufsize = 0;
@@ -59,12 +127,30 @@ public:
     }
     inline uintb getBufferSize () { return bufsize; }
     inline uintb getBaseAddr () { return baseaddr; }
+    inline uint1 const* getBuffer () { return buf; }
 
     virtual void loadFill (uint1* ptr, int4 size, const Address& addr) override;
+    // The buffer outlives the image, so Sleigh can read straight from it.
+    virtual const uint1* getDirect (const Address& addr,
+                                    int4 size) const override;
     virtual string getArchType (void) const override { return "Default"; };
     virtual void adjustVma (long adjust) override; // TODO
 };
 
+/*****************************************************************************/
+// * MappedLoadImage
+//     A DefaultLoadImage whose buffer is a read-only mmap of a whole file, so
+//     an image is paged in as it is decoded instead of read up front.
+class MappedLoadImage : public DefaultLoadImage {
+public:
+    MappedLoadImage (const string& path, uintb baseaddr);
+    ~MappedLoadImage ();
+    MappedLoadImage (const MappedLoadImage&) = delete;
+    MappedLoadImage& operator= (const MappedLoadImage&) = delete;
+
+    virtual string getArchType (void) const override { return "Mapped"; };
+};
+
 /*****************************************************************************/
 // THE FOLLOWING HACK ENABLES MULTIPLE INHERITANCE THROUGH AssemblyEmit + PcodeEmit.
 
@@ -109,7 +195,6 @@ public:
 struct Instruction;
 class Hutch_Emit : public Hutch_PcodeEmit, public Hutch_AssemblyEmit {
     friend class Hutch;
-    virtual void removeBadInstruction () = 0;
 
 public:
     virtual void dumpPcode (Address const& addr, OpCode opc, VarnodeData* outvar,
@@ -117,6 +202,12 @@ public:
     virtual void dumpAsm (const Address& addr, const string& mnem,
                           const string& body) override;
 
+    // Gets called once per instruction by Hutch::disassemble_iter() with
+    // everything Sleigh::decodeInstruction() produced. By default this is
+    // split back up into dumpAsm() + dumpPcode() calls.
+    virtual void dumpInstruction (const Address& addr,
+                                  const InstructionRecord& rec);
+
 };
 
 // * Usage w/ trans.oneInstruction() + trans.printAssembly():
@@ -132,6 +223,98 @@ public:
 //     trans.printAssembly (emit, some addr);
 /*****************************************************************************/
 
+/*****************************************************************************/
+// * ArenaSlab
+//     Hands out arrays of T from large blocks. Blocks are never reallocated, so
+//     pointers stay valid until release() frees everything at once.
+template <typename T>
+class ArenaSlab {
+    enum {
+        BLOCK_SIZE = 4096       // Elements per block
+    };
+    vector<unique_ptr<T[]>> blocks;
+    T* cur = nullptr;
+    T* last = nullptr;
+
+public:
+    T* allocate (uint4 n)
+    {
+        if ((uint4)(last - cur) < n) {
+            // Leave room for a large allocation to extend() in place.
+            uint4 sz = (2 * n > BLOCK_SIZE) ? 2 * n : BLOCK_SIZE;
+            blocks.push_back (make_unique<T[]> (sz));
+            cur = blocks.back ().get ();
+            last = cur + sz;
+        }
+        T* res = cur;
+        cur += n;
+        return res;
+    }
+    // Grow the most recent allocation (ending at "tail") by n elements if it
+    // still fits in the current block.
+    bool extend (const T* tail, uint4 n)
+    {
+        if ((tail != cur) || ((uint4)(last - cur) < n))
+            return false;
+        cur += n;
+        return true;
+    }
+    void release ()
+    {
+        blocks.clear ();
+        cur = last = nullptr;
+    }
+    // Take over the blocks of "other". Pointers into them stay valid.
+    void absorb (ArenaSlab& other)
+    {
+        for (auto& b : other.blocks)
+            blocks.push_back (move (b));
+        other.release ();
+    }
+};
+
+/*****************************************************************************/
+// * PcodeSpan
+//     The pcode of one Instruction, a view into a PcodeArena.
+struct PcodeSpan {
+    PcodeData* ops = nullptr;
+    uint4 count = 0;
+
+    PcodeData* begin () const { return ops; }
+    PcodeData* end () const { return ops + count; }
+    uint4 size () const { return count; }
+    bool empty () const { return count == 0; }
+    PcodeData& operator[] (uint4 i) const { return ops[i]; }
+};
+
+/*****************************************************************************/
+// * PcodeArena
+//     Owns the pcode (ops + varnodes) of a whole listing. Storing an op costs
+//     no individual heap allocation and everything is freed in bulk.
+class PcodeArena {
+    ArenaSlab<PcodeData> ops;
+    ArenaSlab<VarnodeData> varnodes;
+
+    // Deep copy of "op" into the varnode slab.
+    void copyOp (PcodeData& dst, const PcodeData& op);
+
+public:
+    // Copy a whole instruction worth of pcode.
+    PcodeSpan store (const vector<PcodeData>& pcode);
+    // Add a single op to the end of "span", moving the span if needed.
+    void append (PcodeSpan& span, const PcodeData& op);
+    void release ()
+    {
+        ops.release ();
+        varnodes.release ();
+    }
+    void absorb (PcodeArena& other)
+    {
+        ops.absorb (other.ops);
+        varnodes.absorb (other.varnodes);
+    }
+};
+
 struct Instruction {
     // Really 15 but include room for byte '\0' for easy printing.
     enum {
@@ -141,38 +324,199 @@ struct Instruction {
     uintb address;
     size_t bytelength = 0;
     string assembly = "";
-    vector<PcodeData> pcode;
-
-    // - Aggregate initialization ensures "raw" is initialized with all
-    //   zeros.
-    // - Sleigh::getInstructionBytes() const forces this to be mutable, but
-    //   not sure whether I like it. Might instead remove const from
-    //   Sleigh::getInstructionBytes()
-    mutable uint1 raw[MAX_INSN_LEN] = {};
-
-    Instruction () = default;
-    Instruction (const Instruction& other) :
-        address (other.address), bytelength (other.bytelength),
-        assembly (other.assembly)
+    // Points into the PcodeArena of the owning Hutch_Instructions, copies of
+    // an Instruction are only usable while that listing is alive.
+    PcodeSpan pcode;
+
+    // Aggregate initialization ensures "raw" is initialized with all zeros.
+    uint1 raw[MAX_INSN_LEN] = {};
+
+    uint1* rawBytes ()
     {
-        for (auto i : other.pcode)
-            pcode.push_back (PcodeData (i));
-        for (auto i = 0; i < MAX_INSN_LEN; ++i)
-            raw[i] = other.raw[i];
+        return raw;
     }
 
-    ~Instruction (void)
-    {
-        for (auto p : pcode) {
-            p.release ();
+};
+
+/* InstructionStore
+ *   Instructions keyed by address. Instructions live in a deque so they never
+ *   move once stored, which makes a Handle (the slot in that deque) valid for
+ *   the lifetime of the store. Address order is kept by a separate index, a
+ *   sorted array of (address, handle) cut into chunks of at most CHUNK
+ *   entries: appending past the highest address (a linear sweep) is O(1), a
+ *   lookup is O(log n) and any other insert moves at most one chunk. An
+ *   insert invalidates iterators, but never a Handle.
+ */
+class InstructionStore {
+public:
+    typedef uint4 Handle;
+    static constexpr Handle invalid = ~(Handle)0;
+
+private:
+    enum {
+        CHUNK = 512             // Most index entries in one chunk
+    };
+    struct Entry {
+        uintb address;
+        Handle handle;
+    };
+    typedef vector<Entry> Chunk;
+    deque<Instruction> storage;
+    // Never holds an empty chunk.
+    vector<Chunk> index;
+
+    // Finds "address" in the index. Either way, "chunk" and "pos" are left
+    // where its entry is or would go.
+    bool search (uintb address, uint4& chunk, uint4& pos) const;
+
+public:
+    // Walks the instructions in address order.
+    class iterator {
+        friend class InstructionStore;
+        InstructionStore* store = nullptr;
+        uint4 chunk = 0;
+        uint4 pos = 0;
+        iterator (InstructionStore* s, uint4 c, uint4 p) :
+            store (s), chunk (c), pos (p)
+        {
+        }
+        const Entry& entry () const { return store->index[chunk][pos]; }
+
+    public:
+        typedef bidirectional_iterator_tag iterator_category;
+        typedef Instruction value_type;
+        typedef ptrdiff_t difference_type;
+        typedef Instruction* pointer;
+        typedef Instruction& reference;
+
+        iterator () = default;
+        Handle handle () const { return entry ().handle; }
+        Instruction& operator* () const { return store->storage[entry ().handle]; }
+        Instruction* operator-> () const { return &**this; }
+        iterator& operator++ ()
+        {
+            if (++pos == store->index[chunk].size ()) {
+                ++chunk;
+                pos = 0;
+            }
+            return *this;
         }
+        iterator& operator-- ()
+        {
+            if (pos == 0)
+                pos = store->index[--chunk].size ();
+            --pos;
+            return *this;
+        }
+        iterator operator++ (int) { auto tmp = *this; ++*this; return tmp; }
+        iterator operator-- (int) { auto tmp = *this; --*this; return tmp; }
+        bool operator== (const iterator& other) const
+        {
+            return (chunk == other.chunk) && (pos == other.pos);
+        }
+        bool operator!= (const iterator& other) const { return !(*this == other); }
+    };
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+
+    // Returns the existing instruction at "address" (second == false) or a
+    // freshly created one with only the address filled in (second == true).
+    pair<Handle, bool> insert (uintb address);
+    Handle find (uintb address) const;
+
+    Instruction& operator[] (Handle h) { return storage[h]; }
+    iterator at (Handle h);
+
+    uint4 size () const { return storage.size (); }
+    bool empty () const { return storage.empty (); }
+    void clear () { index.clear (); storage.clear (); }
+
+    iterator begin () { return iterator (this, 0, 0); }
+    iterator end () { return iterator (this, index.size (), 0); }
+    reverse_iterator rbegin () { return reverse_iterator (end ()); }
+    reverse_iterator rend () { return reverse_iterator (begin ()); }
+};
+
+/* DecodeMap
+ *   What decoding produced at each offset of an image, filled in on demand by
+ *   Hutch::decodeCached(). Besides the instruction it also keeps the reverse
+ *   of the fallthrough edges: bit k of preds(x) is set when the instruction at
+ *   x - k always continues at x. Any offset is decoded at most once no matter
+ *   how many backward windows overlap it. Storage comes in pages of
+ *   PAGE_SIZE offsets, allocated the first time an offset in them is touched,
+ *   so a few backward queries over a large image stay small.
+ */
+class DecodeMap {
+public:
+    enum {
+        UNKNOWN   = 0,
+        VALID     = (1 << 0),   // Decodes, with pcode semantics
+        INVALID   = (1 << 1),   // Bad data or no semantics
+        FALLTHRU  = (1 << 2),   // Never branches, calls or returns
+        PREDS     = (1 << 3),   // preds() is filled in
+        MAX_BACK  = 15,         // Farthest a predecessor can start, in bytes
+        PAGE_SIZE = 4096        // Offsets per page
+    };
+
+private:
+    struct Page {
+        uint1 flags[PAGE_SIZE] = {};
+        uint1 length[PAGE_SIZE] = {};
+        uint2 preds[PAGE_SIZE] = {};
+        InstructionStore::Handle handles[PAGE_SIZE];
+
+        Page () { fill (handles, handles + PAGE_SIZE, InstructionStore::invalid); }
+    };
+    vector<unique_ptr<Page>> pages;
+    uintb mapsize = 0;
+
+    Page& page (uintb offset)
+    {
+        auto& p = pages[offset / PAGE_SIZE];
+        if (!p)
+            p = make_unique<Page> ();
+        return *p;
     }
 
-    uint1* rawBytes ()
+public:
+    bool empty () const { return pages.empty (); }
+    uintb size () const { return mapsize; }
+    void reset (uintb size)
     {
-        return raw;
+        pages.clear ();
+        pages.resize ((size + PAGE_SIZE - 1) / PAGE_SIZE);
+        mapsize = size;
     }
+    void clear ()
+    {
+        pages.clear ();
+        mapsize = 0;
+    }
+    // Each accessor allocates the page holding "offset" if it is not yet.
+    uint1& flags (uintb offset) { return page (offset).flags[offset % PAGE_SIZE]; }
+    uint1& length (uintb offset) { return page (offset).length[offset % PAGE_SIZE]; }
+    uint2& preds (uintb offset) { return page (offset).preds[offset % PAGE_SIZE]; }
+    InstructionStore::Handle& handle (uintb offset)
+    {
+        return page (offset).handles[offset % PAGE_SIZE];
+    }
+};
+
+class Hutch_Instructions;
+/* GadgetView
+ *   One chain of instructions, in execution order, that ends at a chosen
+ *   instruction (e.g. a RET). Refers to instructions stored in a
+ *   Hutch_Instructions and stays valid until that listing is cleared.
+ */
+class GadgetView {
+    friend class Hutch;
+    Hutch_Instructions* insn = nullptr;
+    uint4 first = 0;            // Start in Hutch_Instructions::chains
+    uint4 count = 0;
 
+public:
+    uint4 size () const { return count; }
+    uintb address () const { return (*this)[0].address; }
+    Instruction& operator[] (uint4 i) const;
 };
 
 class Hutch;
@@ -182,28 +526,29 @@ class Hutch;
 class Hutch_Instructions : public Hutch_Emit {
     friend class Hutch;
 
-    vector<Instruction> instructions;
+    friend class GadgetView;
+
+    InstructionStore instructions;
+    // Backing storage for every Instruction::pcode in "instructions".
+    PcodeArena arena;
+    // Per-offset decode results, see Hutch::decodeCached().
+    DecodeMap decodemap;
+    // Backing storage for every GadgetView handed out by Hutch::gadgets().
+    vector<InstructionStore::Handle> chains;
 
     // For tracking the most recent disassembled instruction.
     // Gets set in disassemble_iter.
-    Instruction* currentinsn = nullptr;
+    InstructionStore::Handle currentinsn = InstructionStore::invalid;
 
     void storeInstruction (Address const&, any);
 
-    void removeBadInstruction () override;
-
     // A mark is used as a point of reference as you disassemble. The way
     // disassembling works in Hutch, (or really in Sleigh) is decoding each
     // address _instruction by instruction_. Note the emphasis on *instruction*
     // rather than decoding being based on a byte by byte level. Hutch allows
     // you to force disassembling on a byte by byte basis, but the idea to keep
     // in mind is that you can only set a mark at a known instruction address.
-    // *
-    // Maintenance NOTE: mark is made possible, despite instructions being
-    //   stored in a vector, by logic present in
-    //   Hutch_Instructions::storeInstruction. to track when/if vector
-    //   "instructions" dynamically relocates in memory.
-    Instruction* mark = nullptr;
+    InstructionStore::Handle mark = InstructionStore::invalid;
 
     // fills in Instruction::pcode via trans.oneInstruction()
     virtual void dumpPcode (Address const& addr, OpCode opc,
@@ -212,22 +557,25 @@ class Hutch_Instructions : public Hutch_Emit {
     // fills in Instruction::assembly via trans.printAssembly()
     virtual void dumpAsm (const Address& addr, const string& mnem,
                           const string& body) override;
+    // fills in a whole Instruction via Hutch::disassemble_iter()
+    virtual void dumpInstruction (const Address& addr,
+                                  const InstructionRecord& rec) override;
 
 public:
+    typedef InstructionStore::iterator iterator;
+
     Hutch_Instructions () = default;
-    // TODO
-    // ~Hutch_Insn() = default;
-    // - Hutch_Instructions::Instruction.pcode needs to be released
-    //   (cannot write a destructor for PcodeData, need to manage it manually)
 
     uint4 count () { return instructions.size (); }
+    Instruction& operator[] (InstructionStore::Handle h) { return instructions[h]; }
+    // Drops every stored instruction and its pcode in one go.
+    void clear ();
 
-    vector<Instruction>::iterator current ();
+    iterator current ();
 
     // setMark + resetMark are apart of class Hutch
     // but mark is located here.
-    auto getMark () -> vector<Instruction>::iterator
-    { return instructions.begin() + distance (instructions.data(), mark); }
+    iterator getMark ();
     auto begin () { return instructions.begin (); }
     auto end () { return instructions.end (); }
     auto rbegin () { return instructions.rbegin (); }
@@ -251,12 +599,21 @@ class Hutch {
     vector<pair<string, int4>> cpucontext;
     // Disassembler options, e.g., OPT_IN_DISP_ADDR, OPT_IN_PCODE, ...
     ssize_t optionslist = -1;
+    // Reused by disassemble_iter() so its buffers are only allocated once.
+    InstructionRecord decoded;
+    // Decoded instructions kept between runs, see useDecodeCache().
+    unique_ptr<SharedDecodeCache> decodecache;
+    string decodecachepath;
+    uint8 decodecachekey = 0;
 
-    void storeRawInstructionBytes (const Instruction& insn);
+    // Builds the translator over "loader", shared by both initialize()s.
+    void setupTranslator ();
 
 public:
     Hutch () = default;
     Hutch (int4 arch, const uint1* buf, uintb bufsize);
+    // Maps the file at "path" as the image, see MappedLoadImage.
+    Hutch (int4 arch, const string& path);
     ~Hutch () = default; // TODO
     // Sets up docstorage.
     void preconfigure (int4 cpu_arch);
@@ -264,35 +621,72 @@ public:
     void options (const uint1 options) { optionslist = options; }
     // Creates image of executable.
     void initialize (uint1 const* buf, uintb bufsize, uintb baseaddr);
+    // Same, but the image is the file at "path", mapped rather than read.
+    void initialize (const string& path, uintb baseaddr);
 
     uintb getBufferSize () { return loader->getBufferSize(); }
+    uint1 const* getBuffer () { return loader->getBuffer(); }
 
     int4 instructionLength (const uintb baseaddr);
 
+    // Keeps every decoded instruction in the file "path" so later runs over
+    // the same image and specification skip decoding. Call after
+    // initialize(). Returns the number of instructions read from the file.
+    int4 useDecodeCache (const string& path);
+    // Appends the instructions decoded since useDecodeCache() to its file.
+    // Returns the number written.
+    int4 saveDecodeCache ();
+
+    // Decodes the instruction at "offset" into "emitter" and returns its
+    // length. Returns 0, emitting nothing, past the end of the image and for
+    // bytes that are bad data or decode without pcode semantics.
     uint disassemble_iter(uintb offset, Hutch_Emit* emitter);
 
-    vector<Instruction>
+    // Linear sweep of the whole image, split into ranges that are decoded on
+    // "nthreads" workers (0 = one per core) sharing this Hutch's Sleigh
+    // specification. The results are stitched together in address order and
+    // stored in "insn". Stores exactly what a serial sweep that steps one
+    // byte past each offset disassemble_iter() rejects would. Returns the
+    // number of instructions found.
+    uintb disassemble_parallel (Hutch_Instructions& insn, uint4 nthreads = 0);
+
+    // Decodes at "offset" into "insn" the first time it is asked for, and
+    // answers from insn's DecodeMap after that. Returns the DecodeMap flags.
+    uint1 decodeCached (uintb offset, Hutch_Instructions& insn);
+    // Offsets whose instruction always continues at "offset", as a mask with
+    // bit k set for offset - k.
+    uint2 predecessors (uintb offset, Hutch_Instructions& insn);
+
+    // Every chain of fallthrough instructions, at most "depth" long and
+    // starting less than "limit" bytes back, that ends at one of "ends". Each
+    // instruction before the end must have a pcode op "select" accepts (any,
+    // if null). Chains are listed per end, shortest first.
+    vector<GadgetView> gadgets (const vector<uintb>& ends, uintb limit,
+                                uint4 depth, Hutch_Instructions& insn,
+                                bool (*select) (PcodeData) = nullptr);
+
+    // Instructions that end right where the one at "offset" starts, nearest
+    // first, as handles into "insn".
+    vector<InstructionStore::Handle>
     inspectPreviousInstruction (uintb offset, uintb limit,
                                  Hutch_Instructions& insn,
                                  bool (*select) (PcodeData));
 
     void printInstructionBytes (const Instruction& insn);
 
-    void printInstructionBytes (vector<Instruction>::iterator instr);
+    void printInstructionBytes (Hutch_Instructions::iterator instr);
 
     void setMark (uintb position,
                   Hutch_Instructions& insn)
     {
         this->disassemble_iter(position, &insn);
-        insn.mark = insn.instructions.data()
-                     + distance(insn.instructions.data(), insn.currentinsn);
+        insn.mark = insn.currentinsn;
     }
 
     void resetMark (uintb position, Hutch_Instructions& insn)
     {
         this->disassemble_iter(position, &insn);
-        insn.mark = insn.instructions.data()
-                     + distance(insn.instructions.data(), insn.currentinsn);
+        insn.mark = insn.currentinsn;
     }
 
 };
@@ -24,6 +24,13 @@
 
 #include <iostream>
 #include <string>
+#include <sstream>
+#include <cstring>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 class XmlScan {
 public:
@@ -43,31 +50,28 @@ public:
       ElementBraceToken = 265,
       CommandBraceToken = 266 };
 private:
+  enum { WINDOW_SIZE = 65536 };	// Characters read from a stream at a time
   mode curmode;
-  istream &s;
+  istream *s;			// Stream being scanned, or null when scanning memory
+  char *window;			// Buffer holding the characters read from the stream
+  const char *cur;		// Next character to scan
+  const char *end;		// End of the characters available to scan
+  const char *runstart;		// Start of the characters being collected into lvalue
   string *lvalue;		// Current string being built
-  int4 lookahead[4];
-  int4 pos;
   bool endofstream;		// Has end of stream been reached
   void clearlvalue(void);
+  bool fill(int4 need);
+  int4 next(int4 i) {
+    if ((cur+i >= end)&&(!fill(i+1))) return -1;
+    return (uint1)cur[i];
+  }
   int4 getxmlchar(void) {
-    char c;
-    int4 ret=lookahead[pos];
-    if (!endofstream) {
-      s.get(c); 
-      if (s.eof()||(c=='\0')) {
-	endofstream = true;
-	lookahead[pos] = '\n';
-      }
-      else
-	lookahead[pos] = c;
-    }
-    else
-      lookahead[pos] = -1;
-    pos = (pos+1)&3;
+    int4 ret = next(0);
+    if (ret != -1) cur += 1;
     return ret;
   }
-  int4 next(int4 i) { return lookahead[(pos+i)&3]; }
+  void beginRun(void) { runstart = cur; }
+  void endRun(void) { lvalue->append(runstart,cur-runstart); runstart = (const char *)0; }
   bool isLetter(int4 val) { return (((val>=0x41)&&(val<=0x5a))||((val>=0x61)&&(val<=0x7a))); }
   bool isInitialNameChar(int4 val);
   bool isNameChar(int4 val);
@@ -82,6 +86,7 @@ private:
   int4 scanSName(void);
 public:
   XmlScan(istream &t);
+  XmlScan(const char *buf,uintb len);
   ~XmlScan(void);
   void setmode(mode m) { curmode = m; }
   int4 nexttoken(void);		// Interface for bison
@@ -201,20 +206,38 @@ CharRef: charrefstart CHARREF ';' { $$ = $2; };
 EntityRef: refstart NAME ';' { $$ = $2; };
 %%
 
-XmlScan::XmlScan(istream &t) : s(t)
+XmlScan::XmlScan(istream &t)
 
 {
   curmode = SingleMode;
+  s = &t;
+  window = new char[WINDOW_SIZE+1];
+  cur = window;
+  end = window;
+  runstart = (const char *)0;
+  lvalue = (string *)0;
+  endofstream = false;
+}
+
+XmlScan::XmlScan(const char *buf,uintb len)
+
+{				// Scan the characters in place, up to any terminating null
+  curmode = SingleMode;
+  s = (istream *)0;
+  window = new char[4];		// Only ever holds the last few characters and the final newline
+  const char *nul = (const char *)memchr(buf,'\0',len);
+  cur = buf;
+  end = (nul != (const char *)0) ? nul : buf + len;
+  runstart = (const char *)0;
   lvalue = (string *)0;
-  pos = 0;
   endofstream = false;
-  getxmlchar(); getxmlchar(); getxmlchar(); getxmlchar(); // Fill lookahead buffer
 }
 
 XmlScan::~XmlScan(void)
 
 {
   clearlvalue();
+  delete [] window;
 }
 
 void XmlScan::clearlvalue(void)
@@ -224,6 +247,39 @@ void XmlScan::clearlvalue(void)
     delete lvalue;
 }
 
+bool XmlScan::fill(int4 need)
+
+{				// Move the unscanned characters to the front of the window and read
+				// more, until at least -need- are available or the input is exhausted
+  if (runstart != (const char *)0)	// Keep the characters collected so far
+    lvalue->append(runstart,cur-runstart);
+  int4 tail = end - cur;
+  memmove(window,cur,tail);
+  cur = window;
+  while((tail < need)&&(!endofstream)) {
+    int4 count = 0;
+    if (s != (istream *)0)
+      count = s->rdbuf()->sgetn(window+tail,WINDOW_SIZE-tail);
+    bool done = (count <= 0);
+    if (!done) {
+      const char *nul = (const char *)memchr(window+tail,'\0',count);
+      if (nul != (const char *)0) {
+	count = nul - (window+tail);
+	done = true;
+      }
+      tail += count;
+    }
+    if (done) {
+      window[tail++] = '\n';	// End of input reads as a final newline
+      endofstream = true;
+    }
+  }
+  end = window + tail;
+  if (runstart != (const char *)0)
+    runstart = cur;
+  return (tail >= need);
+}
+
 int4 XmlScan::scanSingle(void)
 
 {
@@ -240,16 +296,21 @@ int4 XmlScan::scanCharData(void)
 {				// look for '<' '&' or ']]>'
   clearlvalue();
   lvalue = new string();
-  
-  while(next(0) != -1) {
-    if (next(0) == '<') break;
-    if (next(0) == '&') break;
-    if (next(0) == ']')
-      if (next(1)== ']')
-	if (next(2)=='>')
-	  break;
-    *lvalue += getxmlchar();
+  beginRun();
+  for(;;) {
+    const char *p = cur;
+    while((p < end)&&(*p != '<')&&(*p != '&')&&(*p != ']'))
+      ++p;
+    cur = p;
+    int4 c = next(0);		// Refills the window if the run reached its end
+    if ((c == -1)||(c == '<')||(c == '&')) break;
+    if (c == ']') {
+      if ((next(1) == ']')&&(next(2) == '>'))
+	break;
+      cur += 1;
+    }
   }
+  endRun();
   if (lvalue->size()==0)
     return scanSingle();
   return CharDataToken;
@@ -260,15 +321,16 @@ int4 XmlScan::scanCData(void)
 {				// Look for "]]>" and non-Char
   clearlvalue();
   lvalue = new string();
-
+  beginRun();
   while(next(0) != -1) {
     if (next(0)==']')
       if (next(1)==']')
 	if (next(2)=='>')
 	  break;
     if (!isChar(next(0))) break;
-    *lvalue += getxmlchar();
+    cur += 1;
   }
+  endRun();
   return CDataToken;		// CData can be empty
 }
 
@@ -278,16 +340,18 @@ int4 XmlScan::scanCharRef(void)
   int4 v;
   clearlvalue();
   lvalue = new string();
+  beginRun();
   if (next(0) == 'x') {
-    *lvalue += getxmlchar();
+    cur += 1;
     while(next(0) != -1) {
       v = next(0);
       if (v < '0') break;
       if ((v>'9')&&(v<'A')) break;
       if ((v>'F')&&(v<'a')) break;
       if (v>'f') break;
-      *lvalue += getxmlchar();
+      cur += 1;
     }
+    endRun();
     if (lvalue->size()==1)
       return 'x';		// Must be at least 1 hex digit
   }
@@ -296,8 +360,9 @@ int4 XmlScan::scanCharRef(void)
       v = next(0);
       if (v<'0') break;
       if (v>'9') break;
-      *lvalue += getxmlchar();
+      cur += 1;
     }
+    endRun();
     if (lvalue->size()==0)
       return scanSingle();
   }
@@ -309,12 +374,16 @@ int4 XmlScan::scanAttValue(int4 quote)
 {
   clearlvalue();
   lvalue = new string();
-  while(next(0) != -1) {
-    if (next(0) == quote) break;
-    if (next(0) == '<') break;
-    if (next(0) == '&') break;
-    *lvalue += getxmlchar();
+  beginRun();
+  for(;;) {
+    const char *p = cur;
+    while((p < end)&&(*p != quote)&&(*p != '<')&&(*p != '&'))
+      ++p;
+    cur = p;
+    if (p < end) break;		// Found a terminator
+    if (next(0) == -1) break;	// Otherwise refill, or stop at end of input
   }
+  endRun();
   if (lvalue->size() == 0)
     return scanSingle();
   return AttValueToken;
@@ -325,14 +394,15 @@ int4 XmlScan::scanComment(void)
 {
   clearlvalue();
   lvalue = new string();
-
+  beginRun();
   while(next(0) != -1) {
     if (next(0)=='-')
       if (next(1)=='-')
 	break;
     if (!isChar(next(0))) break;
-    *lvalue += getxmlchar();
+    cur += 1;
   }
+  endRun();
   return CommentToken;
 }
 
@@ -344,11 +414,11 @@ int4 XmlScan::scanName(void)
 
   if (!isInitialNameChar(next(0)))
     return scanSingle();
-  *lvalue += getxmlchar();
-  while(next(0) != -1) {
-    if (!isNameChar(next(0))) break;
-    *lvalue += getxmlchar();
-  }
+  beginRun();
+  cur += 1;
+  while(isNameChar(next(0)))
+    cur += 1;
+  endRun();
   return NameToken;
 }
 
@@ -358,7 +428,7 @@ int4 XmlScan::scanSName(void)
   int4 whitecount = 0;
   while((next(0)==' ')||(next(0)=='\n')||(next(0)=='\r')||(next(0)=='\t')) {
     whitecount += 1;
-    getxmlchar();
+    cur += 1;
   }
   clearlvalue();
   lvalue = new string();
@@ -367,11 +437,11 @@ int4 XmlScan::scanSName(void)
       return ' ';
     return scanSingle();
   }
-  *lvalue += getxmlchar();
-  while(next(0) != -1) {
-    if (!isNameChar(next(0))) break;
-    *lvalue += getxmlchar();
-  }
+  beginRun();
+  cur += 1;
+  while(isNameChar(next(0)))
+    cur += 1;
+  endRun();
   if (whitecount>0)
     return SNameToken;
   return NameToken;
@@ -499,13 +569,13 @@ int yyerror(const char *str)
   return 0;
 }
 
-int4 xml_parse(istream &i,ContentHandler *hand,int4 dbg)
+static int4 run_parse(XmlScan *scan,ContentHandler *hand,int4 dbg)
 
 {
 #if YYDEBUG
   yydebug = dbg;
 #endif
-  global_scan = new XmlScan(i);
+  global_scan = scan;
   handler = hand;
   handler->startDocument();
   int4 res = yyparse();
@@ -515,6 +585,18 @@ int4 xml_parse(istream &i,ContentHandler *hand,int4 dbg)
   return res;
 }
 
+int4 xml_parse(istream &i,ContentHandler *hand,int4 dbg)
+
+{
+  return run_parse(new XmlScan(i),hand,dbg);
+}
+
+int4 xml_parse(const char *buf,uintb len,ContentHandler *hand,int4 dbg)
+
+{
+  return run_parse(new XmlScan(buf,len),hand,dbg);
+}
+
 void TreeHandler::startElement(const string &namespaceURI,const string &localName,
 			       const string &qualifiedName,const Attributes &atts)
 {
@@ -538,6 +620,31 @@ void TreeHandler::characters(const char *text,int4 start,int4 length)
   cur->addContent(text,start,length);
 }
 
+// The packed image behind a Document.  Opening it indexes the string table
+// where it lies and unpacks the root element only.  Every other element is
+// unpacked, with its siblings, the first time its parent's children are asked
+// for, so the parts of a document nobody walks are never built.
+class PackedSource {
+  struct Str {
+    const char *ptr;
+    uint4 len;
+  };
+  void *map;			// Mapping released with the source, or null if the buffer is not ours
+  uintb maplen;			// Length of the mapping
+  const uint1 *end;		// End of the packed image
+  vector<Str> table;		// The string table, in place
+  mutable mutex lock;		// Held while unpacking children
+  uintb readInt(const uint1 *&cur) const;
+  void readString(const uint1 *&cur,string &res) const;
+  Element *readElement(Element *parent,const uint1 *&cur) const;
+  Document *read(const uint1 *buf);
+public:
+  PackedSource(const uint1 *buf,uintb len) { map = (void *)0; maplen = 0; end = buf + len; }
+  ~PackedSource(void) { if (map != (void *)0) munmap(map,maplen); }
+  void unpackChildren(const Element *el) const;
+  static Document *unpack(const uint1 *buf,uintb len,void *mp);
+};
+
 Element::~Element(void)
 
 {
@@ -547,6 +654,12 @@ Element::~Element(void)
     delete *iter;
 }
 
+void Element::unpackChildren(void) const
+
+{
+  packed.load(memory_order_acquire)->unpackChildren(this);
+}
+
 const string &Element::getAttributeValue(const string &nm) const
 
 {
@@ -576,14 +689,61 @@ Document *DocumentStorage::parseDocument(istream &s)
 Document *DocumentStorage::openDocument(const string &filename)
 
 { // Open and parse an XML file, return Document object
+  Document *res = mapDocument(filename,false);
+  if (res != (Document *)0) return res;
   ifstream s(filename.c_str());
   if (!s)
     throw XmlError("Unable to open xml document "+filename);
-  Document *res = parseDocument(s);
+  res = parseDocument(s);
   s.close();
   return res;
 }
 
+Document *DocumentStorage::openPackedDocument(const string &filename)
+
+{ // Map the file and unpack it if it carries the packed magic, otherwise return null
+  return mapDocument(filename,true);
+}
+
+Document *DocumentStorage::mapDocument(const string &filename,bool packedonly)
+
+{ // Map the file and build its tree from the mapping.  A packed document keeps the
+  // mapping and reads its elements from it as they are needed.  A text document
+  // is scanned without first being copied into a stream, but is still built into
+  // a complete Element tree, and the mapping is released.  Returns null if the
+  // file cannot be mapped
+  int fd = open(filename.c_str(),O_RDONLY);
+  if (fd < 0)
+    throw XmlError("Unable to open xml document "+filename);
+  struct stat st;
+  if ((fstat(fd,&st) != 0)||(st.st_size == 0)) {
+    close(fd);
+    return (Document *)0;
+  }
+  void *map = mmap((void *)0,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+  close(fd);
+  if (map == MAP_FAILED)
+    return (Document *)0;
+  const uint1 *buf = (const uint1 *)map;
+  Document *res = (Document *)0;
+  try {
+    if (xml_ispacked(buf,st.st_size))
+      res = PackedSource::unpack(buf,st.st_size,map);
+    else if (!packedonly) {
+      madvise(map,st.st_size,MADV_SEQUENTIAL);
+      res = xml_tree((const char *)buf,st.st_size);
+    }
+  } catch(XmlError &err) {
+    munmap(map,st.st_size);
+    throw XmlError(filename+": "+err.explain);
+  }
+  if (res == (Document *)0 || res->source == (PackedSource *)0)
+    munmap(map,st.st_size);
+  if (res != (Document *)0)
+    doclist.push_back(res);
+  return res;
+}
+
 void DocumentStorage::registerTag(const Element *el)
 
 { // Register a tag under its name
@@ -613,6 +773,18 @@ Document *xml_tree(istream &i)
   return doc;
 }
 
+Document *xml_tree(const char *buf,uintb len)
+
+{
+  Document *doc = new Document();
+  TreeHandler handle(doc);
+  if (0!=xml_parse(buf,len,&handle)) {
+    delete doc;
+    throw XmlError(handle.getError());
+  }
+  return doc;
+}
+
 void xml_escape(ostream &s,const char *str)
 
 {				// Escape xml tag indicators
@@ -630,3 +802,276 @@ void xml_escape(ostream &s,const char *str)
     str++;
   }
 }
+
+// Packed document format.  A header (magic, version), a table of every distinct
+// string in the document, then the element tree in preorder.  Each element is
+// name index, attribute count, (name,value) index pairs, content index, child
+// count, the byte length of its children, then the children.  All integers are
+// LEB128 varints.  The byte lengths let a reader step over a whole subtree, so
+// an element's children are only unpacked when something asks for them.
+
+class PackWriter {
+  map<string,uint4> index;
+  vector<const string *> table;
+  map<const Element *,uintb> childbytes;	// Byte length of each element's children
+  void intern(const string &str);
+  void collect(const Element *el);
+  uintb measure(const Element *el);
+  void emitElement(ostream &s,const Element *el) const;
+  static uintb intSize(uintb val);
+public:
+  static void emitInt(ostream &s,uintb val);
+  void write(ostream &s,const Element *el);
+};
+
+void PackWriter::emitInt(ostream &s,uintb val)
+
+{
+  do {
+    uint1 byte = val & 0x7f;
+    val >>= 7;
+    if (val != 0) byte |= 0x80;
+    s.put((char)byte);
+  } while(val != 0);
+}
+
+uintb PackWriter::intSize(uintb val)
+
+{ // Number of bytes emitInt() writes for the value
+  uintb res = 1;
+  while(val >= 0x80) {
+    val >>= 7;
+    res += 1;
+  }
+  return res;
+}
+
+void PackWriter::intern(const string &str)
+
+{
+  map<string,uint4>::iterator iter = index.find(str);
+  if (iter != index.end()) return;
+  index[str] = table.size();
+  table.push_back(&(*index.find(str)).first);
+}
+
+void PackWriter::collect(const Element *el)
+
+{
+  intern(el->getName());
+  intern(el->getContent());
+  for(int4 i=0;i<el->getNumAttributes();++i) {
+    intern(el->getAttributeName(i));
+    intern(el->getAttributeValue(i));
+  }
+  const List &list(el->getChildren());
+  for(List::const_iterator iter=list.begin();iter!=list.end();++iter)
+    collect(*iter);
+}
+
+uintb PackWriter::measure(const Element *el)
+
+{ // Record the byte length of the element's children, return the length of the whole element
+  uintb res = intSize((*index.find(el->getName())).second);
+  res += intSize(el->getNumAttributes());
+  for(int4 i=0;i<el->getNumAttributes();++i) {
+    res += intSize((*index.find(el->getAttributeName(i))).second);
+    res += intSize((*index.find(el->getAttributeValue(i))).second);
+  }
+  res += intSize((*index.find(el->getContent())).second);
+  const List &list(el->getChildren());
+  res += intSize(list.size());
+  uintb sub = 0;
+  for(List::const_iterator iter=list.begin();iter!=list.end();++iter)
+    sub += measure(*iter);
+  childbytes[el] = sub;
+  return res + intSize(sub) + sub;
+}
+
+void PackWriter::emitElement(ostream &s,const Element *el) const
+
+{
+  emitInt(s,(*index.find(el->getName())).second);
+  emitInt(s,el->getNumAttributes());
+  for(int4 i=0;i<el->getNumAttributes();++i) {
+    emitInt(s,(*index.find(el->getAttributeName(i))).second);
+    emitInt(s,(*index.find(el->getAttributeValue(i))).second);
+  }
+  emitInt(s,(*index.find(el->getContent())).second);
+  const List &list(el->getChildren());
+  emitInt(s,list.size());
+  emitInt(s,(*childbytes.find(el)).second);
+  for(List::const_iterator iter=list.begin();iter!=list.end();++iter)
+    emitElement(s,*iter);
+}
+
+void PackWriter::write(ostream &s,const Element *el)
+
+{
+  collect(el);
+  measure(el);
+  s.write(XML_PACKED_MAGIC,sizeof(XML_PACKED_MAGIC));
+  emitInt(s,XML_PACKED_VERSION);
+  emitInt(s,table.size());
+  for(uint4 i=0;i<table.size();++i) {
+    emitInt(s,table[i]->size());
+    s.write(table[i]->data(),table[i]->size());
+  }
+  emitElement(s,el);
+}
+
+uintb PackedSource::readInt(const uint1 *&cur) const
+
+{
+  uintb res = 0;
+  int4 shift = 0;
+  for(;;) {
+    if (cur >= end)
+      throw XmlError("Truncated packed document");
+    uint1 byte = *cur++;
+    res |= ((uintb)(byte & 0x7f)) << shift;
+    if ((byte & 0x80)==0) break;
+    shift += 7;
+    if (shift >= 8*sizeof(uintb))
+      throw XmlError("Bad integer in packed document");
+  }
+  return res;
+}
+
+void PackedSource::readString(const uint1 *&cur,string &res) const
+
+{
+  uintb ind = readInt(cur);
+  if (ind >= table.size())
+    throw XmlError("Bad string index in packed document");
+  res.assign(table[ind].ptr,table[ind].len);
+}
+
+Element *PackedSource::readElement(Element *parent,const uint1 *&cur) const
+
+{ // Unpack the element at cur, leaving its children packed, and step past its subtree
+  Element *el = new Element(parent);
+  try {
+    readString(cur,el->name);
+    uintb numattr = readInt(cur);
+    if (numattr > (uintb)(end - cur))
+      throw XmlError("Bad attribute count in packed document");
+    el->attr.resize(numattr);
+    el->value.resize(numattr);
+    for(uintb i=0;i<numattr;++i) {
+      readString(cur,el->attr[i]);
+      readString(cur,el->value[i]);
+    }
+    readString(cur,el->content);
+    uintb numchild = readInt(cur);
+    uintb bytes = readInt(cur);
+    if (bytes > (uintb)(end - cur) || numchild > bytes || numchild > 0xffffffff)
+      throw XmlError("Bad element length in packed document");
+    if (numchild != 0) {
+      el->packedpos = cur;
+      el->packednum = numchild;
+      el->packed.store(this,memory_order_relaxed);
+    }
+    cur += bytes;
+  } catch(XmlError &err) {
+    delete el;
+    throw;
+  }
+  return el;
+}
+
+void PackedSource::unpackChildren(const Element *el) const
+
+{
+  lock_guard<mutex> guard(lock);
+  if (el->packed.load(memory_order_relaxed) == (const PackedSource *)0) return; // Another thread got here first
+  List list;
+  const uint1 *cur = el->packedpos;
+  try {
+    for(uint4 i=0;i<el->packednum;++i)
+      list.push_back(readElement((Element *)el,cur));
+  } catch(XmlError &err) {
+    for(List::iterator iter=list.begin();iter!=list.end();++iter)
+      delete *iter;
+    throw;
+  }
+  el->children.swap(list);
+  el->packed.store((const PackedSource *)0,memory_order_release);
+}
+
+Document *PackedSource::read(const uint1 *buf)
+
+{
+  const uint1 *cur = buf + sizeof(XML_PACKED_MAGIC);
+  if (readInt(cur) != XML_PACKED_VERSION)
+    throw XmlError("Unsupported packed document version");
+  uintb numstr = readInt(cur);
+  if (numstr > (uintb)(end - cur))
+    throw XmlError("Bad string table in packed document");
+  table.resize(numstr);
+  for(uintb i=0;i<numstr;++i) {
+    uintb len = readInt(cur);
+    if (len > (uintb)(end - cur))
+      throw XmlError("Truncated packed document");
+    table[i].ptr = (const char *)cur;
+    table[i].len = len;
+    cur += len;
+  }
+  Document *doc = new Document();
+  try {
+    doc->addChild(readElement(doc,cur));
+    if (cur != end)		// The root's subtree must account for the rest of the image
+      throw XmlError("Bad length in packed document");
+  } catch(XmlError &err) {
+    delete doc;
+    throw;
+  }
+  return doc;
+}
+
+Document *PackedSource::unpack(const uint1 *buf,uintb len,void *mp)
+
+{ // Open the packed image in buf.  With a mapping, the Document releases it once freed
+  PackedSource *source = new PackedSource(buf,len);
+  Document *doc;
+  try {
+    doc = source->read(buf);
+  } catch(XmlError &err) {
+    delete source;
+    throw;
+  }
+  source->map = mp;
+  source->maplen = len;
+  doc->source = source;
+  return doc;
+}
+
+Document::~Document(void)
+
+{
+  // The children only need the source to unpack, not to be freed
+  if (source != (PackedSource *)0)
+    delete source;
+}
+
+bool xml_ispacked(const uint1 *buf,uintb len)
+
+{
+  if (len < sizeof(XML_PACKED_MAGIC)) return false;
+  return (memcmp(buf,XML_PACKED_MAGIC,sizeof(XML_PACKED_MAGIC))==0);
+}
+
+void xml_pack(ostream &s,const Element *el)
+
+{
+  PackWriter writer;
+  writer.write(s,el);
+}
+
+Document *xml_unpack(const uint1 *buf,uintb len)
+
+{
+  if (!xml_ispacked(buf,len))
+    throw XmlError("Not a packed document");
+  return PackedSource::unpack(buf,len,(void *)0);
+}
@@ -21,6 +21,7 @@ ParserContext::ParserContext(ContextCache *ccache)
 
 {
   parsestate = 0;
+  bytes = buf;
   contcache = ccache;
   if (ccache != (ContextCache *)0) {
     contextsize = ccache->getDatabase()->getContextSize();
@@ -50,7 +51,7 @@ uintm ParserContext::getInstructionBytes(int4 bytestart,int4 size,uint4 off) con
   off += bytestart;
   if (off >=16)
     throw BadDataError("Instruction is using more than 16 bytes"); 
-  const uint1 *ptr = buf + off;
+  const uint1 *ptr = bytes + off;
   uintm res = 0;
   for(int4 i=0;i<size;++i) {
     res <<= 8;
@@ -65,7 +66,7 @@ uintm ParserContext::getInstructionBits(int4 startbit,int4 size,uint4 off) const
   off += (startbit/8);
   if (off >= 16)
     throw BadDataError("Instruction is using more than 16 bytes");
-  const uint1 *ptr = buf + off;
+  const uint1 *ptr = bytes + off;
   startbit = startbit % 8;
   int4 bytesize = (startbit+size-1)/8 + 1;
   uintm res = 0;
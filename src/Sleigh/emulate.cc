@@ -216,6 +216,10 @@ void Emulate::executeCurrentOp(void)
 void EmulateMemory::executeUnary(void)
 
 {
+  if (isWideOp()) {
+    executeUnaryWide();
+    return;
+  }
   uintb in1 = memstate->getValue(currentOp->getInput(0));
   uintb out = currentBehave->evaluateUnary(currentOp->getOutput()->size,
 					   currentOp->getInput(0)->size,in1);
@@ -225,6 +229,10 @@ void EmulateMemory::executeUnary(void)
 void EmulateMemory::executeBinary(void)
 
 {
+  if (isWideOp()) {
+    executeBinaryWide();
+    return;
+  }
   uintb in1 = memstate->getValue(currentOp->getInput(0));
   uintb in2 = memstate->getValue(currentOp->getInput(1));
   uintb out = currentBehave->evaluateBinary(currentOp->getOutput()->size,
@@ -232,6 +240,50 @@ void EmulateMemory::executeBinary(void)
   memstate->setValue(currentOp->getOutput(),out);
 }
 
+/// Values that fit in a uintb take the integer path; anything wider (SSE and AVX
+/// registers) goes through the byte-span evaluation of the OpBehavior.
+/// \return \b true if the output or an input of the current op is wider than a uintb
+bool EmulateMemory::isWideOp(void) const
+
+{
+  const VarnodeData *outvn = currentOp->getOutput();
+  if ((outvn != (const VarnodeData *)0)&&(outvn->size > sizeof(uintb)))
+    return true;
+  for(int4 i=0;i<currentOp->numInput();++i)
+    if (currentOp->getInput(i)->size > sizeof(uintb))
+      return true;
+  return false;
+}
+
+void EmulateMemory::executeUnaryWide(void)
+
+{
+  const VarnodeData *outvn = currentOp->getOutput();
+  const VarnodeData *vn1 = currentOp->getInput(0);
+  widebuf.resize(vn1->size + outvn->size);
+  uint1 *in1 = widebuf.data();
+  uint1 *out = in1 + vn1->size;
+  memstate->getWideValue(vn1,in1);
+  currentBehave->evaluateUnaryWide(outvn->size,vn1->size,in1,out);
+  memstate->setWideValue(outvn,out);
+}
+
+void EmulateMemory::executeBinaryWide(void)
+
+{
+  const VarnodeData *outvn = currentOp->getOutput();
+  const VarnodeData *vn1 = currentOp->getInput(0);
+  const VarnodeData *vn2 = currentOp->getInput(1);
+  widebuf.resize(vn1->size + vn2->size + outvn->size);
+  uint1 *in1 = widebuf.data();
+  uint1 *in2 = in1 + vn1->size;
+  uint1 *out = in2 + vn2->size;
+  memstate->getWideValue(vn1,in1);
+  memstate->getWideValue(vn2,in2);
+  currentBehave->evaluateBinaryWide(outvn->size,vn1->size,vn2->size,in1,in2,out);
+  memstate->setWideValue(outvn,out);
+}
+
 void EmulateMemory::executeLoad(void)
 
 {
@@ -239,18 +291,32 @@ void EmulateMemory::executeLoad(void)
   AddrSpace *spc = Address::getSpaceFromConst(currentOp->getInput(0)->getAddr());
 
   off = AddrSpace::addressToByte(off,spc->getWordSize());
-  uintb res = memstate->getValue(spc,off,currentOp->getOutput()->size);
-  memstate->setValue(currentOp->getOutput(),res);
+  const VarnodeData *outvn = currentOp->getOutput();
+  if (outvn->size > sizeof(uintb)) {
+    widebuf.resize(outvn->size);
+    memstate->getWideValue(spc,off,outvn->size,widebuf.data());
+    memstate->setWideValue(outvn,widebuf.data());
+    return;
+  }
+  uintb res = memstate->getValue(spc,off,outvn->size);
+  memstate->setValue(outvn,res);
 }
 
 void EmulateMemory::executeStore(void)
 
 {
-  uintb val = memstate->getValue(currentOp->getInput(2)); // Value being stored
+  const VarnodeData *valvn = currentOp->getInput(2);
   uintb off = memstate->getValue(currentOp->getInput(1)); // Offset to store at
   AddrSpace *spc = Address::getSpaceFromConst(currentOp->getInput(0)->getAddr()); // Space to store in
 
   off = AddrSpace::addressToByte(off,spc->getWordSize());
+  if (valvn->size > sizeof(uintb)) {
+    widebuf.resize(valvn->size);
+    memstate->getWideValue(valvn,widebuf.data());
+    memstate->setWideValue(spc,off,valvn->size,widebuf.data());
+    return;
+  }
+  uintb val = memstate->getValue(valvn); // Value being stored
   memstate->setValue(spc,off,currentOp->getInput(2)->size,val);
 }
 
@@ -333,24 +399,73 @@ EmulatePcodeCache::EmulatePcodeCache(Translate *t,MemoryState *s,BreakTable *b)
   OpBehavior::registerInstructions(inst,t);
   breaktable = b;
   breaktable->setEmulate(this);
+  current = (CachedInstruction *)0;
+  generation = 0;
+  maxlength = 0;
+}
+
+CachedInstruction::~CachedInstruction(void)
+
+{
+  for(int4 i=0;i<ops.size();++i)
+    delete ops[i];
+  for(int4 i=0;i<vars.size();++i)
+    delete vars[i];
+}
+
+/// The instruction is removed from the address map.  If it is the one being executed
+/// it is kept alive until execution moves to the next instruction.
+/// \param insn is the instruction to drop
+void EmulatePcodeCache::discard(CachedInstruction *insn)
+
+{
+  translations.erase(insn->addr);
+  if (insn == current)
+    retired.push_back(insn);
+  else
+    delete insn;
 }
 
-/// Free all the VarnodeData and PcodeOpRaw objects and clear the cache
-void EmulatePcodeCache::clearCache(void)
+void EmulatePcodeCache::clearRetired(void)
 
 {
-  for(int4 i=0;i<opcache.size();++i)
-    delete opcache[i];
-  for(int4 i=0;i<varcache.size();++i)
-    delete varcache[i];
-  opcache.clear();
-  varcache.clear();
+  for(int4 i=0;i<retired.size();++i) {
+    if (retired[i] != current)
+      delete retired[i];
+  }
+  retired.clear();
+}
+
+/// Free every cached translation.  Any instruction in the middle of execution
+/// stays valid until execution leaves it.
+void EmulatePcodeCache::flushTranslations(void)
+
+{
+  map<Address,CachedInstruction *>::iterator iter;
+  for(iter=translations.begin();iter!=translations.end();++iter) {
+    CachedInstruction *insn = (*iter).second;
+    if (insn == current)
+      retired.push_back(insn);
+    else
+      delete insn;
+  }
+  translations.clear();
+  generation += 1;
+  maxlength = 0;
 }
 
 EmulatePcodeCache::~EmulatePcodeCache(void)
 
 {
-  clearCache();
+  int4 num = trans->numSpaces();
+  for(int4 i=0;i<num;++i) {
+    AddrSpace *spc = trans->getSpace(i);
+    if ((spc != (AddrSpace *)0)&&(memstate->getWriteWatch(spc) == this))
+      memstate->setWriteWatch(spc,(MemoryWriteWatch *)0);
+  }
+  current = (CachedInstruction *)0;
+  flushTranslations();
+  clearRetired();
   for(int4 i=0;i<inst.size();++i) {
     OpBehavior *t_op = inst[i];
     if (t_op != (OpBehavior *)0)
@@ -358,26 +473,97 @@ EmulatePcodeCache::~EmulatePcodeCache(void)
   }
 }
 
-/// This is a private routine which does the work of translating a machine
-/// instruction into pcode, putting it into the cache, and setting up the
-/// iterators
-/// \param addr is the address of the instruction to translate
-void EmulatePcodeCache::createInstruction(const Address &addr)
+/// Derived engines override this to attach their own decoded form of the
+/// instruction to the cache entry.
+/// \param addr is the address of the instruction
+/// \return a new empty cache entry
+CachedInstruction *EmulatePcodeCache::newInstruction(const Address &addr)
+
+{
+  return new CachedInstruction(addr);
+}
+
+/// Return the cached translation of the instruction at the given address,
+/// translating it into pcode first if it has not been seen (or was invalidated).
+/// \param addr is the address of the instruction
+/// \return the cached instruction
+CachedInstruction *EmulatePcodeCache::translate(const Address &addr)
+
+{
+  map<Address,CachedInstruction *>::iterator iter = translations.find(addr);
+  if (iter != translations.end())
+    return (*iter).second;
+  CachedInstruction *insn = newInstruction(addr);
+  PcodeEmitCache emit(insn->ops,insn->vars,inst,0);
+  try {
+    insn->length = trans->oneInstruction(emit,addr);
+  } catch(...) {
+    delete insn;
+    throw;
+  }
+  AddrSpace *spc = addr.getSpace();
+  if (memstate->getWriteWatch(spc) != this)
+    memstate->setWriteWatch(spc,this);
+  if (insn->length > maxlength)
+    maxlength = insn->length;
+  translations[addr] = insn;
+  return insn;
+}
+
+/// Make the given cached instruction current and set up the iterators
+/// \param insn is the instruction to start executing
+void EmulatePcodeCache::startInstruction(CachedInstruction *insn)
 
 {
-  clearCache();
-  PcodeEmitCache emit(opcache,varcache,inst,0);
-  instruction_length = trans->oneInstruction(emit,addr);
+  current = insn;
+  if (!retired.empty())
+    clearRetired();
   current_op = 0;
   instruction_start = true;
 }
 
+/// This is a private routine which makes the translation of the machine
+/// instruction at the given address current, translating it into pcode
+/// if it is not already in the cache, and sets up the iterators
+/// \param addr is the address of the instruction to translate
+void EmulatePcodeCache::createInstruction(const Address &addr)
+
+{
+  startInstruction(translate(addr));
+}
+
+/// Writes to spaces without cached code never reach here.  Otherwise every
+/// instruction whose bytes overlap the written range is dropped, and links
+/// between instructions are invalidated by bumping the generation.
+/// \param spc is the address space written
+/// \param off is the first byte written
+/// \param size is the number of bytes written
+void EmulatePcodeCache::memoryWritten(AddrSpace *spc,uintb off,int4 size)
+
+{
+  if (translations.empty()) return;
+  uintb lowoff = (off < (uintb)maxlength) ? 0 : off - maxlength + 1;
+  map<Address,CachedInstruction *>::iterator iter = translations.lower_bound(Address(spc,lowoff));
+  bool dropped = false;
+  while(iter != translations.end()) {
+    CachedInstruction *insn = (*iter).second;
+    if (insn->addr.getSpace() != spc) break;
+    if (insn->addr.getOffset() >= off + size) break;
+    ++iter;
+    if (insn->addr.getOffset() + insn->length <= off) continue;
+    discard(insn);
+    dropped = true;
+  }
+  if (dropped)
+    generation += 1;
+}
+
 /// Set-up currentOp and currentBehave
 void EmulatePcodeCache::establishOp(void)
 
 {
-  if (current_op < opcache.size()) {
-    currentOp = opcache[current_op];
+  if (current_op < current->ops.size()) {
+    currentOp = current->ops[current_op];
     currentBehave = currentOp->getBehavior();
     return;
   }
@@ -392,10 +578,39 @@ void EmulatePcodeCache::fallthruOp(void)
 {
   instruction_start = false;
   current_op += 1;
-  if (current_op >= opcache.size()) {
-    current_address = current_address + instruction_length;
-    createInstruction(current_address);
+  if (current_op >= current->ops.size()) {
+    CachedInstruction *prev = current;
+    CachedInstruction *next;
+    if ((prev->fallthru != (CachedInstruction *)0)&&(prev->linkgen == generation))
+      next = prev->fallthru;	// Still linked, skip the address lookup
+    else {
+      next = translate(current_address + prev->length);
+      prev->fallthru = next;
+      prev->linkgen = generation;
+    }
+    current_address = next->addr;
+    startInstruction(next);
+  }
+  establishOp();
+}
+
+/// Like setExecuteAddress, but the target is remembered on the current instruction
+/// so a branch that keeps going to the same place skips the address lookup.
+/// \param dest is the address of the branch target
+void EmulatePcodeCache::branchTo(const Address &dest)
+
+{
+  CachedInstruction *prev = current;
+  CachedInstruction *next;
+  if ((prev->taken != (CachedInstruction *)0)&&(prev->takengen == generation)&&(prev->taken->addr == dest))
+    next = prev->taken;
+  else {
+    next = translate(dest);
+    prev->taken = next;
+    prev->takengen = generation;
   }
+  current_address = next->addr;
+  startInstruction(next);
   establishOp();
 }
 
@@ -408,13 +623,13 @@ void EmulatePcodeCache::executeBranch(void)
     uintm id = destaddr.getOffset();
     id = id + (uintm)current_op;
     current_op = id;
-    if (current_op == opcache.size())
+    if (current_op == current->ops.size())
       fallthruOp();
-    else if ((current_op < 0)||(current_op >= opcache.size()))
+    else if ((current_op < 0)||(current_op >= current->ops.size()))
       throw LowlevelError("Bad intra-instruction branch");
   }
   else
-    setExecuteAddress(destaddr);
+    branchTo(destaddr);
 }
 
 /// Look for a breakpoint for the given user-defined op and invoke it.
@@ -434,7 +649,7 @@ void EmulatePcodeCache::setExecuteAddress(const Address &addr)
 
 {
   current_address = addr;	// Copy -addr- BEFORE calling createInstruction
-                                // as it calls clear and may delete -addr-
+                                // as it may free the instruction holding -addr-
   createInstruction(current_address);
   establishOp();
 }
@@ -0,0 +1,371 @@
+/*
+ * Copyright 2020 Joe Staursky
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "emulatefast.hh"
+
+/// \brief The op handlers used by EmulateFast
+///
+/// The common integer operations are evaluated inline; the template parameter
+/// selects the operation at compile time so each gets its own handler. Any
+/// other unary or binary op goes through its OpBehavior with the operands
+/// already resolved.
+struct FastExec {
+  static int4 fallback(EmulateFast &emu,const FastOp &op,int4 index);
+  template<int4 OPC> static int4 unary(EmulateFast &emu,const FastOp &op,int4 index);
+  template<int4 OPC> static int4 binary(EmulateFast &emu,const FastOp &op,int4 index);
+  static int4 load(EmulateFast &emu,const FastOp &op,int4 index);
+  static int4 store(EmulateFast &emu,const FastOp &op,int4 index);
+  static int4 branchRelative(EmulateFast &emu,const FastOp &op,int4 index);
+  static int4 branchAbsolute(EmulateFast &emu,const FastOp &op,int4 index);
+  static int4 cbranchRelative(EmulateFast &emu,const FastOp &op,int4 index);
+  static int4 cbranchAbsolute(EmulateFast &emu,const FastOp &op,int4 index);
+  static FastHandler select(OpCode opc,bool unaryop);
+};
+
+/// The raw op is executed by the EmulateMemory machinery, exactly as
+/// EmulatePcodeCache would, which may move execution anywhere.
+int4 FastExec::fallback(EmulateFast &emu,const FastOp &op,int4 index)
+
+{
+  emu.current_op = index;
+  emu.establishOp();
+  emu.executeCurrentOp();
+  return FastOp::leave_resync;
+}
+
+template<int4 OPC>
+int4 FastExec::unary(EmulateFast &emu,const FastOp &op,int4 index)
+
+{
+  uintb in1 = emu.readOperand(op.in[0]);
+  uintb res;
+  switch(OPC) {
+  case CPUI_COPY:
+  case CPUI_INT_ZEXT:
+    res = in1;
+    break;
+  case CPUI_INT_SEXT:
+    res = sign_extend(in1,op.in[0].size,op.out.size);
+    break;
+  case CPUI_BOOL_NEGATE:
+    res = in1 ^ 1;
+    break;
+  default:
+    res = op.behave->evaluateUnary(op.out.size,op.in[0].size,in1);
+    break;
+  }
+  emu.writeOperand(op.out,res);
+  return index + 1;
+}
+
+template<int4 OPC>
+int4 FastExec::binary(EmulateFast &emu,const FastOp &op,int4 index)
+
+{
+  uintb in1 = emu.readOperand(op.in[0]);
+  uintb in2 = emu.readOperand(op.in[1]);
+  uintb res;
+  switch(OPC) {
+  case CPUI_INT_ADD:
+    res = (in1 + in2) & calc_mask(op.out.size);
+    break;
+  case CPUI_INT_SUB:
+    res = (in1 - in2) & calc_mask(op.out.size);
+    break;
+  case CPUI_INT_XOR:
+  case CPUI_BOOL_XOR:
+    res = in1 ^ in2;
+    break;
+  case CPUI_INT_AND:
+  case CPUI_BOOL_AND:
+    res = in1 & in2;
+    break;
+  case CPUI_INT_OR:
+  case CPUI_BOOL_OR:
+    res = in1 | in2;
+    break;
+  case CPUI_INT_EQUAL:
+    res = (in1 == in2) ? 1 : 0;
+    break;
+  case CPUI_INT_NOTEQUAL:
+    res = (in1 != in2) ? 1 : 0;
+    break;
+  case CPUI_INT_LESS:
+    res = (in1 < in2) ? 1 : 0;
+    break;
+  case CPUI_INT_LESSEQUAL:
+    res = (in1 <= in2) ? 1 : 0;
+    break;
+  case CPUI_INT_CARRY:
+    res = (in1 > ((in1 + in2)&calc_mask(op.in[0].size))) ? 1 : 0;
+    break;
+  case CPUI_PIECE:
+    res = (in1<<((op.out.size-op.in[0].size)*8)) | in2;
+    break;
+  case CPUI_SUBPIECE:
+    res = (in1>>(in2*8)) & calc_mask(op.out.size);
+    break;
+  default:
+    res = op.behave->evaluateBinary(op.out.size,op.in[0].size,in1,in2);
+    break;
+  }
+  emu.writeOperand(op.out,res);
+  return index + 1;
+}
+
+/// Input 0 was decoded to carry the space being loaded from.
+int4 FastExec::load(EmulateFast &emu,const FastOp &op,int4 index)
+
+{
+  AddrSpace *spc = op.in[0].spc;
+  uintb off = AddrSpace::addressToByte(emu.readOperand(op.in[1]),spc->getWordSize());
+  emu.writeOperand(op.out,emu.memstate->getValue(spc,off,op.out.size));
+  return index + 1;
+}
+
+/// Input 0 was decoded to carry the space being stored to.
+int4 FastExec::store(EmulateFast &emu,const FastOp &op,int4 index)
+
+{
+  uintb val = emu.readOperand(op.in[2]);
+  AddrSpace *spc = op.in[0].spc;
+  uintb off = AddrSpace::addressToByte(emu.readOperand(op.in[1]),spc->getWordSize());
+  emu.memstate->setValue(spc,off,op.in[2].size,val);
+  return index + 1;
+}
+
+int4 FastExec::branchRelative(EmulateFast &emu,const FastOp &op,int4 index)
+
+{
+  return op.target;
+}
+
+int4 FastExec::branchAbsolute(EmulateFast &emu,const FastOp &op,int4 index)
+
+{
+  emu.branchTo(op.dest);
+  return FastOp::leave_branch;
+}
+
+int4 FastExec::cbranchRelative(EmulateFast &emu,const FastOp &op,int4 index)
+
+{
+  if (emu.readOperand(op.in[1]) == 0)
+    return index + 1;
+  return op.target;
+}
+
+int4 FastExec::cbranchAbsolute(EmulateFast &emu,const FastOp &op,int4 index)
+
+{
+  if (emu.readOperand(op.in[1]) == 0)
+    return index + 1;
+  emu.branchTo(op.dest);
+  return FastOp::leave_branch;
+}
+
+/// \param opc is the opcode of a unary or binary op
+/// \param unaryop is \b true if the op is unary
+/// \return the handler for the op
+FastHandler FastExec::select(OpCode opc,bool unaryop)
+
+{
+  switch(opc) {
+  case CPUI_COPY:		return unary<CPUI_COPY>;
+  case CPUI_INT_ZEXT:		return unary<CPUI_INT_ZEXT>;
+  case CPUI_INT_SEXT:		return unary<CPUI_INT_SEXT>;
+  case CPUI_BOOL_NEGATE:	return unary<CPUI_BOOL_NEGATE>;
+  case CPUI_INT_ADD:		return binary<CPUI_INT_ADD>;
+  case CPUI_INT_SUB:		return binary<CPUI_INT_SUB>;
+  case CPUI_INT_XOR:		return binary<CPUI_INT_XOR>;
+  case CPUI_BOOL_XOR:		return binary<CPUI_BOOL_XOR>;
+  case CPUI_INT_AND:		return binary<CPUI_INT_AND>;
+  case CPUI_BOOL_AND:		return binary<CPUI_BOOL_AND>;
+  case CPUI_INT_OR:		return binary<CPUI_INT_OR>;
+  case CPUI_BOOL_OR:		return binary<CPUI_BOOL_OR>;
+  case CPUI_INT_EQUAL:		return binary<CPUI_INT_EQUAL>;
+  case CPUI_INT_NOTEQUAL:	return binary<CPUI_INT_NOTEQUAL>;
+  case CPUI_INT_LESS:		return binary<CPUI_INT_LESS>;
+  case CPUI_INT_LESSEQUAL:	return binary<CPUI_INT_LESSEQUAL>;
+  case CPUI_INT_CARRY:		return binary<CPUI_INT_CARRY>;
+  case CPUI_PIECE:		return binary<CPUI_PIECE>;
+  case CPUI_SUBPIECE:		return binary<CPUI_SUBPIECE>;
+  default:
+    break;
+  }
+  if (unaryop)
+    return unary<CPUI_MAX>;
+  return binary<CPUI_MAX>;
+}
+
+/// \param t is the SLEIGH translator
+/// \param s is the MemoryState the emulator should manipulate
+/// \param b is the table of breakpoints the emulator should invoke
+EmulateFast::EmulateFast(Translate *t,MemoryState *s,BreakTable *b)
+  : EmulatePcodeCache(t,s,b)
+{
+}
+
+/// \param addr is the address of the instruction
+/// \return a new FastInstruction, decoded on first execution
+CachedInstruction *EmulateFast::newInstruction(const Address &addr)
+
+{
+  return new FastInstruction(addr);
+}
+
+/// Constants are folded into the operand. A varnode lying entirely in a
+/// MemoryFlatBank whose byte order matches the host becomes a direct pointer.
+/// Anything else is accessed through the MemoryState.
+/// \param res is the operand to fill in
+/// \param vn is the varnode being resolved
+void EmulateFast::resolveOperand(FastOperand &res,const VarnodeData *vn) const
+
+{
+  res.size = vn->size;
+  res.ptr = (uint1 *)0;
+  if (vn->space->getType() == IPTR_CONSTANT) {
+    res.spc = (AddrSpace *)0;
+    res.offset = vn->offset;
+    return;
+  }
+  res.spc = vn->space;
+  res.offset = vn->offset;
+  if ((HOST_ENDIAN==1) != vn->space->isBigEndian()) return;
+  MemoryFlatBank *flat = dynamic_cast<MemoryFlatBank *>(memstate->getMemoryBank(vn->space));
+  if ((flat != (MemoryFlatBank *)0)&&flat->contains(vn->offset,vn->size))
+    res.ptr = flat->getData() + vn->offset;
+}
+
+/// Every raw op gets a FastOp. Ops that cannot be decoded keep the fallback
+/// handler, which defers to the EmulateMemory routines.
+/// \param insn is the instruction to decode
+void EmulateFast::decode(FastInstruction *insn)
+
+{
+  int4 num = insn->ops.size();
+  insn->fastops.resize(num);
+  for(int4 i=0;i<num;++i) {
+    PcodeOpRaw *raw = insn->ops[i];
+    FastOp &op( insn->fastops[i] );
+    op.handler = FastExec::fallback;
+    op.behave = raw->getBehavior();
+    op.target = -1;
+    op.resolved = false;
+    if (op.behave == (OpBehavior *)0) continue;
+    int4 numin = raw->numInput();
+    if (numin > 3) continue;
+    bool wide = false;
+    VarnodeData *outvn = raw->getOutput();
+    if ((outvn != (VarnodeData *)0)&&(outvn->size > sizeof(uintb)))
+      wide = true;
+    for(int4 j=0;j<numin;++j) {
+      if (raw->getInput(j)->size > sizeof(uintb))
+	wide = true;
+    }
+    if (wide) continue;		// Leave to the generic path
+    if (outvn != (VarnodeData *)0)
+      resolveOperand(op.out,outvn);
+    for(int4 j=0;j<numin;++j)
+      resolveOperand(op.in[j],raw->getInput(j));
+    op.resolved = true;
+
+    OpCode opc = op.behave->getOpcode();
+    if (!op.behave->isSpecial()) {
+      if (outvn == (VarnodeData *)0) continue;
+      op.handler = FastExec::select(opc,op.behave->isUnary());
+      continue;
+    }
+    switch(opc) {
+    case CPUI_LOAD:
+    case CPUI_STORE:
+      op.in[0].spc = Address::getSpaceFromConst(raw->getInput(0)->getAddr());
+      op.handler = (opc == CPUI_LOAD) ? FastExec::load : FastExec::store;
+      break;
+    case CPUI_BRANCH:
+    case CPUI_CBRANCH:
+      {
+	const VarnodeData *destvn = raw->getInput(0);
+	if (destvn->space->getType() == IPTR_CONSTANT) {
+	  intb rel = (intb)destvn->offset;
+	  sign_extend(rel,8*destvn->size-1);
+	  intb target = i + rel;
+	  if ((target < 0)||(target > num)) break; // Let the fallback report it
+	  op.target = (int4)target;
+	  op.handler = (opc == CPUI_BRANCH) ? FastExec::branchRelative : FastExec::cbranchRelative;
+	}
+	else {
+	  op.dest = destvn->getAddr();
+	  op.handler = (opc == CPUI_BRANCH) ? FastExec::branchAbsolute : FastExec::cbranchAbsolute;
+	}
+      }
+      break;
+    default:
+      break;
+    }
+  }
+  insn->decoded = true;
+}
+
+/// Ops are executed from the current op index until execution reaches the
+/// start of another instruction (or the same one again).
+void EmulateFast::runInstruction(void)
+
+{
+  for(;;) {
+    FastInstruction *insn = (FastInstruction *)current;
+    if (!insn->decoded)
+      decode(insn);
+    const FastOp *ops = insn->fastops.data();
+    int4 num = insn->fastops.size();
+    int4 i = current_op;
+    while((i >= 0)&&(i < num))
+      i = ops[i].handler(*this,ops[i],i);
+    if (i == num) {		// Fell off the end of the instruction
+      current_op = num - 1;
+      fallthruOp();
+      return;
+    }
+    if (i == FastOp::leave_branch)
+      return;
+    if (instruction_start)	// Fallback op left the instruction
+      return;
+  }
+}
+
+/// If execution is at the start of an instruction, address breakpoints are
+/// checked first, as with EmulatePcodeCache::executeInstruction.
+void EmulateFast::executeInstruction(void)
+
+{
+  if (instruction_start) {
+    if (breaktable->doAddressBreak(current_address))
+      return;
+  }
+  runInstruction();
+}
+
+/// \param count is the maximum number of instructions to execute
+/// \return the number of instructions executed
+uintb EmulateFast::run(uintb count)
+
+{
+  uintb done = 0;
+  while((done < count)&&(!emu_halted)) {
+    executeInstruction();
+    done += 1;
+  }
+  return done;
+}
@@ -0,0 +1,691 @@
+/*
+ * Copyright 2020 Joe Staursky
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "emulatejit.hh"
+#include <sstream>
+#include <cstring>
+
+#ifdef CPUI_JIT_X86_64
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/// Returned by EmulateJit::callHandler when the handler threw
+static const int4 jit_error = -3;
+
+/// \param cap is the number of bytes of executable memory to reserve
+JitCodeBuffer::JitCodeBuffer(uintb cap)
+
+{
+  base = (uint1 *)0;
+  capacity = cap;
+  used = 0;
+  epoch = 1;
+#ifdef CPUI_JIT_X86_64
+  failed = false;
+#else
+  failed = true;
+#endif
+}
+
+JitCodeBuffer::~JitCodeBuffer(void)
+
+{
+#ifdef CPUI_JIT_X86_64
+  if (base != (uint1 *)0)
+    munmap(base,capacity);
+#endif
+}
+
+/// \param code is the machine code to install
+/// \return the executable copy, or \b null if the buffer is full or unavailable
+uint1 *JitCodeBuffer::install(const vector<uint1> &code)
+
+{
+#ifdef CPUI_JIT_X86_64
+  if (failed) return (uint1 *)0;
+  if (base == (uint1 *)0) {
+    void *res = mmap((void *)0,capacity,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+    if (res == MAP_FAILED) {
+      failed = true;
+      return (uint1 *)0;
+    }
+    base = (uint1 *)res;
+  }
+  uintb start = (used + 15) & ~((uintb)15);
+  if (start + code.size() > capacity) return (uint1 *)0;
+  uintb pagesize = sysconf(_SC_PAGESIZE);
+  uintb lo = start & ~(pagesize-1);
+  uintb hi = (start + code.size() + pagesize - 1) & ~(pagesize-1);
+  if (mprotect(base+lo,hi-lo,PROT_READ|PROT_WRITE) != 0) {
+    failed = true;
+    return (uint1 *)0;
+  }
+  memcpy(base+start,code.data(),code.size());
+  if (mprotect(base+lo,hi-lo,PROT_READ|PROT_EXEC) != 0) {
+    failed = true;		// Executable mappings are not allowed
+    return (uint1 *)0;
+  }
+  used = start + code.size();
+  return base + start;
+#else
+  return (uint1 *)0;
+#endif
+}
+
+/// Code installed before the reset must no longer be running.
+void JitCodeBuffer::reset(void)
+
+{
+  used = 0;
+  epoch += 1;
+}
+
+#ifdef CPUI_JIT_X86_64
+
+/// \brief Assembler for the x86-64 code generated by EmulateJit
+///
+/// Compiled code keeps the emulator in \b rbx. Operands are loaded into
+/// \b rax (input 0) and \b rcx (input 1), the result is left in \b rax, and
+/// \b rdx holds the address of the storage being accessed. Loads zero-extend,
+/// and stores write only the low bytes, so no masking is needed.
+class JitAssembler {
+  vector<uint1> &code;		///< Code being generated
+  vector<int4> labels;		///< Code offset of each op, plus the exit
+  vector<pair<int4,int4> > fixups; ///< (rel32 position, op index) of each jump
+  void imm32(uint4 val);
+  void imm64(uintb val);
+public:
+  enum {
+    rax = 0,			///< Input 0 and the result
+    rcx = 1			///< Input 1
+  };
+  JitAssembler(vector<uint1> &c,int4 numops) : code(c), labels(numops+1,-1) {}
+  void emit(uint1 val) { code.push_back(val); }	///< Emit one byte
+  void emit(uint1 a,uint1 b,uint1 c) { emit(a); emit(b); emit(c); } ///< Emit three bytes
+  void mark(int4 index) { labels[index] = code.size(); } ///< Label the code for an op
+  void prologue(void);
+  void loadOperand(const FastOperand &op,int4 reg);
+  void storeResult(const FastOperand &op);
+  void signExtend(int4 reg,int4 size);
+  void jump(int4 index);
+  void jumpNonzero(int4 index);
+  void exitWith(int4 val);
+  void callHandler(const FastOp *op,int4 index);
+  void finish(void);
+};
+
+void JitAssembler::imm32(uint4 val)
+
+{
+  for(int4 i=0;i<4;++i)
+    emit((uint1)(val >> (8*i)));
+}
+
+void JitAssembler::imm64(uintb val)
+
+{
+  for(int4 i=0;i<8;++i)
+    emit((uint1)(val >> (8*i)));
+}
+
+/// Save \b rbx and load it with the emulator. This also aligns the stack.
+void JitAssembler::prologue(void)
+
+{
+  emit(0x53);			// push rbx
+  emit(0x48,0x89,0xfb);		// mov rbx,rdi
+}
+
+/// \param op is the constant or directly addressed operand to load
+/// \param reg is the register to load
+void JitAssembler::loadOperand(const FastOperand &op,int4 reg)
+
+{
+  if (op.ptr == (uint1 *)0) {
+    if (op.offset <= 0xffffffff) {
+      emit(0xb8+reg);		// mov r32,imm32  (zero extends)
+      imm32((uint4)op.offset);
+    }
+    else {
+      emit(0x48); emit(0xb8+reg); // mov r64,imm64
+      imm64(op.offset);
+    }
+    return;
+  }
+  emit(0x48); emit(0xba);	// mov rdx,imm64
+  imm64((uintb)(uintp)op.ptr);
+  uint1 modrm = (reg<<3) | 2;	// [rdx]
+  switch(op.size) {
+  case 1:
+    emit(0x0f,0xb6,modrm);	// movzx r32,byte
+    break;
+  case 2:
+    emit(0x0f,0xb7,modrm);	// movzx r32,word
+    break;
+  case 4:
+    emit(0x8b); emit(modrm);	// mov r32
+    break;
+  default:
+    emit(0x48,0x8b,modrm);	// mov r64
+    break;
+  }
+}
+
+/// \param op is the directly addressed output
+void JitAssembler::storeResult(const FastOperand &op)
+
+{
+  emit(0x48); emit(0xba);	// mov rdx,imm64
+  imm64((uintb)(uintp)op.ptr);
+  switch(op.size) {
+  case 1:
+    emit(0x88); emit(0x02);	// mov [rdx],al
+    break;
+  case 2:
+    emit(0x66,0x89,0x02);	// mov [rdx],ax
+    break;
+  case 4:
+    emit(0x89); emit(0x02);	// mov [rdx],eax
+    break;
+  default:
+    emit(0x48,0x89,0x02);	// mov [rdx],rax
+    break;
+  }
+}
+
+/// \param reg is the register to extend in place
+/// \param size is the number of significant bytes in the register
+void JitAssembler::signExtend(int4 reg,int4 size)
+
+{
+  uint1 modrm = 0xc0 | (reg<<3) | reg;
+  switch(size) {
+  case 1:
+    emit(0x48); emit(0x0f,0xbe,modrm);	// movsx r64,r8
+    break;
+  case 2:
+    emit(0x48); emit(0x0f,0xbf,modrm);	// movsx r64,r16
+    break;
+  case 4:
+    emit(0x48,0x63,modrm);		// movsxd r64,r32
+    break;
+  default:
+    break;
+  }
+}
+
+/// \param index is the op to jump to
+void JitAssembler::jump(int4 index)
+
+{
+  emit(0xe9);
+  fixups.push_back(pair<int4,int4>(code.size(),index));
+  imm32(0);
+}
+
+/// \param index is the op to jump to if \b rax is nonzero
+void JitAssembler::jumpNonzero(int4 index)
+
+{
+  emit(0x48,0x85,0xc0);		// test rax,rax
+  emit(0x0f); emit(0x85);	// jnz rel32
+  fixups.push_back(pair<int4,int4>(code.size(),index));
+  imm32(0);
+}
+
+/// \param val is the value to return from the compiled code
+void JitAssembler::exitWith(int4 val)
+
+{
+  emit(0xb8);			// mov eax,imm32
+  imm32((uint4)val);
+  emit(0x5b);			// pop rbx
+  emit(0xc3);			// ret
+}
+
+/// The handler's result is returned from the compiled code unless it is
+/// the next op in sequence.
+/// \param op is the op to run
+/// \param index is the index of the op
+void JitAssembler::callHandler(const FastOp *op,int4 index)
+
+{
+  int4 (*helper)(EmulateJit *,const FastOp *,int4);
+  helper = EmulateJit::callHandler;
+  emit(0x48,0x89,0xdf);		// mov rdi,rbx
+  emit(0x48); emit(0xbe);	// mov rsi,imm64
+  imm64((uintb)(uintp)op);
+  emit(0xba);			// mov edx,imm32
+  imm32((uint4)index);
+  emit(0x48); emit(0xb8);	// mov rax,imm64
+  imm64((uintb)(uintp)helper);
+  emit(0xff); emit(0xd0);	// call rax
+  emit(0x3d);			// cmp eax,imm32
+  imm32((uint4)(index+1));
+  emit(0x74); emit(0x02);	// je over the return
+  emit(0x5b);			// pop rbx
+  emit(0xc3);			// ret
+}
+
+/// Resolve the jumps now that every op has its label
+void JitAssembler::finish(void)
+
+{
+  for(int4 i=0;i<fixups.size();++i) {
+    int4 pos = fixups[i].first;
+    int4 rel = labels[fixups[i].second] - (pos + 4);
+    for(int4 j=0;j<4;++j)
+      code[pos+j] = (uint1)(((uint4)rel) >> (8*j));
+  }
+}
+
+/// \param op is a decoded operand
+/// \return \b true if the operand is a constant or a register-sized direct access
+static bool isDirect(const FastOperand &op)
+
+{
+  if ((op.ptr == (uint1 *)0)&&(op.spc != (AddrSpace *)0))
+    return false;
+  return (op.size == 1 || op.size == 2 || op.size == 4 || op.size == 8);
+}
+
+/// \param opc is the opcode of an op that is neither special nor a branch
+/// \return \b true if the op has an inline translation
+static bool isInlineOpcode(OpCode opc)
+
+{
+  switch(opc) {
+  case CPUI_COPY:
+  case CPUI_INT_ZEXT:
+  case CPUI_INT_SEXT:
+  case CPUI_INT_2COMP:
+  case CPUI_INT_NEGATE:
+  case CPUI_BOOL_NEGATE:
+  case CPUI_INT_ADD:
+  case CPUI_INT_SUB:
+  case CPUI_INT_MULT:
+  case CPUI_INT_AND:
+  case CPUI_INT_OR:
+  case CPUI_INT_XOR:
+  case CPUI_BOOL_AND:
+  case CPUI_BOOL_OR:
+  case CPUI_BOOL_XOR:
+  case CPUI_INT_EQUAL:
+  case CPUI_INT_NOTEQUAL:
+  case CPUI_INT_LESS:
+  case CPUI_INT_LESSEQUAL:
+  case CPUI_INT_SLESS:
+  case CPUI_INT_SLESSEQUAL:
+  case CPUI_INT_CARRY:
+  case CPUI_INT_LEFT:
+  case CPUI_INT_RIGHT:
+  case CPUI_INT_SRIGHT:
+  case CPUI_PIECE:
+  case CPUI_SUBPIECE:
+    return true;
+  default:
+    break;
+  }
+  return false;
+}
+
+/// Ops the generated code cannot handle are left to their handler.
+/// \param as is the assembler
+/// \param op is the decoded op
+/// \return \b true if inline code was emitted
+static bool emitInline(JitAssembler &as,const FastOp &op)
+
+{
+  if (!op.resolved) return false;
+  OpCode opc = op.behave->getOpcode();
+  if (opc == CPUI_BRANCH) {
+    if (op.target < 0) return false;
+    as.jump(op.target);
+    return true;
+  }
+  if (opc == CPUI_CBRANCH) {
+    if ((op.target < 0)||(!isDirect(op.in[1]))) return false;
+    as.loadOperand(op.in[1],JitAssembler::rax);
+    as.jumpNonzero(op.target);
+    return true;
+  }
+  if (op.behave->isSpecial()) return false;
+  if (!isInlineOpcode(opc)) return false;
+  if ((op.out.ptr == (uint1 *)0)||(!isDirect(op.out))) return false;
+  if (!isDirect(op.in[0])) return false;
+  bool unary = op.behave->isUnary();
+  if (!unary && !isDirect(op.in[1])) return false;
+  if ((opc == CPUI_SUBPIECE)&&(op.in[1].ptr != (uint1 *)0)) return false;
+
+  as.loadOperand(op.in[0],JitAssembler::rax);
+  if (!unary && opc != CPUI_SUBPIECE)
+    as.loadOperand(op.in[1],JitAssembler::rcx);
+  switch(opc) {
+  case CPUI_COPY:
+  case CPUI_INT_ZEXT:
+    break;
+  case CPUI_INT_SEXT:
+    as.signExtend(JitAssembler::rax,op.in[0].size);
+    break;
+  case CPUI_INT_2COMP:
+    as.emit(0x48,0xf7,0xd8);	// neg rax
+    break;
+  case CPUI_INT_NEGATE:
+    as.emit(0x48,0xf7,0xd0);	// not rax
+    break;
+  case CPUI_BOOL_NEGATE:
+    as.emit(0x48,0x83,0xf0); as.emit(0x01); // xor rax,1
+    break;
+  case CPUI_INT_ADD:
+    as.emit(0x48,0x01,0xc8);	// add rax,rcx
+    break;
+  case CPUI_INT_SUB:
+    as.emit(0x48,0x29,0xc8);	// sub rax,rcx
+    break;
+  case CPUI_INT_MULT:
+    as.emit(0x48,0x0f,0xaf); as.emit(0xc1); // imul rax,rcx
+    break;
+  case CPUI_INT_AND:
+  case CPUI_BOOL_AND:
+    as.emit(0x48,0x21,0xc8);	// and rax,rcx
+    break;
+  case CPUI_INT_OR:
+  case CPUI_BOOL_OR:
+    as.emit(0x48,0x09,0xc8);	// or rax,rcx
+    break;
+  case CPUI_INT_XOR:
+  case CPUI_BOOL_XOR:
+    as.emit(0x48,0x31,0xc8);	// xor rax,rcx
+    break;
+  case CPUI_INT_EQUAL:
+  case CPUI_INT_NOTEQUAL:
+  case CPUI_INT_LESS:
+  case CPUI_INT_LESSEQUAL:
+  case CPUI_INT_SLESS:
+  case CPUI_INT_SLESSEQUAL:
+    {
+      uint1 cc;
+      switch(opc) {
+      case CPUI_INT_EQUAL:	cc = 0x94; break; // sete
+      case CPUI_INT_NOTEQUAL:	cc = 0x95; break; // setne
+      case CPUI_INT_LESS:	cc = 0x92; break; // setb
+      case CPUI_INT_LESSEQUAL:	cc = 0x96; break; // setbe
+      case CPUI_INT_SLESS:	cc = 0x9c; break; // setl
+      default:			cc = 0x9e; break; // setle
+      }
+      if ((opc == CPUI_INT_SLESS)||(opc == CPUI_INT_SLESSEQUAL)) {
+	as.signExtend(JitAssembler::rax,op.in[0].size);
+	as.signExtend(JitAssembler::rcx,op.in[1].size);
+      }
+      as.emit(0x48,0x39,0xc8);	// cmp rax,rcx
+      as.emit(0x0f,cc,0xc0);	// setcc al
+      as.emit(0x0f,0xb6,0xc0);	// movzx eax,al
+    }
+    break;
+  case CPUI_INT_CARRY:
+    as.emit(0x48,0x01,0xc8);	// add rax,rcx
+    if (op.in[0].size < 8) {
+      as.emit(0x48,0xc1,0xe8); as.emit(8*op.in[0].size); // shr rax,imm8
+    }
+    else {
+      as.emit(0x0f,0x92,0xc0);	// setb al
+      as.emit(0x0f,0xb6,0xc0);	// movzx eax,al
+    }
+    break;
+  case CPUI_INT_LEFT:		// The host masks the count, so counts past
+  case CPUI_INT_RIGHT:		// the width are made to give 0 explicitly
+    as.emit(0x48,0xd3,(opc == CPUI_INT_LEFT) ? 0xe0 : 0xe8); // shl/shr rax,cl
+    as.emit(0x31); as.emit(0xd2); // xor edx,edx
+    as.emit(0x48,0x83,0xf9); as.emit(8*op.in[0].size); // cmp rcx,imm8
+    as.emit(0x48,0x0f,0x43); as.emit(0xc2); // cmovae rax,rdx
+    break;
+  case CPUI_INT_SRIGHT:		// and counts past the width fill with the sign
+    as.signExtend(JitAssembler::rax,op.in[0].size);
+    as.emit(0xba); as.emit(63); as.emit(0,0,0); // mov edx,63
+    as.emit(0x48,0x83,0xf9); as.emit(8*op.in[0].size); // cmp rcx,imm8
+    as.emit(0x48,0x0f,0x43); as.emit(0xca); // cmovae rcx,rdx
+    as.emit(0x48,0xd3,0xf8);	// sar rax,cl
+    break;
+  case CPUI_PIECE:
+    as.emit(0x48,0xc1,0xe0); as.emit(8*op.in[1].size); // shl rax,imm8
+    as.emit(0x48,0x09,0xc8);	// or rax,rcx
+    break;
+  case CPUI_SUBPIECE:
+    if (op.in[1].offset < 8) {
+      as.emit(0x48,0xc1,0xe8); as.emit(8*op.in[1].offset); // shr rax,imm8
+    }
+    else {
+      as.emit(0x31); as.emit(0xc0); // xor eax,eax
+    }
+    break;
+  default:
+    break;
+  }
+  as.storeResult(op.out);
+  return true;
+}
+
+#endif
+
+/// \param t is the SLEIGH translator
+/// \param s is the MemoryState the emulator should manipulate
+/// \param b is the table of breakpoints the emulator should invoke
+EmulateJit::EmulateJit(Translate *t,MemoryState *s,BreakTable *b)
+  : EmulateFast(t,s,b), buffer(16*1024*1024)
+{
+  threshold = 16;
+  differential = false;
+  depth = 0;
+}
+
+/// \return \b true if this build can generate code for the host
+bool EmulateJit::isSupported(void)
+
+{
+#ifdef CPUI_JIT_X86_64
+  return true;
+#else
+  return false;
+#endif
+}
+
+/// \param addr is the address of the instruction
+/// \return a new JitInstruction
+CachedInstruction *EmulateJit::newInstruction(const Address &addr)
+
+{
+  return new JitInstruction(addr);
+}
+
+/// Exceptions cannot unwind through generated code, so anything thrown by the
+/// handler is parked in \e pending and rethrown once the code has returned.
+/// A fallback op that simply moved on to the next op in the same instruction
+/// lets the compiled code continue.
+/// \param emu is the emulator
+/// \param op is the op to run
+/// \param index is the index of the op
+/// \return the index of the next op or a leave code
+int4 EmulateJit::callHandler(EmulateJit *emu,const FastOp *op,int4 index)
+
+{
+  int4 res;
+  try {
+    res = op->handler(*emu,*op,index);
+  } catch(...) {
+    emu->pending = std::current_exception();
+    return jit_error;
+  }
+  if ((res == FastOp::leave_resync)&&(!emu->instruction_start)&&(emu->current_op == index+1))
+    return index + 1;
+  return res;
+}
+
+/// Instructions with no op worth compiling inline are rejected, as the
+/// interpreter runs them just as fast.
+/// \param insn is the decoded instruction
+/// \return \b true if code was installed
+bool EmulateJit::compile(JitInstruction *insn)
+
+{
+#ifdef CPUI_JIT_X86_64
+  const vector<FastOp> &ops( insn->fastops );
+  int4 num = ops.size();
+  vector<uint1> code;
+  JitAssembler as(code,num);
+  int4 numinline = 0;
+  as.prologue();
+  for(int4 i=0;i<num;++i) {
+    as.mark(i);
+    if (emitInline(as,ops[i]))
+      numinline += 1;
+    else
+      as.callHandler(&ops[i],i);
+  }
+  as.mark(num);
+  as.exitWith(num);
+  as.finish();
+  if (numinline == 0) return false;
+  uint1 *res = buffer.install(code);
+  if ((res == (uint1 *)0)&&(depth == 0)&&(!buffer.isFailed())) {
+    buffer.reset();		// Full, and nothing compiled is running
+    res = buffer.install(code);
+  }
+  if (res == (uint1 *)0) return false;
+  insn->code = (JitCode)res;
+  insn->epoch = buffer.getEpoch();
+  insn->pure = (numinline == num);
+  return true;
+#else
+  return false;
+#endif
+}
+
+/// \param insn is the instruction about to start
+/// \return its compiled code, or \b null if it should be interpreted
+JitCode EmulateJit::lookupCode(JitInstruction *insn)
+
+{
+  if ((insn->code != (JitCode)0)&&(insn->epoch == buffer.getEpoch()))
+    return insn->code;
+  if (insn->rejected) return (JitCode)0;
+  insn->hits += 1;
+  if (insn->hits < threshold) return (JitCode)0;
+  if (!insn->decoded)
+    decode(insn);
+  if (!compile(insn)) {
+    insn->rejected = true;
+    return (JitCode)0;
+  }
+  return insn->code;
+}
+
+/// \param code is the compiled instruction to run
+/// \return the code's exit value
+int4 EmulateJit::runCode(JitCode code)
+
+{
+  depth += 1;
+  int4 res = code(this);
+  depth -= 1;
+  if (res == jit_error) {
+    std::exception_ptr err = pending;
+    pending = std::exception_ptr();
+    std::rethrow_exception(err);
+  }
+  return res;
+}
+
+/// The instruction only touches its outputs, all of which live in flat banks.
+/// They are saved, the interpreter runs, its outputs are recorded, and the
+/// originals are put back before the compiled code runs.
+/// \param insn is the instruction, compiled entirely inline
+/// \param code is its compiled form
+/// \return the code's exit value
+int4 EmulateJit::runChecked(JitInstruction *insn,JitCode code)
+
+{
+  const vector<FastOp> &ops( insn->fastops );
+  int4 num = ops.size();
+  vector<uint1> before,expect,actual;
+  for(int4 i=0;i<num;++i) {
+    const FastOperand &out( ops[i].out );
+    if (ops[i].behave->isSpecial()) continue;
+    before.insert(before.end(),out.ptr,out.ptr+out.size);
+  }
+  int4 i = 0;
+  while((i >= 0)&&(i < num))
+    i = ops[i].handler(*this,ops[i],i);
+  for(int4 j=0;j<num;++j) {
+    const FastOperand &out( ops[j].out );
+    if (ops[j].behave->isSpecial()) continue;
+    expect.insert(expect.end(),out.ptr,out.ptr+out.size);
+  }
+  int4 pos = before.size();
+  for(int4 j=num-1;j>=0;--j) {
+    const FastOperand &out( ops[j].out );
+    if (ops[j].behave->isSpecial()) continue;
+    pos -= out.size;
+    memcpy(out.ptr,before.data()+pos,out.size);
+  }
+  int4 res = runCode(code);
+  for(int4 j=0;j<num;++j) {
+    const FastOperand &out( ops[j].out );
+    if (ops[j].behave->isSpecial()) continue;
+    actual.insert(actual.end(),out.ptr,out.ptr+out.size);
+  }
+  if ((res != i)||(actual != expect)) {
+    ostringstream s;
+    s << "Compiled code differs from the interpreter at ";
+    insn->addr.printRaw(s);
+    throw LowlevelError(s.str());
+  }
+  return res;
+}
+
+/// Address breakpoints are checked at the start of an instruction, and its
+/// compiled code runs if it has any. Execution continues in the interpreter
+/// if the code stopped in the middle of the instruction.
+void EmulateJit::executeInstruction(void)
+
+{
+  if (instruction_start) {
+    if (breaktable->doAddressBreak(current_address))
+      return;
+    JitInstruction *insn = (JitInstruction *)current;
+    JitCode code = lookupCode(insn);
+    if (code != (JitCode)0) {
+      int4 i = (differential && insn->pure) ? runChecked(insn,code) : runCode(code);
+      int4 num = insn->fastops.size();
+      if (i == num) {		// Fell off the end of the instruction
+	current_op = num - 1;
+	fallthruOp();
+	return;
+      }
+      if (i == FastOp::leave_branch)
+	return;
+      if (i == FastOp::leave_resync) {
+	if (instruction_start)
+	  return;
+      }
+      else {			// Resume at an op the handler picked
+	current_op = i;
+	instruction_start = false;
+	establishOp();
+      }
+    }
+  }
+  runInstruction();
+}
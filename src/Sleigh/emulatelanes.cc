@@ -0,0 +1,701 @@
+/*
+ * Copyright 2020 Joe Staursky
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "emulatelanes.hh"
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+/// Lanes are taken four at a time, one 64-bit value per vector element.
+/// \return the number of lanes read, the rest are left to the caller
+__attribute__ ((target ("avx2"))) static int4 getValuesAvx2(const uint1 *ptr,int4 numlanes,int4 sz,bool bigendian,uintb *res)
+
+{
+  int4 l = 0;
+  for(;l+4<=numlanes;l+=4) {
+    __m256i acc = _mm256_setzero_si256();
+    for(int4 i=0;i<sz;++i) {	// Most significant byte first
+      uint4 bytes;
+      memcpy(&bytes,ptr + numlanes * (bigendian ? i : sz-1-i) + l,4);
+      __m256i wide = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(bytes));
+      acc = _mm256_or_si256(_mm256_slli_epi64(acc,8),wide);
+    }
+    _mm256_storeu_si256((__m256i *)(res + l),acc);
+  }
+  return l;
+}
+
+/// Four values are transposed at once, giving byte \e i of each as one
+/// 32-bit word, which is merged into plane \e i under the mask.
+/// \return the number of lanes written, the rest are left to the caller
+__attribute__ ((target ("avx2"))) static int4 setValuesAvx2(uint1 *ptr,int4 numlanes,int4 sz,bool bigendian,
+							   const uintb *vals,const uint1 *mask)
+{
+  const __m256i order = _mm256_setr_epi8(0,8,1,9,2,10,3,11,4,12,5,13,6,14,7,15,
+					 0,8,1,9,2,10,3,11,4,12,5,13,6,14,7,15);
+  int4 l = 0;
+  for(;l+4<=numlanes;l+=4) {
+    __m256i v = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(vals + l)),order);
+    __m128i lo = _mm256_castsi256_si128(v);	// Byte pairs of lanes l and l+1
+    __m128i hi = _mm256_extracti128_si256(v,1);	// Byte pairs of lanes l+2 and l+3
+    uint4 planes[8];
+    _mm_storeu_si128((__m128i *)planes,_mm_unpacklo_epi16(lo,hi));
+    _mm_storeu_si128((__m128i *)(planes + 4),_mm_unpackhi_epi16(lo,hi));
+    uint4 sel;
+    memcpy(&sel,mask + l,4);
+    uint4 keep = _mm_cvtsi128_si32(_mm_cmpeq_epi8(_mm_cvtsi32_si128(sel),_mm_setzero_si128()));
+    for(int4 i=0;i<sz;++i) {
+      uint1 *plane = ptr + numlanes * (bigendian ? sz-1-i : i) + l;
+      uint4 old;
+      memcpy(&old,plane,4);
+      old = (old & keep) | (planes[i] & ~keep);
+      memcpy(plane,&old,4);
+    }
+  }
+  return l;
+}
+
+/// \return the number of lanes computed, or 0 if the op has no vector form
+__attribute__ ((target ("avx2"))) static int4 unaryAvx2(OpCode opc,const uintb *a,uintb *r,int4 n,uintb mask)
+
+{
+  __m256i m = _mm256_set1_epi64x(mask);
+  __m256i one = _mm256_set1_epi64x(1);
+  __m256i zero = _mm256_setzero_si256();
+  int4 l = 0;
+  for(;l+4<=n;l+=4) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(a + l));
+    __m256i z;
+    switch(opc) {
+    case CPUI_COPY:
+    case CPUI_INT_ZEXT:
+      z = x;
+      break;
+    case CPUI_INT_2COMP:
+      z = _mm256_and_si256(_mm256_sub_epi64(zero,x),m);
+      break;
+    case CPUI_INT_NEGATE:
+      z = _mm256_andnot_si256(x,m);
+      break;
+    case CPUI_BOOL_NEGATE:
+      z = _mm256_xor_si256(x,one);
+      break;
+    default:
+      return 0;
+    }
+    _mm256_storeu_si256((__m256i *)(r + l),z);
+  }
+  return l;
+}
+
+/// The variable shifts give 0 for counts of 64 or more, and inputs are
+/// never wider than the output for INT_LEFT and INT_RIGHT, so counts past
+/// the width need no check. Unsigned compares flip the sign bits and use
+/// the signed compare.
+/// \return the number of lanes computed, or 0 if the op has no vector form
+__attribute__ ((target ("avx2"))) static int4 binaryAvx2(OpCode opc,const uintb *a,const uintb *b,uintb *r,
+							int4 n,uintb mask)
+{
+  __m256i m = _mm256_set1_epi64x(mask);
+  __m256i one = _mm256_set1_epi64x(1);
+  __m256i sign = _mm256_set1_epi64x((int64_t)0x8000000000000000ULL);
+  int4 l = 0;
+  for(;l+4<=n;l+=4) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(a + l));
+    __m256i y = _mm256_loadu_si256((const __m256i *)(b + l));
+    __m256i z;
+    switch(opc) {
+    case CPUI_INT_ADD:
+      z = _mm256_and_si256(_mm256_add_epi64(x,y),m);
+      break;
+    case CPUI_INT_SUB:
+      z = _mm256_and_si256(_mm256_sub_epi64(x,y),m);
+      break;
+    case CPUI_INT_AND:
+    case CPUI_BOOL_AND:
+      z = _mm256_and_si256(x,y);
+      break;
+    case CPUI_INT_OR:
+    case CPUI_BOOL_OR:
+      z = _mm256_or_si256(x,y);
+      break;
+    case CPUI_INT_XOR:
+    case CPUI_BOOL_XOR:
+      z = _mm256_xor_si256(x,y);
+      break;
+    case CPUI_INT_EQUAL:
+      z = _mm256_srli_epi64(_mm256_cmpeq_epi64(x,y),63);
+      break;
+    case CPUI_INT_NOTEQUAL:
+      z = _mm256_xor_si256(_mm256_srli_epi64(_mm256_cmpeq_epi64(x,y),63),one);
+      break;
+    case CPUI_INT_LESS:
+      z = _mm256_srli_epi64(_mm256_cmpgt_epi64(_mm256_xor_si256(y,sign),_mm256_xor_si256(x,sign)),63);
+      break;
+    case CPUI_INT_LESSEQUAL:
+      z = _mm256_cmpgt_epi64(_mm256_xor_si256(x,sign),_mm256_xor_si256(y,sign));
+      z = _mm256_xor_si256(_mm256_srli_epi64(z,63),one);
+      break;
+    case CPUI_INT_LEFT:
+      z = _mm256_and_si256(_mm256_sllv_epi64(x,y),m);
+      break;
+    case CPUI_INT_RIGHT:
+      z = _mm256_srlv_epi64(x,y);
+      break;
+    default:
+      return 0;
+    }
+    _mm256_storeu_si256((__m256i *)(r + l),z);
+  }
+  return l;
+}
+
+/// \return \b true if the vector paths can be used on this host
+static bool useAvx2(void)
+
+{
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+}
+#else
+static int4 getValuesAvx2(const uint1 *ptr,int4 numlanes,int4 sz,bool bigendian,uintb *res) { return 0; }
+static int4 setValuesAvx2(uint1 *ptr,int4 numlanes,int4 sz,bool bigendian,const uintb *vals,const uint1 *mask) { return 0; }
+static int4 unaryAvx2(OpCode opc,const uintb *a,uintb *r,int4 n,uintb mask) { return 0; }
+static int4 binaryAvx2(OpCode opc,const uintb *a,const uintb *b,uintb *r,int4 n,uintb mask) { return 0; }
+static bool useAvx2(void) { return false; }
+#endif
+
+/// Every lane starts out zeroed.
+/// \param spc is the space being held
+/// \param lanes is the number of lanes
+/// \param sz is the number of bytes of the space to hold, starting at offset 0
+LaneBank::LaneBank(AddrSpace *spc,int4 lanes,uintb sz)
+  : data(sz*lanes,0)
+{
+  space = spc;
+  numlanes = lanes;
+  size = sz;
+}
+
+/// \param offset is the start of the value
+/// \param sz is the number of bytes in the value
+/// \param res receives one value per lane
+void LaneBank::getValues(uintb offset,int4 sz,uintb *res) const
+
+{
+  const uint1 *ptr = data.data() + offset*numlanes;
+  int4 done = useAvx2() ? getValuesAvx2(ptr,numlanes,sz,space->isBigEndian(),res) : 0;
+  for(int4 l=done;l<numlanes;++l)
+    res[l] = 0;
+  for(int4 i=0;i<sz;++i) {	// Most significant byte first
+    const uint1 *plane = ptr + numlanes * (space->isBigEndian() ? i : sz-1-i);
+    for(int4 l=done;l<numlanes;++l)
+      res[l] = (res[l] << 8) | plane[l];
+  }
+}
+
+/// \param offset is the start of the value
+/// \param sz is the number of bytes in the value
+/// \param vals holds one value per lane
+/// \param mask is nonzero for each lane to be written
+void LaneBank::setValues(uintb offset,int4 sz,const uintb *vals,const uint1 *mask)
+
+{
+  uint1 *ptr = data.data() + offset*numlanes;
+  int4 done = useAvx2() ? setValuesAvx2(ptr,numlanes,sz,space->isBigEndian(),vals,mask) : 0;
+  for(int4 i=0;i<sz;++i) {
+    uint1 *plane = ptr + numlanes * (space->isBigEndian() ? sz-1-i : i);
+    int4 shift = 8*i;
+    for(int4 l=done;l<numlanes;++l)
+      plane[l] = mask[l] ? (uint1)(vals[l] >> shift) : plane[l];
+  }
+}
+
+/// \param lane is the lane to read
+/// \param offset is the start of the value
+/// \param sz is the number of bytes in the value
+/// \return the value
+uintb LaneBank::getValue(int4 lane,uintb offset,int4 sz) const
+
+{
+  const uint1 *ptr = data.data() + offset*numlanes + lane;
+  uintb res = 0;
+  for(int4 i=0;i<sz;++i)
+    res = (res << 8) | ptr[numlanes * (space->isBigEndian() ? i : sz-1-i)];
+  return res;
+}
+
+/// \param lane is the lane to write
+/// \param offset is the start of the value
+/// \param sz is the number of bytes in the value
+/// \param val is the value to write
+void LaneBank::setValue(int4 lane,uintb offset,int4 sz,uintb val)
+
+{
+  uint1 *ptr = data.data() + offset*numlanes + lane;
+  for(int4 i=0;i<sz;++i)
+    ptr[numlanes * (space->isBigEndian() ? sz-1-i : i)] = (uint1)(val >> (8*i));
+}
+
+/// \param t is the SLEIGH translator
+/// \param s holds the spaces shared by every lane
+/// \param lanes is the number of lanes
+EmulateLanes::EmulateLanes(Translate *t,MemoryState *s,int4 lanes)
+  : banks(t->numSpaces(),(LaneBank *)0), status(lanes,lane_stopped), opindex(lanes,-1),
+    select(lanes,0), in0(lanes,0), in1(lanes,0), res(lanes,0)
+{
+  trans = t;
+  memstate = s;
+  numlanes = lanes;
+  OpBehavior::registerInstructions(inst,t);
+  pc.resize(lanes,Address());
+}
+
+EmulateLanes::~EmulateLanes(void)
+
+{
+  map<Address,CachedInstruction *>::iterator iter;
+  for(iter=translations.begin();iter!=translations.end();++iter)
+    delete (*iter).second;
+  for(int4 i=0;i<banks.size();++i)
+    if (banks[i] != (LaneBank *)0)
+      delete banks[i];
+  for(int4 i=0;i<inst.size();++i)
+    if (inst[i] != (OpBehavior *)0)
+      delete inst[i];
+}
+
+/// Values in the space are no longer shared: each lane reads and writes its
+/// own copy of bytes [0,size). Accesses outside that range are errors.
+/// \param spc is the space to replicate
+/// \param size is the number of bytes to hold per lane
+/// \return the new storage, owned by the emulator
+LaneBank *EmulateLanes::addLaneBank(AddrSpace *spc,uintb size)
+
+{
+  int4 index = spc->getIndex();
+  if (banks[index] != (LaneBank *)0)
+    delete banks[index];
+  banks[index] = new LaneBank(spc,numlanes,size);
+  return banks[index];
+}
+
+/// \param spc is the space to look up
+/// \return the lane storage, or \b null if the space is shared
+LaneBank *EmulateLanes::getLaneBank(AddrSpace *spc) const
+
+{
+  return banks[spc->getIndex()];
+}
+
+/// \param addr is the address where lanes stop
+void EmulateLanes::addStop(const Address &addr)
+
+{
+  stops.insert(addr);
+}
+
+/// Every lane is made runnable, unless it starts at a stop address.
+/// \param addr is the address where each lane starts
+void EmulateLanes::setExecuteAddress(const Address &addr)
+
+{
+  int4 st = (stops.find(addr) != stops.end()) ? lane_stopped : lane_running;
+  for(int4 l=0;l<numlanes;++l) {
+    pc[l] = addr;
+    status[l] = st;
+  }
+}
+
+/// \param addr is the address of the instruction
+/// \return the cached translation
+CachedInstruction *EmulateLanes::translate(const Address &addr)
+
+{
+  map<Address,CachedInstruction *>::iterator iter = translations.find(addr);
+  if (iter != translations.end())
+    return (*iter).second;
+  CachedInstruction *insn = new CachedInstruction(addr);
+  PcodeEmitCache emit(insn->ops,insn->vars,inst,0);
+  try {
+    insn->length = trans->oneInstruction(emit,addr);
+  } catch(...) {
+    delete insn;
+    throw;
+  }
+  translations[addr] = insn;
+  return insn;
+}
+
+/// \param vn is the varnode to read
+/// \param vals receives one value per lane
+void EmulateLanes::readOperand(const VarnodeData *vn,uintb *vals) const
+
+{
+  uintb val;
+  if (vn->space->getType() == IPTR_CONSTANT)
+    val = vn->offset;
+  else {
+    LaneBank *bank = banks[vn->space->getIndex()];
+    if (bank != (LaneBank *)0) {
+      if (!bank->contains(vn->offset,vn->size))
+	throw LowlevelError("Access outside lane storage in " + vn->space->getName());
+      bank->getValues(vn->offset,vn->size,vals);
+      return;
+    }
+    val = memstate->getValue(vn->space,vn->offset,vn->size);
+  }
+  for(int4 l=0;l<numlanes;++l)
+    vals[l] = val;
+}
+
+/// \param vn is the varnode to write
+/// \param vals holds one value per lane
+/// \param mask is nonzero for each lane to be written
+void EmulateLanes::writeOperand(const VarnodeData *vn,const uintb *vals,const uint1 *mask)
+
+{
+  LaneBank *bank = banks[vn->space->getIndex()];
+  if (bank == (LaneBank *)0)
+    throw LowlevelError("Write to shared space " + vn->space->getName() + " in lane emulation");
+  if (!bank->contains(vn->offset,vn->size))
+    throw LowlevelError("Access outside lane storage in " + vn->space->getName());
+  bank->setValues(vn->offset,vn->size,vals,mask);
+}
+
+/// The common ops are computed for every lane with a plain loop; anything
+/// else goes through the OpBehavior for the selected lanes only, as it may
+/// throw on values held by lanes that are not executing.
+/// \param behave is the behavior of the op
+/// \param op is the op
+void EmulateLanes::executeUnary(OpBehavior *behave,const PcodeOpRaw *op)
+
+{
+  const VarnodeData *outvn = op->getOutput();
+  const VarnodeData *invn = op->getInput(0);
+  int4 n = numlanes;
+  uintb mask = calc_mask(outvn->size);
+  readOperand(invn,in0.data());
+  uintb *a = in0.data();
+  uintb *r = res.data();
+  int4 done = useAvx2() ? unaryAvx2(behave->getOpcode(),a,r,n,mask) : 0;
+  switch(behave->getOpcode()) {
+  case CPUI_COPY:
+  case CPUI_INT_ZEXT:
+    for(int4 l=done;l<n;++l) r[l] = a[l];
+    break;
+  case CPUI_INT_SEXT:
+    {
+      int4 sa = 8*(sizeof(uintb)-invn->size);
+      for(int4 l=done;l<n;++l) r[l] = (uintb)(((intb)(a[l] << sa)) >> sa) & mask;
+    }
+    break;
+  case CPUI_INT_2COMP:
+    for(int4 l=done;l<n;++l) r[l] = (0 - a[l]) & mask;
+    break;
+  case CPUI_INT_NEGATE:
+    for(int4 l=done;l<n;++l) r[l] = ~a[l] & mask;
+    break;
+  case CPUI_BOOL_NEGATE:
+    for(int4 l=done;l<n;++l) r[l] = a[l] ^ 1;
+    break;
+  default:
+    for(int4 l=done;l<n;++l)
+      if (select[l])
+	r[l] = behave->evaluateUnary(outvn->size,invn->size,a[l]);
+    break;
+  }
+  writeOperand(outvn,r,select.data());
+}
+
+/// Shift amounts of at least the input size give the result p-code defines
+/// (zero, or all sign bits), which agrees with OpBehavior for any amount the
+/// host can shift by.
+/// \param behave is the behavior of the op
+/// \param op is the op
+void EmulateLanes::executeBinary(OpBehavior *behave,const PcodeOpRaw *op)
+
+{
+  const VarnodeData *outvn = op->getOutput();
+  int4 insize = op->getInput(0)->size;
+  int4 n = numlanes;
+  uintb mask = calc_mask(outvn->size);
+  readOperand(op->getInput(0),in0.data());
+  readOperand(op->getInput(1),in1.data());
+  uintb *a = in0.data();
+  uintb *b = in1.data();
+  uintb *r = res.data();
+  int4 sa = 8*(sizeof(uintb)-insize);
+  int4 done = useAvx2() ? binaryAvx2(behave->getOpcode(),a,b,r,n,mask) : 0;
+  switch(behave->getOpcode()) {
+  case CPUI_INT_ADD:
+    for(int4 l=done;l<n;++l) r[l] = (a[l] + b[l]) & mask;
+    break;
+  case CPUI_INT_SUB:
+    for(int4 l=done;l<n;++l) r[l] = (a[l] - b[l]) & mask;
+    break;
+  case CPUI_INT_MULT:
+    for(int4 l=done;l<n;++l) r[l] = (a[l] * b[l]) & mask;
+    break;
+  case CPUI_INT_AND:
+  case CPUI_BOOL_AND:
+    for(int4 l=done;l<n;++l) r[l] = a[l] & b[l];
+    break;
+  case CPUI_INT_OR:
+  case CPUI_BOOL_OR:
+    for(int4 l=done;l<n;++l) r[l] = a[l] | b[l];
+    break;
+  case CPUI_INT_XOR:
+  case CPUI_BOOL_XOR:
+    for(int4 l=done;l<n;++l) r[l] = a[l] ^ b[l];
+    break;
+  case CPUI_INT_EQUAL:
+    for(int4 l=done;l<n;++l) r[l] = (a[l] == b[l]) ? 1 : 0;
+    break;
+  case CPUI_INT_NOTEQUAL:
+    for(int4 l=done;l<n;++l) r[l] = (a[l] != b[l]) ? 1 : 0;
+    break;
+  case CPUI_INT_LESS:
+    for(int4 l=done;l<n;++l) r[l] = (a[l] < b[l]) ? 1 : 0;
+    break;
+  case CPUI_INT_LESSEQUAL:
+    for(int4 l=done;l<n;++l) r[l] = (a[l] <= b[l]) ? 1 : 0;
+    break;
+  case CPUI_INT_SLESS:
+    for(int4 l=done;l<n;++l) r[l] = (((intb)(a[l] << sa)) < ((intb)(b[l] << sa))) ? 1 : 0;
+    break;
+  case CPUI_INT_SLESSEQUAL:
+    for(int4 l=done;l<n;++l) r[l] = (((intb)(a[l] << sa)) <= ((intb)(b[l] << sa))) ? 1 : 0;
+    break;
+  case CPUI_INT_CARRY:
+    {
+      uintb inmask = calc_mask(insize);
+      for(int4 l=done;l<n;++l) r[l] = (a[l] > ((a[l] + b[l]) & inmask)) ? 1 : 0;
+    }
+    break;
+  case CPUI_INT_LEFT:
+    for(int4 l=done;l<n;++l) r[l] = (b[l] < 8*insize) ? ((a[l] << b[l]) & mask) : 0;
+    break;
+  case CPUI_INT_RIGHT:
+    for(int4 l=done;l<n;++l) r[l] = (b[l] < 8*insize) ? (a[l] >> b[l]) : 0;
+    break;
+  case CPUI_INT_SRIGHT:
+    for(int4 l=done;l<n;++l) {
+      uintb s = (b[l] < 8*insize) ? b[l] : 8*insize - 1;
+      r[l] = (uintb)((((intb)(a[l] << sa)) >> sa) >> s) & mask;
+    }
+    break;
+  case CPUI_PIECE:
+    {
+      int4 shift = 8*op->getInput(1)->size;
+      for(int4 l=done;l<n;++l) r[l] = (a[l] << shift) | b[l];
+    }
+    break;
+  case CPUI_SUBPIECE:
+    {
+      uintb shift = 8*op->getInput(1)->offset;
+      for(int4 l=done;l<n;++l) r[l] = (shift < 64) ? ((a[l] >> shift) & mask) : 0;
+    }
+    break;
+  default:
+    for(int4 l=done;l<n;++l)
+      if (select[l])
+	r[l] = behave->evaluateBinary(outvn->size,insize,a[l],b[l]);
+    break;
+  }
+  writeOperand(outvn,r,select.data());
+}
+
+/// Addresses differ from lane to lane, so each selected lane is handled on its own.
+/// \param op is the LOAD or STORE
+/// \param isload is \b true for a LOAD
+void EmulateLanes::executeMemory(const PcodeOpRaw *op,bool isload)
+
+{
+  AddrSpace *spc = Address::getSpaceFromConst(op->getInput(0)->getAddr());
+  LaneBank *bank = banks[spc->getIndex()];
+  readOperand(op->getInput(1),in0.data());
+  int4 size;
+  if (isload)
+    size = op->getOutput()->size;
+  else {
+    size = op->getInput(2)->size;
+    readOperand(op->getInput(2),in1.data());
+    if (bank == (LaneBank *)0)
+      throw LowlevelError("Write to shared space " + spc->getName() + " in lane emulation");
+  }
+  for(int4 l=0;l<numlanes;++l) {
+    if (!select[l]) continue;
+    uintb off = AddrSpace::addressToByte(in0[l],spc->getWordSize());
+    if (bank == (LaneBank *)0) {
+      res[l] = memstate->getValue(spc,off,size);
+      continue;
+    }
+    if (!bank->contains(off,size))
+      throw LowlevelError("Access outside lane storage in " + spc->getName());
+    if (isload)
+      res[l] = bank->getValue(l,off,size);
+    else
+      bank->setValue(l,off,size,in1[l]);
+  }
+  if (isload)
+    writeOperand(op->getOutput(),res.data(),select.data());
+}
+
+/// Each selected lane's op index is advanced, moved to a branch target within
+/// the instruction, or set past the end (\e num + 1) once the lane has a new
+/// address.
+/// \param op is the op to execute
+/// \param index is the index of the op in its instruction
+/// \param num is the number of ops in the instruction
+/// \return \b true if lanes may no longer all be at the next op
+bool EmulateLanes::executeOp(const PcodeOpRaw *op,int4 index,int4 num)
+
+{
+  OpBehavior *behave = op->getBehavior();
+  if (behave == (OpBehavior *)0)
+    throw LowlevelError("Unimplemented pcode operation");
+  OpCode opc = behave->getOpcode();
+  switch(opc) {
+  case CPUI_LOAD:
+  case CPUI_STORE:
+    executeMemory(op,opc == CPUI_LOAD);
+    break;
+  case CPUI_BRANCH:
+  case CPUI_CBRANCH:
+  case CPUI_CALL:
+    {
+      const VarnodeData *destvn = op->getInput(0);
+      int4 target = num + 1;
+      if ((opc != CPUI_CALL)&&(destvn->space->getType() == IPTR_CONSTANT)) {
+	intb rel = (intb)destvn->offset;
+	sign_extend(rel,8*destvn->size-1);
+	if ((index + rel < 0)||(index + rel > num))
+	  throw LowlevelError("Bad intra-instruction branch");
+	target = index + rel;
+      }
+      Address dest = destvn->getAddr();
+      if (opc == CPUI_CBRANCH)
+	readOperand(op->getInput(1),in0.data());
+      for(int4 l=0;l<numlanes;++l) {
+	if (!select[l]) continue;
+	if ((opc == CPUI_CBRANCH)&&(in0[l] == 0)) {
+	  opindex[l] = index + 1;
+	  continue;
+	}
+	opindex[l] = target;
+	if (target > num)
+	  pc[l] = dest;
+      }
+    }
+    return true;
+  case CPUI_BRANCHIND:
+  case CPUI_CALLIND:
+  case CPUI_RETURN:
+    readOperand(op->getInput(0),in0.data());
+    for(int4 l=0;l<numlanes;++l) {
+      if (!select[l]) continue;
+      pc[l] = Address(op->getAddr().getSpace(),in0[l]);
+      opindex[l] = num + 1;
+    }
+    return true;
+  case CPUI_CALLOTHER:
+    for(int4 l=0;l<numlanes;++l) {
+      if (!select[l]) continue;
+      status[l] = lane_userop;
+      opindex[l] = -1;
+    }
+    return true;
+  default:
+    if (behave->isSpecial())
+      throw LowlevelError("Unsupported pcode operation in lane emulation");
+    if ((op->getOutput()->size > sizeof(uintb))||(op->getInput(0)->size > sizeof(uintb)))
+      throw LowlevelError("Wide pcode operation in lane emulation");
+    if (behave->isUnary())
+      executeUnary(behave,op);
+    else
+      executeBinary(behave,op);
+    break;
+  }
+  for(int4 l=0;l<numlanes;++l)
+    if (select[l])
+      opindex[l] = index + 1;
+  return false;
+}
+
+/// Every running lane at the instruction's address takes part. Until the
+/// first branch the lanes move in lock step. After that, the op with the
+/// lowest index still pending in some lane is executed for all lanes waiting
+/// on it, until every lane has run off the end or branched away.
+/// \param insn is the instruction to execute
+void EmulateLanes::executeInstruction(CachedInstruction *insn)
+
+{
+  int4 num = insn->ops.size();
+  for(int4 l=0;l<numlanes;++l) {
+    select[l] = ((status[l] == lane_running)&&(pc[l] == insn->addr)) ? 1 : 0;
+    opindex[l] = select[l] ? 0 : -1;
+  }
+  int4 i = 0;
+  bool split = false;		// Lanes may be at different ops
+  for(;;) {
+    if (split) {
+      i = num;
+      for(int4 l=0;l<numlanes;++l)
+	if ((opindex[l] >= 0)&&(opindex[l] < i))
+	  i = opindex[l];
+      if (i == num) break;
+      for(int4 l=0;l<numlanes;++l)
+	select[l] = (opindex[l] == i) ? 1 : 0;
+    }
+    else if (i == num)
+      break;
+    split = executeOp(insn->ops[i],i,num) || split;
+    i += 1;
+  }
+  Address fallthru = insn->addr + insn->length;
+  bool checkstop = !stops.empty();
+  for(int4 l=0;l<numlanes;++l) {
+    if (opindex[l] < num) continue;
+    if (opindex[l] == num)
+      pc[l] = fallthru;
+    if (checkstop && (stops.find(pc[l]) != stops.end()))
+      status[l] = lane_stopped;
+  }
+}
+
+/// Each step runs the instruction at the lowest address any running lane
+/// is at, for all lanes at that address.
+/// \param maxsteps is the maximum number of steps
+/// \return the number of steps executed
+uintb EmulateLanes::run(uintb maxsteps)
+
+{
+  uintb steps = 0;
+  while(steps < maxsteps) {
+    int4 first = -1;
+    for(int4 l=0;l<numlanes;++l) {
+      if (status[l] != lane_running) continue;
+      if ((first < 0)||(pc[l] < pc[first]))
+	first = l;
+    }
+    if (first < 0) break;
+    executeInstruction(translate(pc[first]));
+    steps += 1;
+  }
+  return steps;
+}
@@ -78,6 +78,7 @@ private:
   int4 parsestate;
   AddrSpace *const_space;
   uint1 buf[16];		// Buffer of bytes in the instruction stream
+  const uint1 *bytes;		// Instruction stream, -buf- or straight from the LoadImage
   uintm *context;		// Pointer to local context
   int4 contextsize;		// Number of entries in context array
   ContextCache *contcache;   // Interface for getting/setting context
@@ -93,6 +94,8 @@ public:
   ParserContext(ContextCache *ccache);
   ~ParserContext(void) { if (context != (uintm *)0) delete [] context; }
   uint1 *getBuffer(void) { return buf; }
+  const uint1 *getBytes(void) const { return bytes; }
+  void setBytes(const uint1 *ptr) { bytes = ptr; }
   void initialize(int4 maxstate,int4 maxparam,AddrSpace *spc);
   int4 getParserState(void) const { return parsestate; }
   void setParserState(int4 st) { parsestate = st; }
@@ -103,6 +106,7 @@ public:
   void setCalladdr(const Address &ad) { calladdr = ad; }
   void addCommit(TripleSymbol *sym,int4 num,uintm mask,bool flow,ConstructState *point);
   void clearCommits(void) { contextcommit.clear(); }
+  bool hasCommits(void) const { return !contextcommit.empty(); }
   void applyCommits(void);
   const Address &getAddr(void) const { return addr; }
   const Address &getNaddr(void) const { return naddr; }
@@ -289,6 +289,13 @@ class EmulateMemory : public Emulate {
 protected:
     MemoryState* memstate;      ///< The memory state of the emulator
     PcodeOpRaw* currentOp;      ///< Current op to execute
+    vector<uint1> widebuf;      ///< Scratch space for values wider than a uintb
+    // Is any operand of the current op wider than a uintb
+    bool isWideOp (void) const;
+    // Execute the current unary op on values of any size
+    void executeUnaryWide (void);
+    // Execute the current binary op on values of any size
+    void executeBinaryWide (void);
     virtual void executeUnary (void);
     virtual void executeBinary (void);
     virtual void executeLoad (void);
@@ -345,6 +352,35 @@ public:
                        VarnodeData* vars, int4 isize);
 };
 
+/// \brief One machine instruction translated by EmulatePcodeCache
+///
+/// The ops already carry their OpBehavior, so executing a cached instruction
+/// needs no further lookups. Instructions that fall through to each other are
+/// chained by \e fallthru, which strings straight-line code into blocks that
+/// are walked without touching the address map. The last direct branch taken
+/// out of the instruction is chained the same way by \e taken.
+class CachedInstruction {
+public:
+    Address addr;                ///< Address of the machine instruction
+    int4 length;                 ///< Length of the instruction in bytes
+    vector<PcodeOpRaw*> ops;     ///< The translated p-code ops
+    vector<VarnodeData*> vars;   ///< Varnodes referenced by \e ops
+    CachedInstruction* fallthru; ///< Translation of the next instruction
+    uint4 linkgen;               ///< Cache generation when \e fallthru was set
+    CachedInstruction* taken;    ///< Translation of the last direct branch target
+    uint4 takengen;              ///< Cache generation when \e taken was set
+    CachedInstruction (const Address& a)
+        : addr (a)
+    {
+        length   = 0;
+        fallthru = (CachedInstruction*)0;
+        linkgen  = 0;
+        taken    = (CachedInstruction*)0;
+        takengen = 0;
+    }
+    virtual ~CachedInstruction (void);
+};
+
 /// \brief A SLEIGH based implementation of the Emulate interface
 ///
 /// This implementation uses a Translate object to translate machine
@@ -352,33 +388,53 @@ public:
 /// The pcode is cached as soon as the execution address is set, either
 /// explicitly, or via branches and fallthrus. There are additional methods for
 /// inspecting the pcode ops in the current instruction as a sequence.
-class EmulatePcodeCache : public EmulateMemory {
+///
+/// Translations are kept by address, so a loop is translated on its first
+/// iteration only. The emulator watches every space it has translated code
+/// from, and any setValue or setChunk on the MemoryState that overlaps a
+/// cached instruction drops that translation. The cache does not track the
+/// context database, so call flushTranslations() after changing context.
+class EmulatePcodeCache : public EmulateMemory, public MemoryWriteWatch {
+    // Translated instructions by address
+    map<Address, CachedInstruction*> translations;
+    // Invalidated instructions that were still executing
+    vector<CachedInstruction*> retired;
+    // Bumped on every invalidation; stale \e fallthru links are ignored
+    uint4 generation;
+    // Length of the longest cached instruction
+    int4 maxlength;
+    // Map from OpCode to OpBehavior
+    vector<OpBehavior*> inst;
+    // Drop an instruction from the cache
+    void discard (CachedInstruction* insn);
+    // Free instructions retired while they were executing
+    void clearRetired (void);
+    // Look up or translate the instruction at the given address
+    CachedInstruction* translate (const Address& addr);
+    // Make a cached instruction the current one
+    void startInstruction (CachedInstruction* insn);
+    // Cache pcode for instruction at given address
+    void createInstruction (const Address& addr);
 
+protected:
     // The SLEIGH translator
     Translate* trans;
-    // The cache of current p-code ops
-    vector<PcodeOpRaw*> opcache;
-    // The cache of current varnodes
-    vector<VarnodeData*> varcache;
-    // Map from OpCode to OpBehavior
-    vector<OpBehavior*> inst;
     // The table of breakpoints
     BreakTable* breaktable;
+    // The instruction currently being executed
+    CachedInstruction* current;
     // Address of current instruction being executed
     Address current_address;
     // \b true if next pcode op is start of instruction
     bool instruction_start;
     // Index of current pcode op within machine instruction
     int4 current_op;
-    // Length of current instruction in bytes
-    int4 instruction_length;
-    ///< Clear the p-code cache
-    void clearCache (void);
-    // Cache pcode for instruction at given address
-    void createInstruction (const Address& addr);
+    // Set up currentOp and currentBehave from current_op
     void establishOp (void);
-
-protected:
+    // Continue execution at the target of a direct branch
+    void branchTo (const Address& dest);
+    // Allocate the cache entry for a newly translated instruction
+    virtual CachedInstruction* newInstruction (const Address& addr);
     // Execute fallthru semantics for the pcode cache
     virtual void fallthruOp (void);
     // Execute branch (including relative branches)
@@ -402,7 +458,13 @@ public:
     // Get current execution address
     virtual Address getExecuteAddress (void) const;
     // Execute (the rest of) a single machine instruction
-    void executeInstruction (void);
+    virtual void executeInstruction (void);
+    // Drop every cached translation
+    void flushTranslations (void);
+    // Number of instructions currently translated
+    int4 numTranslations (void) const;
+    // Invalidate translations overlapping a write
+    virtual void memoryWritten (AddrSpace* spc, uintb off, int4 size);
 };
 
 /// Since the emulator can single step through individual pcode operations, the
@@ -423,7 +485,9 @@ inline bool EmulatePcodeCache::isInstructionStart (void) const
 inline int4 EmulatePcodeCache::numCurrentOps (void) const
 
 {
-    return opcache.size ();
+    if (current == (CachedInstruction*)0)
+        return 0;
+    return current->ops.size ();
 }
 
 /// This routine can be used to determine where, within the sequence of ops in
@@ -443,7 +507,7 @@ inline int4 EmulatePcodeCache::getCurrentOpIndex (void) const
 inline PcodeOpRaw* EmulatePcodeCache::getOpByIndex (int4 i) const
 
 {
-    return opcache[i];
+    return current->ops[i];
 }
 
 /// \return the currently executing machine address
@@ -453,6 +517,13 @@ inline Address EmulatePcodeCache::getExecuteAddress (void) const
     return current_address;
 }
 
+/// \return the number of machine instructions held in the translation cache
+inline int4 EmulatePcodeCache::numTranslations (void) const
+
+{
+    return translations.size ();
+}
+
 /** \page sleighAPIemulate The SLEIGH Emulator
 
   \section emu_overview Overview
@@ -528,6 +599,11 @@ inline Address EmulatePcodeCache::getExecuteAddress (void) const
   page to hold the new data. The class takes care of loading and filling in
   pages as needed.
 
+  A MemoryPageTable has the same behavior as a MemoryPageOverlay, but finds its
+  pages through a flat radix table and a small TLB instead of a map, and reads
+  or writes values contained in one page directly. It is the better choice
+  for memory-heavy emulation.
+
   Here is an example of instantiating a MemoryState and registering memory banks
   for a \e ram space which is initialized with the load image. The \e ram space
   is implemented with the MemoryPageOverlay, and the \e register space and the
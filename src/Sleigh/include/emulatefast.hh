@@ -0,0 +1,143 @@
+/*
+ * Copyright 2020 Joe Staursky
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/// \file emulatefast.hh
+/// \brief A pre-decoding p-code interpreter built on the EmulatePcodeCache
+
+#ifndef __CPUI_EMULATEFAST__
+#define __CPUI_EMULATEFAST__
+
+#include "emulate.hh"
+
+class EmulateFast;
+struct FastOp;
+
+/// \brief Handler executing one pre-decoded op
+///
+/// Returns the index of the next op to execute within the instruction, or
+/// one of the FastOp::leave codes when control has left the op sequence.
+typedef int4 (*FastHandler) (EmulateFast& emu, const FastOp& op, int4 index);
+
+/// \brief A p-code operand with its storage resolved at decode time
+///
+/// Exactly one of three forms: a constant (\e spc is \b null), a pointer into
+/// a MemoryFlatBank (\e ptr is set), or a general (space,offset) access
+/// through the MemoryState.
+struct FastOperand {
+    uint1* ptr;     ///< Direct storage, or \b null
+    AddrSpace* spc; ///< Space of a general access, or \b null for a constant
+    uintb offset;   ///< Offset of a general access, or the constant value
+    int4 size;      ///< Size of the operand in bytes
+};
+
+/// \brief One p-code op decoded for EmulateFast
+struct FastOp {
+    enum {
+        leave_resync = -1, ///< A fallback op updated the emulator state
+        leave_branch = -2  ///< Execution moved to another instruction
+    };
+    FastHandler handler;  ///< Routine executing the op
+    OpBehavior* behave;   ///< Behavior used by the generic handlers
+    FastOperand out;      ///< The output, if any
+    FastOperand in[3];    ///< Up to three inputs
+    bool resolved;        ///< \b true if \e out and \e in have been filled in
+    int4 target;          ///< Op index of a relative branch
+    Address dest;         ///< Destination of an absolute branch
+};
+
+/// \brief An instruction cached by EmulateFast, with its decoded ops
+class FastInstruction : public CachedInstruction {
+public:
+    vector<FastOp> fastops; ///< One decoded op per raw p-code op
+    bool decoded;           ///< \b true once \e fastops has been built
+    FastInstruction (const Address& a)
+        : CachedInstruction (a)
+    {
+        decoded = false;
+    }
+};
+
+/// \brief An EmulatePcodeCache that executes pre-decoded ops
+///
+/// The first time a cached instruction executes, each of its PcodeOpRaw is
+/// decoded into a FastOp. Varnodes in a space served by a MemoryFlatBank
+/// (normally \e register and \e unique) become direct pointers into the bank,
+/// constants are folded into the operand, and everything else is resolved to
+/// a (space,offset) pair. Each op carries a handler chosen for its opcode, so
+/// dispatch is one indirect call with no OpBehavior virtual call for common
+/// integer ops, and no MemoryState lookup for register operands.
+///
+/// Ops the fast path does not cover (calls, indirect branches, CALLOTHER,
+/// operands wider than a uintb) fall back to the EmulateMemory routines on
+/// the raw op, so BreakTable and BreakCallBack behave exactly as with
+/// EmulatePcodeCache. Direct writes into a flat bank do not notify the
+/// MemoryState write watch; flat banks should not hold code.
+class EmulateFast : public EmulatePcodeCache {
+    friend struct FastExec;
+    // Resolve the storage for a varnode
+    void resolveOperand (FastOperand& res, const VarnodeData* vn) const;
+
+protected:
+    // Decode every op of an instruction
+    void decode (FastInstruction* insn);
+    // Run ops of the current instruction until control leaves it
+    void runInstruction (void);
+    virtual CachedInstruction* newInstruction (const Address& addr);
+
+public:
+    // Constructor
+    EmulateFast (Translate* t, MemoryState* s, BreakTable* b);
+    // Read the value of a decoded operand
+    uintb readOperand (const FastOperand& op) const;
+    // Write the value of a decoded operand
+    void writeOperand (const FastOperand& op, uintb val);
+    // Execute (the rest of) a single machine instruction
+    virtual void executeInstruction (void);
+    // Execute instructions until halted or \e count are done
+    uintb run (uintb count);
+};
+
+/// \param op is the operand to read
+/// \return the value, decoded in the byte order of its space
+inline uintb EmulateFast::readOperand (const FastOperand& op) const
+
+{
+    if (op.ptr != (uint1*)0) {
+        uintb res = 0;
+        memcpy ((uint1*)&res + ((HOST_ENDIAN == 1) ? sizeof (uintb) - op.size : 0),
+                op.ptr, op.size);
+        return res;
+    }
+    if (op.spc == (AddrSpace*)0)
+        return op.offset;
+    return memstate->getValue (op.spc, op.offset, op.size);
+}
+
+/// Only the low \e size bytes of the value are stored.
+/// \param op is the operand to write
+/// \param val is the value to write
+inline void EmulateFast::writeOperand (const FastOperand& op, uintb val)
+
+{
+    if (op.ptr != (uint1*)0) {
+        memcpy (op.ptr,
+                (const uint1*)&val + ((HOST_ENDIAN == 1) ? sizeof (uintb) - op.size : 0),
+                op.size);
+        return;
+    }
+    memstate->setValue (op.spc, op.offset, op.size, val);
+}
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2020 Joe Staursky
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/// \file emulatejit.hh
+/// \brief An emulator compiling hot instructions into host machine code
+
+#ifndef __CPUI_EMULATEJIT__
+#define __CPUI_EMULATEJIT__
+
+#include "emulatefast.hh"
+#include <exception>
+
+#if defined (__linux__) && defined (__x86_64__)
+#define CPUI_JIT_X86_64
+#endif
+
+class EmulateJit;
+class JitAssembler;
+
+/// \brief Compiled form of one instruction
+///
+/// Returns the same codes as a FastHandler run over the whole op sequence:
+/// the number of ops if execution fell off the end, an op index where the
+/// interpreter should resume, or one of the FastOp::leave codes.
+typedef int4 (*JitCode) (EmulateJit* emu);
+
+/// \brief Executable memory for code generated by EmulateJit
+///
+/// The region is mapped on first use and handed out from the front. Pages
+/// are only writable while code is being copied into them. When the region
+/// fills up it is reset as a whole, and the \e epoch tells owners of older
+/// code that it is gone.
+class JitCodeBuffer {
+    uint1* base;    ///< Start of the mapping, or \b null before first use
+    uintb capacity; ///< Size of the mapping in bytes
+    uintb used;     ///< Number of bytes handed out
+    uint4 epoch;    ///< Bumped on every reset
+    bool failed;    ///< Executable memory is unavailable
+public:
+    // Constructor
+    JitCodeBuffer (uintb cap);
+    // Destructor
+    ~JitCodeBuffer (void);
+    uint4 getEpoch (void) const { return epoch; } ///< Get the current epoch
+    bool isFailed (void) const { return failed; } ///< Is executable memory unavailable
+    // Copy code into executable memory
+    uint1* install (const vector<uint1>& code);
+    // Discard all code
+    void reset (void);
+};
+
+/// \brief An instruction cached by EmulateJit
+class JitInstruction : public FastInstruction {
+public:
+    JitCode code;  ///< Compiled form, valid while \e epoch matches the buffer
+    uint4 epoch;   ///< Buffer epoch \e code was installed in
+    uint4 hits;    ///< Number of times execution started the instruction
+    bool pure;     ///< Every op was compiled inline
+    bool rejected; ///< Not worth compiling, or compiling failed
+    JitInstruction (const Address& a)
+        : FastInstruction (a)
+    {
+        code     = (JitCode)0;
+        epoch    = 0;
+        hits     = 0;
+        pure     = false;
+        rejected = false;
+    }
+};
+
+/// \brief An EmulateFast that compiles hot instructions into host code
+///
+/// Once an instruction has started \e threshold times, its decoded ops are
+/// compiled into x86-64 code. Integer and boolean ops whose operands are
+/// constants or live in a MemoryFlatBank, and branches within the instruction,
+/// become inline code. Every other op (LOAD, STORE, floating point, CALLOTHER,
+/// calls and branches out of the instruction) is compiled as a call to its
+/// FastOp handler, which runs the interpreter's code for it.
+///
+/// Code is compiled per machine instruction, so address breakpoints are
+/// checked before each instruction and CALLOTHER reaches the BreakTable
+/// exactly as with EmulatePcodeCache. On other hosts, or when executable
+/// memory cannot be mapped, everything runs on the EmulateFast interpreter.
+///
+/// In differential mode, every instruction compiled entirely inline is also
+/// run by the interpreter on the same register state, and any difference in
+/// the outputs throws a LowlevelError naming the instruction.
+class EmulateJit : public EmulateFast {
+    friend class JitAssembler;
+    JitCodeBuffer buffer;   ///< Executable memory holding compiled code
+    uint4 threshold;        ///< Starts before an instruction is compiled
+    bool differential;      ///< Check compiled code against the interpreter
+    int4 depth;             ///< Number of compiled instructions running
+    std::exception_ptr pending; ///< Exception caught inside compiled code
+    // Run a FastOp handler on behalf of compiled code
+    static int4 callHandler (EmulateJit* emu, const FastOp* op, int4 index);
+    // Generate code for an instruction
+    bool compile (JitInstruction* insn);
+    // Get compiled code for an instruction, compiling it if it is hot
+    JitCode lookupCode (JitInstruction* insn);
+    // Run compiled code
+    int4 runCode (JitCode code);
+    // Run compiled code and the interpreter, and compare
+    int4 runChecked (JitInstruction* insn, JitCode code);
+
+protected:
+    virtual CachedInstruction* newInstruction (const Address& addr);
+
+public:
+    // Constructor
+    EmulateJit (Translate* t, MemoryState* s, BreakTable* b);
+    // Can code be generated for this host
+    static bool isSupported (void);
+    void setThreshold (uint4 val) { threshold = val; } ///< Set starts before compiling
+    void setDifferential (bool val) { differential = val; } ///< Toggle differential mode
+    // Execute (the rest of) a single machine instruction
+    virtual void executeInstruction (void);
+};
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2020 Joe Staursky
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/// \file emulatelanes.hh
+/// \brief Running one p-code stream over many independent machine states
+
+#ifndef __CPUI_EMULATELANES__
+#define __CPUI_EMULATELANES__
+
+#include "emulate.hh"
+
+/// \brief Storage for one address space, replicated across lanes
+///
+/// Bytes are kept as planes: all the lanes' copies of a byte are adjacent,
+/// so reading or writing one varnode for every lane is a handful of
+/// loops over contiguous bytes. On hosts with AVX2 these run four lanes
+/// per vector.
+class LaneBank {
+    AddrSpace* space;   ///< The space being held
+    int4 numlanes;      ///< Number of lanes
+    uintb size;         ///< Number of bytes of the space held, per lane
+    vector<uint1> data; ///< Byte planes, \e numlanes bytes per offset
+public:
+    // Constructor
+    LaneBank (AddrSpace* spc, int4 lanes, uintb sz);
+    AddrSpace* getSpace (void) const { return space; } ///< Get the space being held
+    uintb getSize (void) const { return size; }        ///< Get the bytes held per lane
+    // Is the given range held
+    bool contains (uintb offset, int4 sz) const;
+    // Read a value from every lane
+    void getValues (uintb offset, int4 sz, uintb* res) const;
+    // Write a value into the selected lanes
+    void setValues (uintb offset, int4 sz, const uintb* vals, const uint1* mask);
+    // Read a value from one lane
+    uintb getValue (int4 lane, uintb offset, int4 sz) const;
+    // Write a value into one lane
+    void setValue (int4 lane, uintb offset, int4 sz, uintb val);
+};
+
+/// \param offset is the start of the range
+/// \param sz is the number of bytes in the range
+/// \return \b true if every byte of the range is held
+inline bool LaneBank::contains (uintb offset, int4 sz) const
+
+{
+    return (offset < size && (uintb)sz <= size - offset);
+}
+
+/// \brief An emulator running the same code over many states at once
+///
+/// Each lane is a separate machine state for the spaces given a LaneBank
+/// (normally \e register, \e unique, and a window of \e ram holding the
+/// inputs). Other spaces are shared, read-only, and read through the
+/// MemoryState. Instructions are translated once and cached as with
+/// EmulatePcodeCache.
+///
+/// Lanes at the same address execute together. Each p-code op is evaluated
+/// for every lane in one pass. The common integer ops are computed four
+/// lanes per vector with AVX2 when the host has it, and by plain loops over
+/// lanes otherwise; other ops use their OpBehavior lane by lane. A CBRANCH
+/// splits the lanes: within an instruction, lanes follow their own op index
+/// and run masked, and between instructions the lanes at the lowest address
+/// run first, so lanes that diverged on a forward branch reconverge where
+/// the paths meet.
+///
+/// A lane stops when it reaches a stop address or executes a CALLOTHER.
+class EmulateLanes {
+public:
+    /// \brief Execution status of a lane
+    enum {
+        lane_running = 0, ///< Still executing
+        lane_stopped = 1, ///< Reached a stop address
+        lane_userop  = 2  ///< Executed a CALLOTHER
+    };
+
+private:
+    Translate* trans;            ///< The SLEIGH translator
+    MemoryState* memstate;       ///< Storage for the shared spaces
+    int4 numlanes;               ///< Number of lanes
+    vector<LaneBank*> banks;     ///< Lane storage by space index, or \b null
+    vector<OpBehavior*> inst;    ///< Map from OpCode to OpBehavior
+    map<Address, CachedInstruction*> translations; ///< Translated instructions
+    set<Address> stops;          ///< Addresses where lanes stop
+    vector<Address> pc;          ///< Next instruction of each lane
+    vector<uint1> status;        ///< Status of each lane
+    vector<int4> opindex;        ///< Next op of each lane in the current instruction
+    vector<uint1> select;        ///< Lanes executing the current op
+    vector<uintb> in0;           ///< Values of input 0
+    vector<uintb> in1;           ///< Values of input 1
+    vector<uintb> res;           ///< Values of the output
+    // Look up or translate the instruction at the given address
+    CachedInstruction* translate (const Address& addr);
+    // Read an operand for every lane
+    void readOperand (const VarnodeData* vn, uintb* vals) const;
+    // Write an output into the selected lanes
+    void writeOperand (const VarnodeData* vn, const uintb* vals, const uint1* mask);
+    // Evaluate a unary op across lanes
+    void executeUnary (OpBehavior* behave, const PcodeOpRaw* op);
+    // Evaluate a binary op across lanes
+    void executeBinary (OpBehavior* behave, const PcodeOpRaw* op);
+    // Execute a LOAD or STORE for each selected lane
+    void executeMemory (const PcodeOpRaw* op, bool isload);
+    // Execute one op for the selected lanes
+    bool executeOp (const PcodeOpRaw* op, int4 index, int4 num);
+    // Execute an instruction for the lanes at its address
+    void executeInstruction (CachedInstruction* insn);
+
+public:
+    // Constructor
+    EmulateLanes (Translate* t, MemoryState* s, int4 lanes);
+    // Destructor
+    ~EmulateLanes (void);
+    int4 numLanes (void) const { return numlanes; } ///< Get the number of lanes
+    // Give a space separate storage in every lane
+    LaneBank* addLaneBank (AddrSpace* spc, uintb size);
+    // Get the lane storage for a space
+    LaneBank* getLaneBank (AddrSpace* spc) const;
+    // Make lanes stop at the given address
+    void addStop (const Address& addr);
+    // Start every lane at the given address
+    void setExecuteAddress (const Address& addr);
+    const Address& getExecuteAddress (int4 lane) const { return pc[lane]; } ///< Get the next address of a lane
+    int4 getStatus (int4 lane) const { return status[lane]; } ///< Get the status of a lane
+    // Run until every lane has stopped
+    uintb run (uintb maxsteps);
+};
+
+#endif
@@ -76,6 +76,7 @@ public:
   virtual ~LoadImage(void);	///< LoadImage destructor
   const string &getFileName(void) const; ///< Get the name of the LoadImage
   virtual void loadFill(uint1 *ptr,int4 size,const Address &addr)=0; ///< Get data from the LoadImage
+  virtual const uint1 *getDirect(const Address &addr,int4 size) const; ///< Get data without copying it, if possible
   virtual void openSymbols(void) const; ///< Prepare to read symbols
   virtual void closeSymbols(void) const; ///< Stop reading symbols
   virtual bool getNextSymbol(LoadImageFunc &record) const; ///< Get the next symbol record
@@ -126,6 +127,16 @@ inline const string &LoadImage::getFileName(void) const {
   return filename;
 }
 
+/// Images that keep their bytes in memory for their whole lifetime can hand
+/// out a pointer to them instead of copying them with loadFill(). By default
+/// nothing is available this way.
+/// \param addr is the address of the first byte wanted
+/// \param size is the number of bytes that must be readable from the pointer
+/// \return a pointer to the bytes at \e addr or null if they must be read with loadFill()
+inline const uint1 *LoadImage::getDirect(const Address &addr,int4 size) const {
+  return (const uint1 *)0;
+}
+
 /// This routine should read in and parse any symbol information
 /// that the load image contains about executable.  Once this
 /// method is called, individual symbol records are read out
@@ -33,9 +33,80 @@
 /// accesses through getPage/setPage. So these are the virtual methods that need
 /// to be overridden in the derived classes.
 
+/// \brief Journal of pages replaced since the last snapshot of a page based bank
+///
+/// Pages handed out by the journal carry a trailing stamp holding the epoch
+/// they were created in. A snapshot starts a new epoch, after which a page
+/// with an older stamp is shared with the snapshot and must be copied before
+/// it is written. The original of each copied (or newly mapped) page is
+/// saved, so a restore touches only the pages written since the snapshot.
+class PageJournal {
+public:
+    /// \brief A page as it was when the snapshot was taken
+    struct SavedPage {
+        uintb pageaddr; ///< Aligned address of the page
+        uint1* page;    ///< Original page bytes, or \b null if it was unmapped
+    };
+
+private:
+    int4 pagesize;           ///< Number of bytes in a page
+    bool active;             ///< \b true once a snapshot has been taken
+    uint4 epoch;             ///< Stamp given to pages private to the current state
+    vector<SavedPage> saved; ///< Pages to put back on restore
+    void freeSaved (void);   ///< Free every saved original
+public:
+    PageJournal (int4 ps)
+    {
+        pagesize = ps;
+        active   = false;
+        epoch    = 1;
+    }
+    ~PageJournal (void) { freeSaved (); }
+    // Allocate a page private to the current epoch
+    uint1* allocate (void) const;
+    // Release a page allocated by the journal
+    static void release (uint1* page) { delete[] page; }
+    // Does the page need to be copied before it is written
+    bool isShared (const uint1* page) const;
+    // Remember the original of a page about to be replaced
+    void record (uintb pageaddr, uint1* orig);
+    // Start a new snapshot, discarding the old originals
+    void snapshot (void);
+    // Get the pages to put back on restore
+    const vector<SavedPage>& getSaved (void) const { return saved; }
+    // Forget the saved pages after they have been put back
+    void finishRestore (void);
+};
+
+/// \return \b true if a snapshot is active and the page predates the current epoch
+inline bool PageJournal::isShared (const uint1* page) const
+
+{
+    if (!active)
+        return false;
+    uint4 stamp;
+    memcpy (&stamp, page + pagesize, sizeof (uint4));
+    return (stamp != epoch);
+}
+
+/// Nothing is recorded unless a snapshot is active.
+/// \param pageaddr is the aligned address of the page
+/// \param orig is the page being replaced, or \b null if none was mapped
+inline void PageJournal::record (uintb pageaddr, uint1* orig)
+
+{
+    if (!active)
+        return;
+    saved.emplace_back ();
+    saved.back ().pageaddr = pageaddr;
+    saved.back ().page     = orig;
+}
+
 class MemoryBank {
     friend class MemoryPageOverlay;
     friend class MemoryHashOverlay;
+    friend class MemoryPageTable;
+    friend class MemoryFlatBank;
     int4 wordsize; ///< Number of bytes in an aligned word access
     int4 pagesize; ///< Number of bytes in an aligned page access
     AddrSpace* space; ///< The address space associated with this memory
@@ -60,13 +131,17 @@ public:
     // Get the address space associated with this memory bank
     AddrSpace* getSpace (void) const;
     // Set the value of a (small) range of bytes
-    void setValue (uintb offset, int4 size, uintb val);
+    virtual void setValue (uintb offset, int4 size, uintb val);
     // Retrieve the value encoded in a (small) range of bytes
-    uintb getValue (uintb offset, int4 size) const;
+    virtual uintb getValue (uintb offset, int4 size) const;
     // Set values of an arbitrary sequence of bytes
     void setChunk (uintb offset, int4 size, const uint1* val);
     // Retrieve an arbitrary sequence of bytes
     void getChunk (uintb offset, int4 size, uint1* res) const;
+    // Take a checkpoint of the bank's current contents
+    virtual void snapshot (void);
+    // Undo every write made since the last snapshot
+    virtual void restore (vector<uintb>& touched);
     // Decode bytes to value
     static uintb constructValue (const uint1* ptr, int4 size, bool bigendian);
     // Encode value to bytes
@@ -124,6 +199,10 @@ protected:
 public:
     // Constructor for a loadimage memorybank
     MemoryImage (AddrSpace* spc, int4 ws, int4 ps, LoadImage* ld);
+    // A read-only bank has nothing to checkpoint
+    virtual void snapshot (void) {}
+    // A read-only bank has nothing to undo
+    virtual void restore (vector<uintb>& touched) {}
 };
 
 /// \brief Memory bank that overlays some other memory bank, using a "copy on
@@ -136,6 +215,9 @@ public:
 class MemoryPageOverlay : public MemoryBank {
     MemoryBank* underlie;       ///< Underlying memory object
     map<uintb, uint1*> page;    ///< Overlayed pages
+    PageJournal journal;        ///< Pages to put back on restore
+    // Get a page that may be written, copying or creating it as needed
+    uint1* writablePage (uintb pageaddr, bool fill);
 protected:
     // Overridden aligned word insert
     virtual void insert (uintb addr, uintb val);
@@ -150,8 +232,91 @@ public:
     // Constructor for page overlay
     MemoryPageOverlay (AddrSpace* spc, int4 ws, int4 ps, MemoryBank* ul);
     virtual ~MemoryPageOverlay (void);
+    virtual void snapshot (void);
+    virtual void restore (vector<uintb>& touched);
 };
 
+/// \brief Memory bank that overlays some other memory bank using a flat radix
+/// page table
+///
+/// Behaves like MemoryPageOverlay, copying a page from the underlying bank on
+/// its first write, but pages are found by indexing a multi-level table of
+/// 2^LEVEL_BITS entries per level instead of searching a map. The last few
+/// pages touched are remembered in a small direct-mapped TLB, so the common
+/// case of repeated access to the same stack or data page is a tag compare.
+/// getValue and setValue are overridden so any access contained in one
+/// mapped page is served straight from the page bytes.
+class MemoryPageTable : public MemoryBank {
+    enum {
+        LEVEL_BITS = 10, ///< Index bits consumed by each table level
+        TLB_SIZE   = 8   ///< Number of entries in the TLB (power of 2)
+    };
+    /// \brief A cached translation from page address to page bytes
+    struct TlbEntry {
+        uintb pageaddr; ///< Aligned address of the page
+        uint1* page;    ///< The page bytes
+    };
+    MemoryBank* underlie; ///< Underlying memory object
+    uintb pagemask;       ///< Mask for the offset within a page
+    int4 pageshift;       ///< log2 of the page size
+    int4 numlevels;       ///< Number of table levels above the pages
+    bool nativeorder;     ///< Space endianness matches the host
+    void** root;          ///< Top level of the table
+    PageJournal journal;  ///< Pages to put back on restore
+    mutable TlbEntry tlb[TLB_SIZE]; ///< Recently used pages
+    // Walk the table, optionally creating missing levels
+    void** walk (uintb pageaddr, bool create) const;
+    // Find the bytes of a mapped page, or \b null
+    uint1* lookupPage (uintb pageaddr) const;
+    // Map a new page, initialized from the underlying bank
+    uint1* createPage (uintb pageaddr, bool fill);
+    // Get a page that may be written, copying or creating it as needed
+    uint1* writablePage (uintb pageaddr, bool fill);
+    // Free a table level and everything below it
+    void freeLevel (void** node, int4 level);
+    // Flush all TLB entries
+    void flushTlb (void) const;
+
+protected:
+    // Overridden aligned word insert
+    virtual void insert (uintb addr, uintb val);
+    // Overridden aligned word find
+    virtual uintb find (uintb addr) const;
+    // Overridden getPage
+    virtual void getPage (uintb addr, uint1* res, int4 skip, int4 size) const;
+    // Overridden setPage
+    virtual void setPage (uintb addr, const uint1* val, int4 skip, int4 size);
+
+public:
+    // Constructor for a page table bank
+    MemoryPageTable (AddrSpace* spc, int4 ws, int4 ps, MemoryBank* ul);
+    virtual ~MemoryPageTable (void);
+    // Overridden value write with an in-page fast path
+    virtual void setValue (uintb offset, int4 size, uintb val);
+    // Overridden value read with an in-page fast path
+    virtual uintb getValue (uintb offset, int4 size) const;
+    virtual void snapshot (void);
+    virtual void restore (vector<uintb>& touched);
+};
+
+/// The TLB is consulted first; on a miss the table is walked and, if the page
+/// is mapped, the TLB slot is refilled.
+/// \param pageaddr is the aligned address of the page
+/// \return the page bytes or \b null if the page has not been written
+inline uint1* MemoryPageTable::lookupPage (uintb pageaddr) const
+
+{
+    TlbEntry& ent (tlb[(pageaddr >> pageshift) & (TLB_SIZE - 1)]);
+    if (ent.pageaddr == pageaddr)
+        return ent.page;
+    void** slot = walk (pageaddr, false);
+    if (slot == (void**)0 || *slot == (void*)0)
+        return (uint1*)0;
+    ent.pageaddr = pageaddr;
+    ent.page     = (uint1*)*slot;
+    return ent.page;
+}
+
 /// \brief A memory bank that implements reads and writes using a hash table.
 ///
 /// The initial state of the bank is taken from an \e underlying memory bank or
@@ -168,6 +333,18 @@ class MemoryHashOverlay : public MemoryBank {
     vector<uintb> address;
     // The hashtable values
     vector<uintb> value;
+    /// \brief A hashtable slot as it was when the snapshot was taken
+    struct SavedSlot {
+        int4 slot;     ///< Index of the slot
+        uintb address; ///< Original address key
+        uintb value;   ///< Original value
+    };
+    bool snapactive;           ///< \b true once a snapshot has been taken
+    uint4 epoch;               ///< Slots stamped with this are already saved
+    vector<uint4> slotstamp;   ///< Epoch in which each slot was last saved
+    vector<SavedSlot> saved;   ///< Slots to put back on restore
+    // Save a slot before its first write in this epoch
+    void saveSlot (int4 slot);
 protected:
     // Overridden aligned word insert
     virtual void insert (uintb addr, uintb val);
@@ -177,10 +354,71 @@ public:
     // Constructor for hash overlay
     MemoryHashOverlay (AddrSpace* spc, int4 ws, int4 ps, int4 hashsize,
                        MemoryBank* ul);
+    virtual void snapshot (void);
+    virtual void restore (vector<uintb>& touched);
 };
 
+/// \brief A memory bank holding a small space as one contiguous byte array
+///
+/// Intended for the \e register and \e unique spaces, which only use a few
+/// kilobytes at low offsets. Offsets from 0 up to the size of the bank are
+/// backed by an array that starts zeroed; accesses beyond it throw. Because
+/// the storage never moves, an execution engine can bind varnodes in this
+/// space directly to pointers into the array (see getData()), while reads and
+/// writes through the MemoryState stay coherent with it.
+class MemoryFlatBank : public MemoryBank {
+    uint1* data;        ///< The bytes of the space
+    uintb size;         ///< Number of bytes in \e data
+    uint1* saved;       ///< Copy of \e data at the last snapshot
+protected:
+    // Overridden aligned word insert
+    virtual void insert (uintb addr, uintb val);
+    // Overridden aligned word find
+    virtual uintb find (uintb addr) const;
+    // Overridden getPage
+    virtual void getPage (uintb addr, uint1* res, int4 skip, int4 size) const;
+    // Overridden setPage
+    virtual void setPage (uintb addr, const uint1* val, int4 skip, int4 size);
+
+public:
+    // Constructor for a flat bank
+    MemoryFlatBank (AddrSpace* spc, int4 ws, int4 ps, uintb sz);
+    virtual ~MemoryFlatBank (void);
+    uint1* getData (void) const { return data; } ///< Get the backing bytes
+    uintb getSize (void) const { return size; }  ///< Get the number of backing bytes
+    // Is the given range backed by the array
+    bool contains (uintb offset, int4 sz) const;
+    // Overridden value write
+    virtual void setValue (uintb offset, int4 size, uintb val);
+    // Overridden value read
+    virtual uintb getValue (uintb offset, int4 size) const;
+    virtual void snapshot (void);
+    virtual void restore (vector<uintb>& touched);
+};
+
+/// \param offset is the start of the range
+/// \param sz is the number of bytes in the range
+/// \return \b true if every byte of the range lies in the array
+inline bool MemoryFlatBank::contains (uintb offset, int4 sz) const
+
+{
+    return (offset < size && (uintb)sz <= size - offset);
+}
+
 class Translate; // Forward declaration
 
+/// \brief Observer notified when a watched address space is written
+///
+/// A MemoryState calls memoryWritten() after every setValue or setChunk on a
+/// space the watch has been attached to with MemoryState::setWriteWatch.
+/// Emulators use this to drop cached translations of self-modified code.
+class MemoryWriteWatch {
+public:
+    virtual ~MemoryWriteWatch (void) {}
+    // Bytes [off, off+size) of \e spc have just been written
+    virtual void memoryWritten (AddrSpace* spc, uintb off, int4 size) = 0;
+};
+
 /// \brief All storage/state for a pcode machine
 ///
 /// Every piece of information in a pcode machine is representable as a triple
@@ -192,6 +430,10 @@ protected:
     Translate* trans;
     // Memory banks associated with each address space
     vector<MemoryBank*> memspace;
+    // Write observers associated with each address space
+    vector<MemoryWriteWatch*> watch;
+    // Notify the watch for a space, if any, about a write
+    void notifyWrite (AddrSpace* spc, uintb off, int4 size) const;
 public:
     MemoryState (Translate* t); ///< A constructor for MemoryState
     ~MemoryState (void) {}
@@ -215,6 +457,22 @@ public:
     void getChunk (uint1* res, AddrSpace* spc, uintb off, int4 size) const;
     // Set a chunk of data from memory state
     void setChunk (const uint1* val, AddrSpace* spc, uintb off, int4 size);
+    // Read a value of any size, least significant byte first
+    void getWideValue (AddrSpace* spc, uintb off, int4 size, uint1* res) const;
+    // Write a value of any size, least significant byte first
+    void setWideValue (AddrSpace* spc, uintb off, int4 size, const uint1* val);
+    // Read a \b varnode of any size, least significant byte first
+    void getWideValue (const VarnodeData* vn, uint1* res) const;
+    // Write a \b varnode of any size, least significant byte first
+    void setWideValue (const VarnodeData* vn, const uint1* val);
+    // Attach (or with \b null detach) a write observer to a space
+    void setWriteWatch (AddrSpace* spc, MemoryWriteWatch* w);
+    // Get the write observer attached to a space
+    MemoryWriteWatch* getWriteWatch (AddrSpace* spc) const;
+    // Take a checkpoint of every memory bank
+    void snapshot (void);
+    // Return every memory bank to the last checkpoint
+    void restore (void);
 };
 
 /// The MemoryState needs a Translate object in order to be able to convert
@@ -234,6 +492,20 @@ inline Translate* MemoryState::getTranslate (void) const
     return trans;
 }
 
+/// The check is a single indexed load, so unwatched spaces (registers,
+/// temporaries) pay almost nothing.
+/// \param spc is the space that was written
+/// \param off is the offset of the first byte written
+/// \param size is the number of bytes written
+inline void MemoryState::notifyWrite (AddrSpace* spc, uintb off,
+                                      int4 size) const
+
+{
+    int4 index = spc->getIndex ();
+    if (index < watch.size () && watch[index] != (MemoryWriteWatch*)0)
+        watch[index]->memoryWritten (spc, off, size);
+}
+
 /// A convenience method for setting a value directly on a varnode rather than
 /// breaking out the components
 /// \param vn is a pointer to the varnode to be written
@@ -254,4 +526,20 @@ inline uintb MemoryState::getValue (const VarnodeData* vn) const
     return getValue (vn->space, vn->offset, vn->size);
 }
 
+/// \param vn is the varnode to read
+/// \param res receives the value, least significant byte first
+inline void MemoryState::getWideValue (const VarnodeData* vn, uint1* res) const
+
+{
+    getWideValue (vn->space, vn->offset, vn->size, res);
+}
+
+/// \param vn is the varnode to write
+/// \param val is the value, least significant byte first
+inline void MemoryState::setWideValue (const VarnodeData* vn, const uint1* val)
+
+{
+    setWideValue (vn->space, vn->offset, vn->size, val);
+}
+
 #endif
@@ -39,6 +39,11 @@ struct EvaluationError : public LowlevelError {
 ///    * uintb evaluateUnary(int4 sizeout,int4 sizein,uintb in1)
 ///    * uintb recoverInputBinary(int4 slot,int4 sizeout,uintb out,int4 sizein,uintb in)
 ///    * uintb recoverInputUnary(int4 sizeout,uintb out,int4 sizein)
+///
+/// Values wider than a uintb (SSE and AVX registers, for instance) are evaluated
+/// by evaluateUnaryWide() and evaluateBinaryWide(), which work on byte spans
+/// holding the least significant byte first. The output span must not overlap
+/// either input.
 class OpBehavior {
   OpCode opcode;		///< the internal enumeration for pcode types
   bool isunary;			///< true= use unary interfaces,  false = use binary
@@ -71,6 +76,12 @@ public:
   /// \brief Reverse the unary op-code operation, recovering the input value
   virtual uintb recoverInputUnary(int4 sizeout,uintb out,int4 sizein) const;
 
+  /// \brief Emulate the unary op-code on a value of any size
+  virtual void evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const;
+
+  /// \brief Emulate the binary op-code on values of any size
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
+
   static void registerInstructions(vector<OpBehavior *> &inst,const Translate *trans); ///< Build all pcode behaviors
 };
 
@@ -125,6 +136,7 @@ public:
   OpBehaviorCopy(void) : OpBehavior(CPUI_COPY,true) {}	///< Constructor
   virtual uintb evaluateUnary(int4 sizeout,int4 sizein,uintb in1) const;
   virtual uintb recoverInputUnary(int4 sizeout,uintb out,int4 sizein) const;
+  virtual void evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const;
 };
 
 /// CPUI_INT_EQUAL behavior
@@ -132,6 +144,7 @@ class OpBehaviorEqual : public OpBehavior {
 public:
   OpBehaviorEqual(void) : OpBehavior(CPUI_INT_EQUAL,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_NOTEQUAL behavior
@@ -139,6 +152,7 @@ class OpBehaviorNotEqual : public OpBehavior {
 public:
   OpBehaviorNotEqual(void) : OpBehavior(CPUI_INT_NOTEQUAL,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_SLESS behavior
@@ -175,6 +189,7 @@ public:
   OpBehaviorIntZext(void): OpBehavior(CPUI_INT_ZEXT,true) {}	///< Constructor
   virtual uintb evaluateUnary(int4 sizeout,int4 sizein,uintb in1) const;
   virtual uintb recoverInputUnary(int4 sizeout,uintb out,int4 sizein) const;
+  virtual void evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const;
 };
 
 /// CPUI_INT_SEXT behavior
@@ -183,6 +198,7 @@ public:
   OpBehaviorIntSext(void): OpBehavior(CPUI_INT_SEXT,true) {}	///< Constructor
   virtual uintb evaluateUnary(int4 sizeout,int4 sizein,uintb in1) const;
   virtual uintb recoverInputUnary(int4 sizeout,uintb out,int4 sizein) const;
+  virtual void evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const;
 };
 
 /// CPUI_INT_ADD behavior
@@ -191,6 +207,7 @@ public:
   OpBehaviorIntAdd(void): OpBehavior(CPUI_INT_ADD,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
   virtual uintb recoverInputBinary(int4 slot,int4 sizeout,uintb out,int4 sizein,uintb in) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_SUB behavior
@@ -199,6 +216,7 @@ public:
   OpBehaviorIntSub(void): OpBehavior(CPUI_INT_SUB,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
   virtual uintb recoverInputBinary(int4 slot,int4 sizeout,uintb out,int4 sizein,uintb in) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_CARRY behavior
@@ -227,6 +245,7 @@ class OpBehaviorInt2Comp : public OpBehavior {
 public:
   OpBehaviorInt2Comp(void): OpBehavior(CPUI_INT_2COMP,true) {}	///< Constructor
   virtual uintb evaluateUnary(int4 sizeout,int4 sizein,uintb in1) const;
+  virtual void evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const;
 };
 
 /// CPUI_INT_NEGATE behavior
@@ -234,6 +253,7 @@ class OpBehaviorIntNegate : public OpBehavior {
 public:
   OpBehaviorIntNegate(void): OpBehavior(CPUI_INT_NEGATE,true) {}	///< Constructor
   virtual uintb evaluateUnary(int4 sizeout,int4 sizein,uintb in1) const;
+  virtual void evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const;
 };
 
 /// CPUI_INT_XOR behavior
@@ -241,6 +261,7 @@ class OpBehaviorIntXor : public OpBehavior {
 public:
   OpBehaviorIntXor(void): OpBehavior(CPUI_INT_XOR,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_AND behavior
@@ -248,6 +269,7 @@ class OpBehaviorIntAnd : public OpBehavior {
 public:
   OpBehaviorIntAnd(void): OpBehavior(CPUI_INT_AND,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_OR behavior
@@ -255,6 +277,7 @@ class OpBehaviorIntOr : public OpBehavior {
 public:
   OpBehaviorIntOr(void): OpBehavior(CPUI_INT_OR,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_LEFT behavior
@@ -263,6 +286,7 @@ public:
   OpBehaviorIntLeft(void): OpBehavior(CPUI_INT_LEFT,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
   virtual uintb recoverInputBinary(int4 slot,int4 sizeout,uintb out,int4 sizein,uintb in) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_RIGHT behavior
@@ -271,6 +295,7 @@ public:
   OpBehaviorIntRight(void): OpBehavior(CPUI_INT_RIGHT,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
   virtual uintb recoverInputBinary(int4 slot,int4 sizeout,uintb out,int4 sizein,uintb in) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_SRIGHT behavior
@@ -279,6 +304,7 @@ public:
   OpBehaviorIntSright(void): OpBehavior(CPUI_INT_SRIGHT,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
   virtual uintb recoverInputBinary(int4 slot,int4 sizeout,uintb out,int4 sizein,uintb in) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_MULT behavior
@@ -286,6 +312,7 @@ class OpBehaviorIntMult : public OpBehavior {
 public:
   OpBehaviorIntMult(void): OpBehavior(CPUI_INT_MULT,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_INT_DIV behavior
@@ -493,6 +520,7 @@ class OpBehaviorPiece : public OpBehavior {
 public:
   OpBehaviorPiece(void) : OpBehavior(CPUI_PIECE,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 /// CPUI_SUBPIECE behavior
@@ -500,6 +528,7 @@ class OpBehaviorSubpiece : public OpBehavior {
 public:
   OpBehaviorSubpiece(void) : OpBehavior(CPUI_SUBPIECE,false) {}	///< Constructor
   virtual uintb evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const;
+  virtual void evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const;
 };
 
 
@@ -20,6 +20,7 @@
 #define __SLEIGH__
 
 #include "sleighbase.hh"
+#include <atomic>
 
 class LoadImage;
 
@@ -28,25 +29,20 @@ struct RelativeRecord {
   uintb calling_index;		// Index of instruction containing relative offset
 };
 
-// Data for building one pcode instruction
+// Data for building one pcode instruction. The varnodes are not owned, they
+// live in whatever pool the PcodeData was built in (PcodeCacher, PcodeArena).
 struct PcodeData {
     PcodeData() = default;
     OpCode opc;
     VarnodeData* outvar = nullptr; // Points to outvar is there is an output
     VarnodeData* invar = nullptr;  // Inputs
-    int4 isize;                    // Number of inputs
+    int4 isize = 0;                // Number of inputs
 
     // Convenience methods for hutch library.
     PcodeData(OpCode opc_, VarnodeData* outvar_, VarnodeData* invar_, int4 isize_) :
         opc(opc_), outvar(outvar_), invar(invar_), isize(isize_) {}
-    PcodeData(const PcodeData& other)
-    {
-        opc = other.opc;
-        isize = other.isize;
-        this->store(other.outvar, other.invar);
-    }
 
-    bool operator==(const PcodeData &Pcode)
+    bool operator==(const PcodeData &Pcode) const
     {
         if ((outvar != nullptr) && (Pcode.outvar != nullptr)
             ? (*outvar == *Pcode.outvar) ? true : false
@@ -66,24 +62,6 @@ struct PcodeData {
         }
         return false;
     }
-    // This will be managed by the Hutch_Instructions object.
-    void store (VarnodeData* outv, VarnodeData* inv)
-    {
-        if (outv != nullptr) {
-            this->outvar = new VarnodeData;
-            *this->outvar = *outv;
-        }
-        invar = new VarnodeData[isize];
-        for (auto i = 0; i != isize; ++i)
-            this->invar[i] = inv[i];
-    }
-    void release ()
-    {
-        if (this->outvar != nullptr) {
-            delete outvar;
-        }
-        delete[] invar;
-    }
 };
 
 class PcodeCacher { // Cached chunk of pcode, prior to emitting
@@ -119,7 +97,22 @@ public:
   void clear(void);
   void resolveRelatives(void);
   void emit(const Address &addr,PcodeEmit *emt) const;
-  vector<struct PcodeData> hutch_emitIR() const;
+  void hutch_emitIR(vector<PcodeData> &res) const;
+};
+
+// Everything Sleigh::decodeInstruction() learns about a single instruction.
+// The PcodeData entries point into the PcodeCacher pool of the translator, so
+// they stay valid only until the next call that builds p-code.
+struct InstructionRecord {
+    enum {
+        MAX_INSN_LEN = 16       // Size of the ParserContext byte buffer
+    };
+    int4 length = 0;            // Number of bytes in the instruction
+    int4 fallthrough = 0;       // Offset to the next instruction (delay slots)
+    string mnem;
+    string body;
+    uint1 bytes[MAX_INSN_LEN] = {};
+    vector<PcodeData> pcode;
 };
 
 class DisassemblyCache {
@@ -138,6 +131,79 @@ public:
   ParserContext *getParserContext(const Address &addr);
 };
 
+// An immutable copy of one decoded instruction, owning its pcode, as kept by
+// a SharedDecodeCache. It is keyed by address and the context in effect there.
+// An entry loaded from a cache file owns nothing: its context, text and pcode
+// stay in the mapped file and are read from there by fill().
+struct DecodedInstruction {
+  Address addr;
+  vector<uintm> context;	// Context words the instruction was decoded under
+  const uint1 *ctxbytes;	// The context words, in -context- or in the mapped file
+  int4 ctxsize;
+  int4 length;
+  int4 fallthrough;
+  string mnem;
+  string body;
+  uint1 bytes[InstructionRecord::MAX_INSN_LEN];
+  vector<VarnodeData> varnodes;	// Storage for every varnode of -pcode-
+  vector<PcodeData> pcode;
+  const uint1 *record;		// Whole record in the mapped file, or null if owned
+  const uint1 *text;		// Mnemonic onward within -record-
+  uint4 recordsize;
+  uint4 numvarnodes;		// Varnodes in the record's pcode
+  const AddrSpaceManager *spaces; // Resolves the record's space indices
+  mutable bool persisted;	// Already in the cache file (only touched by SharedDecodeCache::saveFile)
+  DecodedInstruction(void) : ctxbytes((const uint1 *)0), ctxsize(0), length(0), fallthrough(0),
+    record((const uint1 *)0), text((const uint1 *)0), recordsize(0), numvarnodes(0),
+    spaces((const AddrSpaceManager *)0), persisted(false) {}
+  DecodedInstruction(const Address &a,const uintm *ctx,int4 ctxsize,const InstructionRecord &rec);
+  bool matches(const Address &a,const uintm *ctx,int4 ctxsize) const;
+  void fill(InstructionRecord &rec,vector<VarnodeData> &scratch) const;
+};
+
+// An address to decoded instruction map shared by any number of SleighDecoder
+// objects on different threads, so a thread can pick up an instruction some
+// other thread already resolved. Lookups and insertions are lock-free: the
+// table is open addressed with a short probe, slots are claimed with a
+// compare-and-swap and entries are never removed while the cache is in use.
+// When every slot in a probe is taken, the new entry is simply not cached.
+// Hits are checked against the current bytes, so a stale entry (e.g. after
+// the image is patched) is decoded again rather than returned.
+//
+// The contents can be kept in a file between runs. loadFile() maps the file
+// and adds an entry per record that points into the mapping, which stays
+// until the cache is cleared; saveFile() appends whatever was decoded since.
+// The file carries a caller-chosen key (normally a hash of the image and the
+// specification) and is ignored, then rewritten, when the key differs.
+class SharedDecodeCache {
+  enum {
+    PROBE = 8,			// Slots examined per lookup
+    FILE_MAGIC = 0x31434448,	// "HDC1" in the file header
+    FILE_VERSION = 1
+  };
+  struct Mapping {
+    void *base;			// The mapped cache file
+    uintb size;
+    DecodedInstruction *entries; // One per record read from it
+  };
+  atomic<const DecodedInstruction *> *table;
+  uint4 mask;			// Size of the table in form 2^n-1
+  vector<Mapping> mappings;	// Files whose records are in the table
+  static uint4 hashKey(const Address &addr,const uint1 *ctx,int4 ctxsize);
+  static void writeRecord(ostream &s,const DecodedInstruction *insn);
+  static bool readRecord(const uint1 *ptr,const uint1 *end,const AddrSpaceManager *spaces,
+			 DecodedInstruction &insn);
+  bool publish(DecodedInstruction *insn);
+public:
+  SharedDecodeCache(int4 size);
+  ~SharedDecodeCache(void);
+  const DecodedInstruction *find(const Address &addr,const uintm *ctx,int4 ctxsize) const;
+  void insert(DecodedInstruction *insn);
+  void clear(void);		// Not safe while other threads use the cache
+  int4 loadFile(const string &path,uint8 key,const AddrSpaceManager *spaces);
+  int4 saveFile(const string &path,uint8 key);
+};
+
 class SleighBuilder : public PcodeBuilder {
   virtual void dump( OpTpl *op );
   AddrSpace *const_space;
@@ -158,29 +224,61 @@ public:
   virtual void appendCrossBuild(OpTpl *bld,int4 secnum);
 };
 
-class Sleigh : public SleighBase {
+// The mutable, per-decode half of a Sleigh translator: the loader, context
+// cache, disassembly cache and pcode cache. It only reads from its SleighBase,
+// so any number of SleighDecoder objects (one per thread) can share a single
+// loaded specification, as long as each has its own ContextDatabase.
+class SleighDecoder {
+  const SleighBase *spec;
   LoadImage *loader;
-  ContextDatabase *context_db;
   ContextCache *cache;
-  mutable DisassemblyCache *discache;
-  mutable PcodeCacher pcode_cache;
-  void clearForDelete(void);
-protected:
-  ParserContext *obtainContext(const Address &addr,int4 state) const;
-  void resolve(ParserContext &pos) const;
-  void resolveHandles(ParserContext &pos) const;
+  DisassemblyCache *discache;
+  SharedDecodeCache *shared;	// Decoded instructions shared with other decoders, or null
+  vector<uintm> contextkey;	// Context at the address being decoded, for -shared-
+  vector<VarnodeData> hitvarnodes; // Varnodes of the last hit on a mapped entry of -shared-
+  AsmPieces asmpieces;		// Reused by printAssembly() and decodeInstruction()
+  PcodeCacher pcode_cache;
+  void checkAlignment(const Address &baseaddr);
+  int4 buildPcode(ParserContext *pos);
+  void resolve(ParserContext &pos);
+  void resolveHandles(ParserContext &pos);
+public:
+  SleighDecoder(const SleighBase *sp,LoadImage *ld,ContextDatabase *c_db);
+  ~SleighDecoder(void);
+  void initialize(void);
+  ParserContext *obtainContext(const Address &addr,int4 state);
+  void allowContextSet(bool val);
+  void setSharedCache(SharedDecodeCache *c) { shared = c; }
+  int4 instructionLength(const Address &baseaddr);
+  int4 oneInstruction(PcodeEmit &emit,const Address &baseaddr);
+  int4 printAssembly(AssemblyEmit &emit,const Address &baseaddr);
+  int4 emitAssembly(AsmPieces &pieces,const Address &baseaddr);
+  void getInstructionBytes(const Address &baseaddr,uint1 *buf);
+  int4 decodeInstruction(InstructionRecord &rec,const Address &baseaddr);
+};
+
+class Sleigh : public SleighBase {
+  ContextDatabase *context_db;
+  SleighDecoder *decoder;	// Decoding state for this translator's own loader
 public:
   Sleigh(LoadImage *ld,ContextDatabase *c_db);
   virtual ~Sleigh(void);
   void reset(LoadImage *ld,ContextDatabase *c_db);
   virtual void initialize(DocumentStorage &store);
+  void initialize(istream &s);	// Restore from a text .sla as it is parsed, without a DOM
   virtual void registerContext(const string &name,int4 sbit,int4 ebit);
   virtual void setContextDefault(const string &nm,uintm val);
   virtual void allowContextSet(bool val) const;
+  void setSharedCache(SharedDecodeCache *c) { decoder->setSharedCache(c); }
   virtual int4 instructionLength(const Address &baseaddr) const;
   virtual int4 oneInstruction(PcodeEmit &emit,const Address &baseaddr) const;
   virtual int4 printAssembly(AssemblyEmit &emit,const Address &baseaddr) const;
+    // Disassembly as typed pieces in a caller-owned buffer, formatted only on demand.
+    int4 emitAssembly (AsmPieces& pieces, const Address& baseaddr) const;
     void getInstructionBytes (const Address& baseaddr, uint1* buf) const;
+    // Disassembly + pcode + raw bytes from a single ParserContext resolution.
+    int4 decodeInstruction (InstructionRecord& rec,
+                            const Address& baseaddr) const;
 
 };
 
@@ -21,31 +21,105 @@
 #include "translate.hh"
 #include "slghsymbol.hh"
 
+/// \brief A precomputed map from register locations to register names
+///
+/// Names are packed into one string table and looked up by id, so a lookup
+/// returns a string_view without copying. Registers sharing a starting offset
+/// form a \e bucket, sorted by increasing size. For each address space holding
+/// registers, a dense table maps every byte offset in the register range to
+/// the bucket starting at or before it. Spaces whose registers are spread too
+/// thinly for a dense table fall back to a binary search over the buckets.
+class RegisterIndex {
+  /// \brief A register within a bucket
+  struct Entry {
+    int4 size;			///< Size of the register in bytes
+    int4 name;			///< Id of the register name
+  };
+  /// \brief Registers starting at the same offset
+  struct Bucket {
+    uintb offset;		///< Starting offset shared by the registers
+    int4 first;			///< Index of the first (smallest) Entry
+    int4 last;			///< One past the index of the last (largest) Entry
+  };
+  /// \brief The registers in one address space
+  struct SpaceTable {
+    uintb minoff;		///< Offset of the first register
+    uintb endoff;		///< One past the last byte of any register
+    vector<Bucket> buckets;	///< Buckets sorted by offset
+    vector<int4> dense;		///< Bucket index for each offset from \e minoff, if built
+  };
+  static const uintb MAX_DENSE;	///< Largest register range given a dense table
+  vector<SpaceTable> spaces;	///< Tables indexed by address space index
+  vector<Entry> entries;	///< Registers, grouped by bucket
+  string chars;			///< Names, packed end to end
+  vector<uint4> namestart;	///< Start of each name in \e chars, plus the end of the last
+  int4 findBucket(const SpaceTable &tab,uintb off) const;	///< Find the bucket starting at or before an offset
+public:
+  void clear(void);		///< Remove all registers
+  void build(const map<VarnodeData,string> &xref);	///< Build the index from the register map
+  bool holdsRegisters(int4 spaceindex) const;	///< Does the given space have any registers
+  int4 numNames(void) const { return namestart.size() - 1; }	///< Get the number of register names
+  string_view getName(int4 id) const;	///< Get a register name by id
+  int4 find(int4 spaceindex,uintb off,int4 size) const;	///< Find the id of the register containing a location
+};
+
+/// \param spaceindex is the index of the address space
+/// \return \b true if at least one register lives in the space
+inline bool RegisterIndex::holdsRegisters(int4 spaceindex) const
+
+{
+  return (spaceindex < spaces.size() && !spaces[spaceindex].buckets.empty());
+}
+
+/// \param id is the name id, as returned by find()
+/// \return the name, valid as long as \b this index is not rebuilt
+inline string_view RegisterIndex::getName(int4 id) const
+
+{
+  return string_view(chars.data() + namestart[id],namestart[id+1] - namestart[id]);
+}
+
 /// \brief Common core of classes that read or write SLEIGH specification files natively.
 ///
 /// This class represents what's in common across the SLEIGH infrastructure between:
 ///   - Reading the various SLEIGH specification files
 ///   - Building and writing out SLEIGH specification files
 class SleighBase : public Translate {
+  friend class SleighStreamHandler;
   static const int4 SLA_FORMAT_VERSION;	///< Current version of the .sla file read/written by SleighBash
   vector<string> userop;		///< Names of user-define p-code ops for \b this Translate object
   map<VarnodeData,string> varnode_xref;	///< A map from Varnodes in the \e register space to register names
+  RegisterIndex regindex;		///< Precomputed lookup from register location to name
+  int4 regspace;			///< Index of the \e register space, or -1
 protected:
   SubtableSymbol *root;		///< The root SLEIGH decoding symbol
   SymbolTable symtab;		///< The SLEIGH symbol table
   uint4 maxdelayslotbytes;	///< Maximum number of bytes in a delay-slot directive
   uint4 unique_allocatemask;	///< Bits that are guaranteed to be zero in the unique allocation scheme
   uint4 numSections;		///< Number of \e named sections
+  bool lazyrestore;		///< Restore decision trees and p-code templates on first use
   void buildXrefs(void);	///< Build register map. Collect user-ops and context-fields.
   void reregisterContext(void);	///< Reregister context fields for a new executable
+  void restoreXmlHeader(const Element *el);	///< Read the attributes of the \<sleigh> tag
+  void restoreXmlChild(const Element *el);	///< Restore one child of the \<sleigh> tag
+  void restoreXmlFinish(void);	///< Finish a restore once every child has been read
   void restoreXml(const Element *el);	///< Read a SLEIGH specification from XML
+  void restoreXml(istream &s);	///< Read a SLEIGH specification from an XML stream, as it is parsed
 public:
   SleighBase(void);		///< Construct an uninitialized translator
   bool isInitialized(void) const { return (root != (SubtableSymbol *)0); }	///< Return \b true if \b this is initialized
+  SubtableSymbol *getRoot(void) const { return root; }	///< Get the root SLEIGH decoding symbol
+  uint4 getMaxDelaySlotBytes(void) const { return maxdelayslotbytes; }	///< Get the maximum delay-slot size in bytes
+  uint4 getUniqueAllocateMask(void) const { return unique_allocatemask; }	///< Get the unique allocation mask
+  void setLazyRestore(bool val) { lazyrestore = val; }	///< Defer restoring decision trees and p-code templates
+  bool isLazyRestore(void) const { return lazyrestore; }	///< Return \b true if restoration is deferred
+  void registerContextFields(ContextDatabase *db) const;	///< Register the context fields with a separate database
   virtual ~SleighBase(void) {}	///< Destructor
   virtual void addRegister(const string &nm,AddrSpace *base,uintb offset,int4 size);
   virtual const VarnodeData &getRegister(const string &nm) const;
   virtual string getRegisterName(AddrSpace *base,uintb off,int4 size) const;
+  virtual string_view getRegisterNameView(AddrSpace *base,uintb off,int4 size) const;
+  virtual int4 getRegisterSpaceIndex(void) const { return regspace; }
   virtual void getAllRegisters(map<VarnodeData,string> &reglist) const;
   virtual void getUserOpNames(vector<string> &res) const;
 
@@ -197,11 +197,19 @@ private:
   bool lenientconflicterrors;	// True if we ignore most pattern conflict errors
   bool warnalllocalcollisions;	// True if local export collisions generate individual warnings
   bool warnallnops;		// True if pcode NOPs generate individual warnings
+  bool treestats;		// True if decision tree build statistics are printed
+  bool cachetrees;		// True if decision trees are kept between compiles (only the trees)
+  bool writedeps;		// True if a Makefile dependency file is written with the output
+  int4 treethreads;		// Threads building decision trees, 0 for one per core
+  string treecache;		// Decision tree cache from the last compile, if any
+  vector<string> sourcefiles;	// Every file read, the slaspec first, then includes
   vector<string> noplist;	// List of individual NOP warnings
   int4 errors;
   void predefinedSymbols(void);
   int4 calcContextVarLayout(int4 start,int4 sz,int4 numbits);
   void buildDecisionTrees(void);
+  int4 restoreDecisionTreeCache(vector<SubtableSymbol *> &alltables,vector<bool> &done,vector<string> &keys);
+  void saveDecisionTreeCache(vector<SubtableSymbol *> &alltables,vector<bool> &clean,vector<string> &keys);
   void buildPatterns(void);
   void checkConsistency(void);
   static int4 findCollision(map<uintb,int4> &local2Operand,const vector<uintb> &locals,int operand);
@@ -230,6 +238,14 @@ public:
   void setLenientConflict(bool val) { lenientconflicterrors = val; }
   void setLocalCollisionWarning(bool val) { warnalllocalcollisions = val; }
   void setAllNopWarning(bool val) { warnallnops = val; }
+  void setTreeStats(bool val) { treestats = val; }
+  void setCacheTrees(bool val) { cachetrees = val; }
+  bool doesCacheTrees(void) const { return cachetrees; }
+  void setDecisionTreeCache(const string &nm) { treecache = nm; }
+  void setWriteDependencies(bool val) { writedeps = val; }
+  void setTreeThreads(int4 val) { treethreads = val; }
+  bool doesWriteDependencies(void) const { return writedeps; }
+  void saveDependencies(ostream &s,const string &target) const;
   void process(void);
 
   // Lexer functions
@@ -37,6 +37,10 @@ public:
   PatternBlock *clone(void) const;
   void shift(int4 sa) { offset += sa; normalize(); }
   int4 getLength(void) const { return offset+nonzerosize; }
+  int4 getOffset(void) const { return offset; }
+  int4 numWords(void) const { return maskvec.size(); }
+  uintm getMaskWord(int4 i) const { return maskvec[i]; }
+  uintm getValueWord(int4 i) const { return valvec[i]; }
   uintm getMask(int4 startbit,int4 size) const;
   uintm getValue(int4 startbit,int4 size) const;
   bool alwaysTrue(void) const { return (nonzerosize==0); }
@@ -71,6 +75,7 @@ class DisjointPattern : public Pattern { // A pattern with no ORs in it
 public:
   virtual int4 numDisjoint(void) const { return 0; }
   virtual DisjointPattern *getDisjoint(int4 i) const { return (DisjointPattern *)0; }
+  const PatternBlock *getPatternBlock(bool context) const { return getBlock(context); }
   uintm getMask(int4 startbit,int4 size,bool context) const;
   uintm getValue(int4 startbit,int4 size,bool context) const;
   int4 getLength(bool context) const;
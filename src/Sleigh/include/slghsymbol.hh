@@ -18,6 +18,7 @@
 
 #include "semantics.hh"
 #include "slghpatexpress.hh"
+#include <atomic>
 
 class SleighBase;		// Forward declaration
 class SleighSymbol {
@@ -78,7 +79,7 @@ public:
   SymbolTable(void) { curscope = (SymbolScope *)0; }
   ~SymbolTable(void);
   SymbolScope *getCurrentScope(void) { return curscope; }
-  SymbolScope *getGlobalScope(void) { return table[0]; }
+  SymbolScope *getGlobalScope(void) const { return table[0]; }
   
   void setCurrentScope(SymbolScope *scope) { curscope = scope; }
   void addScope(void);		// Add new scope off of current scope, make it current
@@ -92,6 +93,8 @@ public:
   void replaceSymbol(SleighSymbol *a,SleighSymbol *b);
   void saveXml(ostream &s) const;
   void restoreXml(const Element *el,SleighBase *trans);
+  void restoreXmlHeader(const Element *el);
+  void restoreXmlChild(const Element *el,int4 i,SleighBase *trans);
   void restoreSymbolHeader(const Element *el);
   void purge(void);
 };
@@ -141,6 +144,48 @@ public:
   virtual void restoreXml(const Element *el,SleighBase *trans);
 };
 
+// The disassembly of one instruction as a list of typed pieces, filled in by
+// Constructor::emitAssembly() rather than printed to a stream. Names and fixed
+// text are copied into a single character buffer, so an AsmPieces that is
+// reused from one instruction to the next stops allocating once it has grown.
+// Numbers stay numbers until appendText() formats them.
+class AsmPieces {
+public:
+  enum piece_type {
+    literal,			// Fixed text from the display section
+    reg,			// A register, with its name and storage
+    name,			// A name from an attach table, or other text
+    constant,			// A signed value, shown in hex
+    address			// An address (inst_start, inst_next, flow destinations)
+  };
+  struct Piece {
+    piece_type type;
+    uint4 start;		// Offset of the text in the character buffer
+    uint4 len;			// Length of the text
+    intb value;			// Value of a constant or address
+    VarnodeData vn;		// Storage of a register
+  };
+private:
+  vector<Piece> pieces;
+  string chars;			// Text of every piece, back to back
+  int4 bodystart;		// Index of the first piece after the mnemonic
+  Piece &addPiece(piece_type tp,const string &text);
+public:
+  AsmPieces(void) { bodystart = 0; }
+  void clear(void) { pieces.clear(); chars.clear(); bodystart = 0; }
+  void addLiteral(const string &text) { addPiece(literal,text); }
+  void addName(const string &text) { addPiece(name,text); }
+  void addRegister(const string &text,const VarnodeData &vn) { addPiece(reg,text).vn = vn; }
+  void addConstant(intb val) { addPiece(constant,string()).value = val; }
+  void addAddress(uintb val) { addPiece(address,string()).value = (intb)val; }
+  void startBody(void) { bodystart = pieces.size(); }
+  int4 getBodyStart(void) const { return bodystart; }
+  int4 numPieces(void) const { return pieces.size(); }
+  const Piece &getPiece(int4 i) const { return pieces[i]; }
+  const char *getText(const Piece &piece) const { return chars.data() + piece.start; }
+  void appendText(string &res,int4 first,int4 last) const;
+};
+
 class Constructor;		// Forward declaration
 // This is the central sleigh object
 class TripleSymbol : public SleighSymbol {
@@ -152,6 +197,7 @@ public:
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const=0;
   virtual int4 getSize(void) const { return 0; }	// Size out of context
   virtual void print(ostream &s,ParserWalker &walker) const=0;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual void collectLocalValues(vector<uintb> &results) const {}
 };
   
@@ -187,6 +233,7 @@ public:
   EpsilonSymbol(const string &nm,AddrSpace *spc) : PatternlessSymbol(nm) { const_space=spc; }
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const;
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual symbol_type getType(void) const { return epsilon_symbol; }
   virtual VarnodeTpl *getVarnode(void) const;
   virtual void saveXml(ostream &s) const;
@@ -205,6 +252,7 @@ public:
   virtual PatternExpression *getPatternExpression(void) const { return patval; }
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const;
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual symbol_type getType(void) const { return value_symbol; }
   virtual void saveXml(ostream &s) const;
   virtual void saveXmlHeader(ostream &s) const;
@@ -221,6 +269,7 @@ public:
   virtual Constructor *resolve(ParserWalker &walker);
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const;
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual symbol_type getType(void) const { return valuemap_symbol; }
   virtual void saveXml(ostream &s) const;
   virtual void saveXmlHeader(ostream &s) const;
@@ -236,6 +285,7 @@ public:
   NameSymbol(const string &nm,PatternValue *pv,const vector<string> &nt) : ValueSymbol(nm,pv) { nametable=nt; checkTableFill(); }
   virtual Constructor *resolve(ParserWalker &walker);
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual symbol_type getType(void) const { return name_symbol; }
   virtual void saveXml(ostream &s) const;
   virtual void saveXmlHeader(ostream &s) const;
@@ -255,6 +305,8 @@ public:
   virtual int4 getSize(void) const { return fix.size; }
   virtual void print(ostream &s,ParserWalker &walker) const {
     s << getName(); }
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const {
+    pieces.addRegister(getName(),fix); }
   virtual void collectLocalValues(vector<uintb> &results) const;
   virtual symbol_type getType(void) const { return varnode_symbol; }
   virtual void saveXml(ostream &s) const;
@@ -304,6 +356,7 @@ public:
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const;
   virtual int4 getSize(void) const;
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual symbol_type getType(void) const { return varnodelist_symbol; }
   virtual void saveXml(ostream &s) const;
   virtual void saveXmlHeader(ostream &s) const;
@@ -350,6 +403,7 @@ public:
   virtual void getFixedHandle(FixedHandle &hnd,ParserWalker &walker) const;
   virtual int4 getSize(void) const;
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual void collectLocalValues(vector<uintb> &results) const;
   virtual symbol_type getType(void) const { return operand_symbol; }
   virtual void saveXml(ostream &s) const;
@@ -368,6 +422,7 @@ public:
   virtual PatternExpression *getPatternExpression(void) const { return patexp; }
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const;
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual symbol_type getType(void) const { return start_symbol; }
   virtual void saveXml(ostream &s) const;
   virtual void saveXmlHeader(ostream &s) const;
@@ -385,6 +440,7 @@ public:
   virtual PatternExpression *getPatternExpression(void) const { return patexp; }
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const;
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual symbol_type getType(void) const { return end_symbol; }
   virtual void saveXml(ostream &s) const;
   virtual void saveXmlHeader(ostream &s) const;
@@ -400,6 +456,7 @@ public:
   virtual PatternExpression *getPatternExpression(void) const { throw SleighError("Cannot use symbol in pattern"); }
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const;
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual symbol_type getType(void) const { return start_symbol; }
   virtual void saveXml(ostream &s) const;
   virtual void saveXmlHeader(ostream &s) const;
@@ -415,6 +472,7 @@ public:
   virtual PatternExpression *getPatternExpression(void) const { throw SleighError("Cannot use symbol in pattern"); }
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const;
   virtual void print(ostream &s,ParserWalker &walker) const;
+  virtual void emit(AsmPieces &pieces,ParserWalker &walker) const;
   virtual symbol_type getType(void) const { return start_symbol; }
   virtual void saveXml(ostream &s) const;
   virtual void saveXmlHeader(ostream &s) const;
@@ -470,8 +528,11 @@ class Constructor {		// This is NOT a symbol
   vector<OperandSymbol *> operands;
   vector<string> printpiece;
   vector<ContextChange *> context; // Context commands
-  ConstructTpl *templ;		// The main p-code section
-  vector<ConstructTpl *> namedtempl; // Other named p-code sections
+  mutable ConstructTpl *templ;	// The main p-code section
+  mutable vector<ConstructTpl *> namedtempl; // Other named p-code sections
+  mutable const Element *templel; // Element holding the p-code sections, if not restored yet
+  SleighBase *templtrans;	// Translator to restore the p-code sections against
+  mutable atomic<bool> templready; // \b true if the p-code sections are available
   int4 minimumlength;		// Minimum length taken up by this constructor in bytes
   uintm id;			// Unique id of constructor within subtable
   int4 firstwhitespace;		// Index of first whitespace piece in -printpiece-
@@ -479,6 +540,8 @@ class Constructor {		// This is NOT a symbol
   int4 lineno;
   mutable bool inerror;                 // An error is associated with this Constructor
   void orderOperands(void);
+  void restoreSection(const Element *el,SleighBase *trans) const;
+  void restoreTemplates(void) const;
 public:
   Constructor(void);		// For use with restoreXml
   Constructor(SubtableSymbol *p);
@@ -502,13 +565,19 @@ public:
   int4 getNumOperands(void) const { return operands.size(); }
   OperandSymbol *getOperand(int4 i) const { return operands[i]; }
   PatternEquation *getPatternEquation(void) const { return pateq; }
-  ConstructTpl *getTempl(void) const { return templ; }
+  ConstructTpl *getTempl(void) const {
+    if (!templready.load(memory_order_acquire)) restoreTemplates();
+    return templ; }
   ConstructTpl *getNamedTempl(int4 secnum) const;
-  int4 getNumSections(void) const { return namedtempl.size(); }
+  int4 getNumSections(void) const {
+    if (!templready.load(memory_order_acquire)) restoreTemplates();
+    return namedtempl.size(); }
   void printInfo(ostream &s) const;
   void print(ostream &s,ParserWalker &pos) const;
   void printMnemonic(ostream &s,ParserWalker &walker) const;
   void printBody(ostream &s,ParserWalker &walker) const;
+  void emitAssembly(AsmPieces &pieces,ParserWalker &walker) const;
+  void emit(AsmPieces &pieces,ParserWalker &walker) const;
   void removeTrailingSpace(void);
   void applyContext(ParserWalkerChange &walker) const {
     vector<ContextChange *>::const_iterator iter;
@@ -527,7 +596,14 @@ public:
 class DecisionProperties {
   vector<string> identerrors;
   vector<string> conflicterrors;
-public:
+  int4 numnodes;		// DecisionNodes split so far
+  int4 numfields;		// Candidate fields scored so far
+public:
+  DecisionProperties(void) { numnodes = 0; numfields = 0; }
+  void countNode(void) { numnodes += 1; }
+  void countField(void) { numfields += 1; }
+  int4 getNumNodes(void) const { return numnodes; }
+  int4 getNumFields(void) const { return numfields; }
   void identicalPattern(Constructor *a,Constructor *b);
   void conflictingPattern(Constructor *a,Constructor *b);
   const vector<string> &getIdentErrors(void) const { return identerrors; }
@@ -535,15 +611,14 @@ public:
 };
 
 class DecisionNode {
+  friend class DecisionTable;
   vector<pair<DisjointPattern *,Constructor *> > list;
   vector<DecisionNode *> children;
   int4 num;			// Total number of patterns we distinguish
   bool contextdecision;		// True if this is decision based on context
   int4 startbit,bitsize;        // Bits in the stream on which to base the decision
   DecisionNode *parent;
-  void chooseOptimalField(void);
-  double getScore(int4 low,int4 size,bool context);
-  int4 getNumFixed(int4 low,int4 size,bool context);
+  void chooseOptimalField(DecisionProperties &props);
   int4 getMaximumLength(bool context);
   void consistentValues(vector<uint4> &bins,DisjointPattern *pat);
 public:
@@ -558,24 +633,70 @@ public:
   void restoreXml(const Element *el,DecisionNode *par,SubtableSymbol *sub);
 };
 
+// A DecisionNode tree lowered into flat arrays when a spec is loaded. The
+// children of a node are contiguous, so a child is found by index instead of
+// through a pointer, and the mask/value words of the patterns at the leaves
+// are stored inline. Resolving a constructor is then a loop, not a recursion.
+class DecisionTable {
+  struct Node {
+    int4 startbit;
+    int4 bitsize;		// 0 for a terminal node
+    bool contextdecision;
+    uint4 first;		// First child in nodes, or first Leaf in leaves if terminal
+    uint4 count;		// Number of children or Leafs
+  };
+  struct Leaf {
+    Constructor *ct;
+    uint4 first;		// First PatternWord of the pattern
+    uint2 numinstr;		// Number of instruction words, followed by
+    uint2 numcontext;		//   the context words
+    bool never;			// Pattern can never match
+  };
+  struct PatternWord {
+    int4 offset;		// Byte offset into the instruction or context stream
+    uintm mask;
+    uintm value;
+  };
+  vector<Node> nodes;
+  vector<Leaf> leaves;
+  vector<PatternWord> words;
+  uint2 addWords(const PatternBlock *block,bool &never);
+  void addLeaf(const DisjointPattern *pat,Constructor *ct);
+public:
+  bool empty(void) const { return nodes.empty(); }
+  void clear(void);
+  void build(const DecisionNode *root);
+  Constructor *resolve(ParserWalker &walker) const;
+};
+
 class SubtableSymbol : public TripleSymbol {
   TokenPattern *pattern;
   bool beingbuilt,errors;
   vector<Constructor *> construct; // All the Constructors in this table
   DecisionNode *decisiontree;
+  DecisionTable table;		// Lowered decisiontree, used for resolving
+  const Element *decisionel;	// \<decision> element, if the tree has not been restored yet
+  atomic<bool> treeready;	// \b true if the decision tree is available
+  void restoreDecision(void);
 public:
-  SubtableSymbol(void) { pattern = (TokenPattern *)0; decisiontree = (DecisionNode *)0; } // For use with restoreXml
+  SubtableSymbol(void) : treeready(true) { pattern = (TokenPattern *)0; decisiontree = (DecisionNode *)0; decisionel = (const Element *)0; } // For use with restoreXml
   SubtableSymbol(const string &nm);
   virtual ~SubtableSymbol(void);
   bool isBeingBuilt(void) const { return beingbuilt; }
   bool isError(void) const { return errors; }
   void addConstructor(Constructor *ct) { ct->setId(construct.size()); construct.push_back(ct); }
   void buildDecisionTree(DecisionProperties &props);
+  bool hasDecisionTree(void) const { return (decisiontree != (DecisionNode *)0); }
+  void saveXmlDecisionTree(ostream &s) const { decisiontree->saveXml(s); }
+  void restoreDecisionTree(const Element *el);
+  void saveXmlTreeInput(ostream &s) const;
   TokenPattern *buildPattern(ostream &s);
   TokenPattern *getPattern(void) const { return pattern; }
   int4 getNumConstructors(void) const { return construct.size(); }
   Constructor *getConstructor(uintm id) const { return construct[id]; }
-  virtual Constructor *resolve(ParserWalker &walker) { return decisiontree->resolve(walker); }
+  virtual Constructor *resolve(ParserWalker &walker) {
+    if (!treeready.load(memory_order_acquire)) restoreDecision();
+    return table.empty() ? decisiontree->resolve(walker) : table.resolve(walker); }
   virtual PatternExpression *getPatternExpression(void) const { throw SleighError("Cannot use subtable in expression"); }
   virtual void getFixedHandle(FixedHandle &hand,ParserWalker &walker) const {
     throw SleighError("Cannot use subtable in expression"); }
@@ -24,6 +24,7 @@
 
 #include "pcoderaw.hh"
 #include "float.hh"
+#include <string_view>
 
 // Some errors specific to the translation unit
 
@@ -457,6 +458,28 @@ public:
     virtual string getRegisterName (AddrSpace* base, uintb off,
                                     int4 size) const = 0;
 
+    /// \brief Get the name of a register without copying it
+    ///
+    /// The same lookup as getRegisterName(), for translators that keep their
+    /// register names in a precomputed table. The view stays valid as long as
+    /// the translator. Translators without such a table return an empty view.
+    /// \param base is the address space containing the location
+    /// \param off is the offset of the location
+    /// \param size is the size of the location
+    /// \return the name of the register, or an empty view
+    virtual string_view getRegisterNameView (AddrSpace* base, uintb off,
+                                             int4 size) const
+    {
+        return string_view ();
+    }
+
+    /// \brief Get the index of the \e register address space
+    ///
+    /// Lets callers recognize register varnodes by comparing space indices
+    /// rather than space names.
+    /// \return the index of the space, or -1 if it is unknown
+    virtual int4 getRegisterSpaceIndex (void) const { return -1; }
+
     /// \brief Get a list of all register names and the corresponding location
     ///
     /// Most processors have a list of named registers and possibly other memory
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <atomic>
 
 using namespace std;
 
@@ -83,18 +84,24 @@ public:
 };
 
 class Element;
+class PackedSource;
 typedef vector<Element *> List;
 
 class Element {
+  friend class PackedSource;
   string name;
   string content;
   vector<string> attr;
   vector<string> value;
+  mutable atomic<const PackedSource *> packed;	// Source of children not unpacked yet, or null
+  const uint1 *packedpos;		// Start of the packed children
+  uint4 packednum;			// Number of packed children
+  void unpackChildren(void) const;
 protected:
   Element *parent;
-  List children;
+  mutable List children;
 public:
-  Element(Element *par) { parent = par; }
+  Element(Element *par) : packed((const PackedSource *)0) { parent = par; }
   ~Element(void);
   void setName(const string &nm) { name = nm; }
   void addContent(const char *str,int4 start,int4 length) { 
@@ -105,7 +112,9 @@ public:
     attr.push_back(nm); value.push_back(vl); }
   Element *getParent(void) const { return parent; }
   const string &getName(void) const { return name; }
-  const List &getChildren(void) const { return children; }
+  const List &getChildren(void) const {
+    if (packed.load(memory_order_acquire) != (const PackedSource *)0) unpackChildren();
+    return children; }
   const string &getContent(void) const { return content; }
   const string &getAttributeValue(const string &nm) const;
   int4 getNumAttributes(void) const { return attr.size(); }
@@ -114,8 +123,12 @@ public:
 };
 
 class Document : public Element {
+  friend class PackedSource;
+  friend class DocumentStorage;
+  PackedSource *source;		// Packed image the elements are unpacked from, if any
 public:
-  Document(void) : Element((Element *)0) {}
+  Document(void) : Element((Element *)0) { source = (PackedSource *)0; }
+  ~Document(void);
   Element *getRoot(void) const { return *children.begin(); }
 };
 
@@ -149,10 +162,12 @@ public:
 class DocumentStorage {
   vector<Document *> doclist;
   map<string,const Element *> tagmap;
+  Document *mapDocument(const string &filename,bool packedonly);
 public:
   ~DocumentStorage(void);
   Document *parseDocument(istream &s);
   Document *openDocument(const string &filename);
+  Document *openPackedDocument(const string &filename);
   void registerTag(const Element *el);
   const Element *getTag(const string &nm) const;
 };
@@ -162,10 +177,26 @@ struct XmlError {
   XmlError(const string &s) { explain = s; }
 };
 
+// xml_parse() hands each element to a ContentHandler as it is scanned and keeps
+// nothing itself.  xml_tree(), and DocumentStorage for a text document, build
+// the complete Element tree, which a DocumentStorage holds until it is destroyed.
+// SleighBase::restoreXml(istream &) restores a text .sla from parse events
+// instead, so only one symbol's elements are in memory at a time.
 extern int4 xml_parse(istream &i,ContentHandler *hand,int4 dbg=0);
+extern int4 xml_parse(const char *buf,uintb len,ContentHandler *hand,int4 dbg=0);
 extern Document *xml_tree(istream &i);
+extern Document *xml_tree(const char *buf,uintb len);
 extern void xml_escape(ostream &s,const char *str);
 
+// Packed (binary) form of an element tree, as written by sleigh-compile -b.
+// An unpacked Document reads its elements from the buffer as their parents'
+// children are first asked for, so the buffer must outlive the Document.
+static const char XML_PACKED_MAGIC[4] = { '\0', 'S', 'L', 'B' };
+static const uint4 XML_PACKED_VERSION = 2;
+extern bool xml_ispacked(const uint1 *buf,uintb len);
+extern void xml_pack(ostream &s,const Element *el);
+extern Document *xml_unpack(const uint1 *buf,uintb len);
+
 // Some helper functions for producing XML
 inline void a_v(ostream &s,const string &attr,const string &val)
 
@@ -65,6 +65,62 @@ void MemoryBank::deconstructValue(uint1 *ptr,uintb val,int4 size,bool bigendian)
   }
 }
 
+void PageJournal::freeSaved(void)
+
+{
+  for(int4 i=0;i<saved.size();++i) {
+    if (saved[i].page != (uint1 *)0)
+      release(saved[i].page);
+  }
+  saved.clear();
+}
+
+/// The page has room for the trailing stamp, which is set to the current epoch.
+/// \return the new uninitialized page
+uint1 *PageJournal::allocate(void) const
+
+{
+  uint1 *page = new uint1[pagesize + sizeof(uint4)];
+  memcpy(page + pagesize,&epoch,sizeof(uint4));
+  return page;
+}
+
+/// Every page currently mapped becomes shared with the new snapshot. Originals
+/// saved for the previous snapshot are no longer reachable and are freed.
+void PageJournal::snapshot(void)
+
+{
+  freeSaved();
+  active = true;
+  epoch += 1;
+}
+
+/// The bank has put every saved page back into place (and freed the pages that
+/// replaced them).  Those originals are shared with the snapshot again.
+void PageJournal::finishRestore(void)
+
+{
+  saved.clear();
+  epoch += 1;
+}
+
+/// Subsequent writes are tracked so that restore() can return the bank to its
+/// current contents. The default implementation does not support snapshots.
+void MemoryBank::snapshot(void)
+
+{
+  throw LowlevelError("Memory bank for "+space->getName()+" does not support snapshots");
+}
+
+/// The bank goes back to its contents at the last snapshot(), which remains in
+/// effect, so restore() can be called repeatedly.
+/// \param touched collects the aligned address of every page that changed
+void MemoryBank::restore(vector<uintb> &touched)
+
+{
+  throw LowlevelError("Memory bank for "+space->getName()+" does not support snapshots");
+}
+
 /// A MemoryBank must be associated with a specific address space, have a
 /// preferred or natural \e wordsize and a natural \e pagesize. Both the \e
 /// wordsize and \e pagesize must be a power of 2.
@@ -418,23 +474,7 @@ void MemoryPageOverlay::insert(uintb addr,uintb val)
 
 {
   uintb pageaddr = addr & ~((uintb)(getPageSize()-1));
-  map<uintb,uint1 *>::iterator iter;
-
-  uint1 *pageptr;
-
-  iter = page.find(pageaddr);
-  if (iter != page.end())
-    pageptr = (*iter).second;
-  else {
-    pageptr = new uint1[getPageSize()];
-    page[pageaddr] = pageptr;
-    if (underlie == (MemoryBank *)0) {
-      for(int4 i=0;i<getPageSize();++i)
-	pageptr[i] = 0;
-    }
-    else
-      underlie->getPage(pageaddr,pageptr,0,getPageSize());
-  }
+  uint1 *pageptr = writablePage(pageaddr,true);
   
   uintb pageoffset = addr & ((uintb)(getPageSize()-1));
   deconstructValue(pageptr + pageoffset,val,getWordSize(),getSpace()->isBigEndian());
@@ -500,26 +540,66 @@ void MemoryPageOverlay::getPage(uintb addr,uint1 *res,int4 skip,int4 size) const
 void MemoryPageOverlay::setPage(uintb addr,const uint1 *val,int4 skip,int4 size)
 
 {
-  map<uintb,uint1 *>::iterator iter;
-  uint1 *pageptr;
+  uint1 *pageptr = writablePage(addr,size != getPageSize());
+  memcpy(pageptr+skip,val,size);
+}
 
-  iter = page.find(addr);
-  if (iter == page.end()) {
-    pageptr = new uint1[getPageSize()];
-    page[addr] = pageptr;
-    if (size != getPageSize()) {
-      if (underlie == (MemoryBank *)0) {
-	for(int4 i=0;i<getPageSize();++i)
-	  pageptr[i] = 0;
-      }
-      else
-	underlie->getPage(addr,pageptr,0,getPageSize());
-    }
+/// If the page is not mapped, it is created and (optionally) filled from the \e underlying
+/// bank. If it is shared with a snapshot, it is copied first.
+/// \param pageaddr is the aligned offset of the page
+/// \param fill is \b true if a new page must hold its initial contents
+/// \return the page bytes, safe to write
+uint1 *MemoryPageOverlay::writablePage(uintb pageaddr,bool fill)
+
+{
+  map<uintb,uint1 *>::iterator iter = page.find(pageaddr);
+  if (iter != page.end()) {
+    uint1 *pageptr = (*iter).second;
+    if (!journal.isShared(pageptr))
+      return pageptr;
+    uint1 *copy = journal.allocate();
+    memcpy(copy,pageptr,getPageSize());
+    journal.record(pageaddr,pageptr);
+    (*iter).second = copy;
+    return copy;
+  }
+  uint1 *pageptr = journal.allocate();
+  page[pageaddr] = pageptr;
+  journal.record(pageaddr,(uint1 *)0);
+  if (fill) {
+    if (underlie == (MemoryBank *)0)
+      memset(pageptr,0,getPageSize());
+    else
+      underlie->getPage(pageaddr,pageptr,0,getPageSize());
   }
-  else
-    pageptr = (*iter).second;
+  return pageptr;
+}
 
-  memcpy(pageptr+skip,val,size);
+/// Pages are not copied; they become shared with the snapshot and are copied
+/// on their next write.
+void MemoryPageOverlay::snapshot(void)
+
+{
+  journal.snapshot();
+}
+
+/// Each page written since the snapshot is freed and its original put back,
+/// pages created since the snapshot are unmapped.
+/// \param touched collects the aligned address of every page that changed
+void MemoryPageOverlay::restore(vector<uintb> &touched)
+
+{
+  const vector<PageJournal::SavedPage> &saved(journal.getSaved());
+  for(int4 i=saved.size()-1;i>=0;--i) {
+    map<uintb,uint1 *>::iterator iter = page.find(saved[i].pageaddr);
+    PageJournal::release((*iter).second);
+    if (saved[i].page == (uint1 *)0)
+      page.erase(iter);
+    else
+      (*iter).second = saved[i].page;
+    touched.push_back(saved[i].pageaddr);
+  }
+  journal.finishRestore();
 }
 
 /// A page overlay memory bank needs all the parameters for a generic memory bank
@@ -529,7 +609,7 @@ void MemoryPageOverlay::setPage(uintb addr,const uint1 *val,int4 skip,int4 size)
 /// \param ps is the number of bytes in a page (must be power of 2)
 /// \param ul is the underlying MemoryBank
 MemoryPageOverlay::MemoryPageOverlay(AddrSpace *spc,int4 ws,int4 ps,MemoryBank *ul)
-  : MemoryBank(spc,ws,ps)
+  : MemoryBank(spc,ws,ps), journal(ps)
 {
   underlie = ul;
 }
@@ -540,7 +620,256 @@ MemoryPageOverlay::~MemoryPageOverlay(void)
   map<uintb,uint1 *>::iterator iter;
 
   for(iter=page.begin();iter!=page.end();++iter)
-    delete [] (*iter).second;
+    PageJournal::release((*iter).second);
+}
+
+/// The number of table levels is chosen so that every page of the space can be
+/// indexed: the bits of the highest offset above the page offset are divided
+/// into groups of LEVEL_BITS.
+/// \param spc is the address space associated with the memory bank
+/// \param ws is the number of bytes in the preferred wordsize (must be power of 2)
+/// \param ps is the number of bytes in a page (must be power of 2)
+/// \param ul is the underlying MemoryBank, or \b null for a zero filled bank
+MemoryPageTable::MemoryPageTable(AddrSpace *spc,int4 ws,int4 ps,MemoryBank *ul)
+  : MemoryBank(spc,ws,ps), journal(ps)
+{
+  underlie = ul;
+  pagemask = (uintb)(ps-1);
+  pageshift = 0;
+  while((1<<pageshift) < ps)
+    pageshift += 1;
+  int4 addrbits = 0;
+  uintb highest = spc->getHighest();
+  while(highest != 0) {
+    addrbits += 1;
+    highest >>= 1;
+  }
+  int4 indexbits = addrbits - pageshift;
+  numlevels = (indexbits <= 0) ? 1 : (indexbits + LEVEL_BITS - 1) / LEVEL_BITS;
+  nativeorder = ((HOST_ENDIAN==1) == spc->isBigEndian());
+  root = new void *[1<<LEVEL_BITS]();
+  flushTlb();
+}
+
+MemoryPageTable::~MemoryPageTable(void)
+
+{
+  freeLevel(root,numlevels-1);
+}
+
+/// \param node is the table level to free
+/// \param level is 0 if the entries of \e node are pages
+void MemoryPageTable::freeLevel(void **node,int4 level)
+
+{
+  for(int4 i=0;i<(1<<LEVEL_BITS);++i) {
+    if (node[i] == (void *)0) continue;
+    if (level == 0)
+      PageJournal::release((uint1 *)node[i]);
+    else
+      freeLevel((void **)node[i],level-1);
+  }
+  delete [] node;
+}
+
+void MemoryPageTable::flushTlb(void) const
+
+{
+  for(int4 i=0;i<TLB_SIZE;++i) {
+    tlb[i].pageaddr = ~((uintb)0);	// Never page aligned, so never matches
+    tlb[i].page = (uint1 *)0;
+  }
+}
+
+/// Descend the table using successive groups of LEVEL_BITS from the page index.
+/// \param pageaddr is the aligned address of the page
+/// \param create is \b true if missing intermediate levels should be allocated
+/// \return the slot holding the page pointer, or \b null if a level is missing
+void **MemoryPageTable::walk(uintb pageaddr,bool create) const
+
+{
+  uintb index = pageaddr >> pageshift;
+  void **node = root;
+  for(int4 level=numlevels-1;level>0;--level) {
+    void **slot = node + ((index >> (level*LEVEL_BITS)) & ((1<<LEVEL_BITS)-1));
+    if (*slot == (void *)0) {
+      if (!create) return (void **)0;
+      *slot = new void *[1<<LEVEL_BITS]();
+    }
+    node = (void **)*slot;
+  }
+  return node + (index & ((1<<LEVEL_BITS)-1));
+}
+
+/// \param pageaddr is the aligned address of the page
+/// \param fill is \b true if the page contents should be copied from the underlying bank
+/// \return the bytes of the new page
+uint1 *MemoryPageTable::createPage(uintb pageaddr,bool fill)
+
+{
+  void **slot = walk(pageaddr,true);
+  uint1 *pageptr = journal.allocate();
+  *slot = pageptr;
+  journal.record(pageaddr,(uint1 *)0);
+  if (fill) {
+    if (underlie == (MemoryBank *)0)
+      memset(pageptr,0,getPageSize());
+    else
+      underlie->getPage(pageaddr,pageptr,0,getPageSize());
+  }
+  TlbEntry &ent(tlb[(pageaddr >> pageshift) & (TLB_SIZE-1)]);
+  ent.pageaddr = pageaddr;
+  ent.page = pageptr;
+  return pageptr;
+}
+
+/// If the page is not mapped it is created. If it is shared with a snapshot it is
+/// copied, and the copy replaces it in the table and the TLB.
+/// \param pageaddr is the aligned address of the page
+/// \param fill is \b true if a new page must hold its initial contents
+/// \return the page bytes, safe to write
+uint1 *MemoryPageTable::writablePage(uintb pageaddr,bool fill)
+
+{
+  uint1 *pageptr = lookupPage(pageaddr);
+  if (pageptr == (uint1 *)0)
+    return createPage(pageaddr,fill);
+  if (!journal.isShared(pageptr))
+    return pageptr;
+  uint1 *copy = journal.allocate();
+  memcpy(copy,pageptr,getPageSize());
+  journal.record(pageaddr,pageptr);
+  *walk(pageaddr,false) = copy;
+  TlbEntry &ent(tlb[(pageaddr >> pageshift) & (TLB_SIZE-1)]);
+  ent.pageaddr = pageaddr;
+  ent.page = copy;
+  return copy;
+}
+
+/// \param addr is the aligned address of the word to be written
+/// \param val is the value to be written at that word
+void MemoryPageTable::insert(uintb addr,uintb val)
+
+{
+  uintb pageaddr = addr & ~pagemask;
+  uint1 *pageptr = writablePage(pageaddr,true);
+  deconstructValue(pageptr + (addr & pagemask),val,getWordSize(),getSpace()->isBigEndian());
+}
+
+/// \param addr is the aligned offset of the word
+/// \return the retrieved value
+uintb MemoryPageTable::find(uintb addr) const
+
+{
+  const uint1 *pageptr = lookupPage(addr & ~pagemask);
+  if (pageptr == (const uint1 *)0) {
+    if (underlie == (MemoryBank *)0)
+      return (uintb)0;
+    return underlie->find(addr);
+  }
+  return constructValue(pageptr + (addr & pagemask),getWordSize(),getSpace()->isBigEndian());
+}
+
+/// \param addr is the aligned offset of the page
+/// \param res is the pointer to where retrieved bytes should be stored
+/// \param skip is the offset \e into \e the \e page from where bytes should be retrieved
+/// \param size is the number of bytes to retrieve
+void MemoryPageTable::getPage(uintb addr,uint1 *res,int4 skip,int4 size) const
+
+{
+  const uint1 *pageptr = lookupPage(addr);
+  if (pageptr == (const uint1 *)0) {
+    if (underlie == (MemoryBank *)0)
+      memset(res,0,size);
+    else
+      underlie->getPage(addr,res,skip,size);
+    return;
+  }
+  memcpy(res,pageptr+skip,size);
+}
+
+/// \param addr is the aligned offset of the page to write
+/// \param val is a pointer to bytes to be written into the page
+/// \param skip is the offset \e into \e the \e page where bytes should be written
+/// \param size is the number of bytes to write
+void MemoryPageTable::setPage(uintb addr,const uint1 *val,int4 skip,int4 size)
+
+{
+  uint1 *pageptr = writablePage(addr,size != getPageSize());
+  memcpy(pageptr+skip,val,size);
+}
+
+/// An access contained in a single mapped page is copied directly from the page,
+/// with a plain memcpy when the space has the host's byte order.  Anything else
+/// takes the general word-based path.
+/// \param offset is the start of the byte range encoding the value
+/// \param size is the number of bytes in the range
+/// \return the decoded value
+uintb MemoryPageTable::getValue(uintb offset,int4 size) const
+
+{
+  uintb skip = offset & pagemask;
+  if ((skip + size <= (uintb)getPageSize())&&(size <= sizeof(uintb))) {
+    const uint1 *pageptr = lookupPage(offset - skip);
+    if (pageptr == (const uint1 *)0) {
+      if (underlie == (MemoryBank *)0)
+	return (uintb)0;
+      return underlie->getValue(offset,size);
+    }
+    pageptr += skip;
+    if (!nativeorder)
+      return constructValue(pageptr,size,getSpace()->isBigEndian());
+    uintb res = 0;
+    memcpy((uint1 *)&res + ((HOST_ENDIAN==1) ? sizeof(uintb) - size : 0),pageptr,size);
+    return res;
+  }
+  return MemoryBank::getValue(offset,size);
+}
+
+/// An access contained in a single page is written directly into the page, mapping
+/// it first if necessary.  Anything else takes the general word-based path.
+/// \param offset is the start of the byte range to write
+/// \param size is the number of bytes in the range to write
+/// \param val is the value to be written
+void MemoryPageTable::setValue(uintb offset,int4 size,uintb val)
+
+{
+  uintb skip = offset & pagemask;
+  if ((skip + size <= (uintb)getPageSize())&&(size <= sizeof(uintb))) {
+    uint1 *pageptr = writablePage(offset - skip,true);
+    pageptr += skip;
+    if (!nativeorder)
+      deconstructValue(pageptr,val,size,getSpace()->isBigEndian());
+    else
+      memcpy(pageptr,(const uint1 *)&val + ((HOST_ENDIAN==1) ? sizeof(uintb) - size : 0),size);
+    return;
+  }
+  MemoryBank::setValue(offset,size,val);
+}
+
+/// Pages are not copied; they become shared with the snapshot and are copied
+/// on their next write.
+void MemoryPageTable::snapshot(void)
+
+{
+  journal.snapshot();
+}
+
+/// Each page written since the snapshot is freed and its original put back,
+/// pages created since the snapshot are unmapped.
+/// \param touched collects the aligned address of every page that changed
+void MemoryPageTable::restore(vector<uintb> &touched)
+
+{
+  const vector<PageJournal::SavedPage> &saved(journal.getSaved());
+  for(int4 i=saved.size()-1;i>=0;--i) {
+    void **slot = walk(saved[i].pageaddr,false);
+    PageJournal::release((uint1 *)*slot);
+    *slot = saved[i].page;
+    touched.push_back(saved[i].pageaddr);
+  }
+  journal.finishRestore();
+  flushTlb();
 }
 
 /// Write the value into the hashtable, using \b addr as a key.
@@ -553,10 +882,12 @@ void MemoryHashOverlay::insert(uintb addr,uintb val)
   uintb offset = (addr>>alignshift) % size;
   for(int4 i=0;i<size;++i) {
     if (address[offset] == addr) { // Address has been seen before
+      if (snapactive) saveSlot(offset);
       value[offset] = val;	   // Replace old value
       return;
     }
     else if (address[offset] == (uintb)0xBADBEEF) { // Address not seen before
+      if (snapactive) saveSlot(offset);
       address[offset] = addr;			    // Claim this hash slot
       value[offset] = val;			    // Set value
       return;
@@ -598,9 +929,11 @@ uintb MemoryHashOverlay::find(uintb addr) const
 /// \param hashsize is the maximum number of entries in the hashtable
 /// \param ul is the underlying memory bank being overlayed
 MemoryHashOverlay::MemoryHashOverlay(AddrSpace *spc,int4 ws,int4 ps,int4 hashsize,MemoryBank *ul)
-  : MemoryBank(spc,ws,ps), address(hashsize,0xBADBEEF), value(hashsize,0)
+  : MemoryBank(spc,ws,ps), address(hashsize,0xBADBEEF), value(hashsize,0), slotstamp(hashsize,0)
 {
   underlie = ul;
+  snapactive = false;
+  epoch = 1;
   collideskip = 1023;
 
   uint4 tmp = ws - 1;
@@ -611,6 +944,154 @@ MemoryHashOverlay::MemoryHashOverlay(AddrSpace *spc,int4 ws,int4 ps,int4 hashsiz
   }
 }
 
+/// The slot's key and value are saved the first time it is written after a snapshot.
+/// \param slot is the index of the slot about to be written
+void MemoryHashOverlay::saveSlot(int4 slot)
+
+{
+  if (slotstamp[slot] == epoch) return;
+  slotstamp[slot] = epoch;
+  saved.emplace_back();
+  saved.back().slot = slot;
+  saved.back().address = address[slot];
+  saved.back().value = value[slot];
+}
+
+/// Slots are saved lazily, the first time each is written after the snapshot.
+void MemoryHashOverlay::snapshot(void)
+
+{
+  saved.clear();
+  snapactive = true;
+  epoch += 1;
+}
+
+/// Every slot written since the snapshot gets its original key and value back.
+/// \param touched collects the page containing every word that changed
+void MemoryHashOverlay::restore(vector<uintb> &touched)
+
+{
+  uintb pagemask = ~((uintb)(getPageSize()-1));
+  for(int4 i=saved.size()-1;i>=0;--i) {
+    const SavedSlot &entry(saved[i]);
+    touched.push_back(address[entry.slot] & pagemask);
+    address[entry.slot] = entry.address;
+    value[entry.slot] = entry.value;
+  }
+  saved.clear();
+  epoch += 1;
+}
+
+/// \param spc is the address space associated with the memory bank
+/// \param ws is the number of bytes in the preferred wordsize (must be power of 2)
+/// \param ps is the number of bytes in a page (must be power of 2)
+/// \param sz is the number of bytes, starting at offset 0, held by the bank
+MemoryFlatBank::MemoryFlatBank(AddrSpace *spc,int4 ws,int4 ps,uintb sz)
+  : MemoryBank(spc,ws,ps)
+{
+  size = (sz + ps - 1) & ~((uintb)(ps-1));	// Round up to whole pages
+  data = new uint1[size]();
+  saved = (uint1 *)0;
+}
+
+MemoryFlatBank::~MemoryFlatBank(void)
+
+{
+  delete [] data;
+  if (saved != (uint1 *)0)
+    delete [] saved;
+}
+
+/// \param addr is the aligned address of the word to be written
+/// \param val is the value to be written at that word
+void MemoryFlatBank::insert(uintb addr,uintb val)
+
+{
+  if (!contains(addr,getWordSize()))
+    throw LowlevelError("Write outside flat memory bank: "+getSpace()->getName());
+  deconstructValue(data + addr,val,getWordSize(),getSpace()->isBigEndian());
+}
+
+/// \param addr is the aligned offset of the word
+/// \return the retrieved value
+uintb MemoryFlatBank::find(uintb addr) const
+
+{
+  if (!contains(addr,getWordSize()))
+    throw LowlevelError("Read outside flat memory bank: "+getSpace()->getName());
+  return constructValue(data + addr,getWordSize(),getSpace()->isBigEndian());
+}
+
+/// \param addr is the aligned offset of the page
+/// \param res is the pointer to where retrieved bytes should be stored
+/// \param skip is the offset \e into \e the \e page from where bytes should be retrieved
+/// \param size is the number of bytes to retrieve
+void MemoryFlatBank::getPage(uintb addr,uint1 *res,int4 skip,int4 size) const
+
+{
+  if (!contains(addr+skip,size))
+    throw LowlevelError("Read outside flat memory bank: "+getSpace()->getName());
+  memcpy(res,data+addr+skip,size);
+}
+
+/// \param addr is the aligned offset of the page to write
+/// \param val is a pointer to bytes to be written into the page
+/// \param skip is the offset \e into \e the \e page where bytes should be written
+/// \param size is the number of bytes to write
+void MemoryFlatBank::setPage(uintb addr,const uint1 *val,int4 skip,int4 size)
+
+{
+  if (!contains(addr+skip,size))
+    throw LowlevelError("Write outside flat memory bank: "+getSpace()->getName());
+  memcpy(data+addr+skip,val,size);
+}
+
+/// \param offset is the start of the byte range encoding the value
+/// \param size is the number of bytes in the range
+/// \return the decoded value
+uintb MemoryFlatBank::getValue(uintb offset,int4 size) const
+
+{
+  if (!contains(offset,size))
+    throw LowlevelError("Read outside flat memory bank: "+getSpace()->getName());
+  return constructValue(data+offset,size,getSpace()->isBigEndian());
+}
+
+/// \param offset is the start of the byte range to write
+/// \param size is the number of bytes in the range to write
+/// \param val is the value to be written
+void MemoryFlatBank::setValue(uintb offset,int4 size,uintb val)
+
+{
+  if (!contains(offset,size))
+    throw LowlevelError("Write outside flat memory bank: "+getSpace()->getName());
+  deconstructValue(data+offset,val,size,getSpace()->isBigEndian());
+}
+
+/// The bank is small, so the snapshot is simply a copy of the array.
+void MemoryFlatBank::snapshot(void)
+
+{
+  if (saved == (uint1 *)0)
+    saved = new uint1[size];
+  memcpy(saved,data,size);
+}
+
+/// \param touched collects the aligned address of every page that changed
+void MemoryFlatBank::restore(vector<uintb> &touched)
+
+{
+  if (saved == (uint1 *)0)
+    throw LowlevelError("No snapshot taken of flat memory bank: "+getSpace()->getName());
+  int4 ps = getPageSize();
+  for(uintb off=0;off<size;off+=ps) {
+    if (memcmp(data+off,saved+off,ps) != 0) {
+      memcpy(data+off,saved+off,ps);
+      touched.push_back(off);
+    }
+  }
+}
+
 /// MemoryBanks associated with specific address spaces must be registers with this MemoryState
 /// via this method.  Each address space that will be used during emulation must be registered
 /// separately.  The MemoryState object does \e not assume responsibility for freeing the MemoryBank
@@ -654,6 +1135,7 @@ void MemoryState::setValue(AddrSpace *spc,uintb off,int4 size,uintb cval)
   if (mspace == (MemoryBank *)0)
     throw LowlevelError("Setting value for unmapped memory space: "+spc->getName());
   mspace->setValue(off,size,cval);
+  notifyWrite(spc,off,size);
 }
 
 /// This is the main interface for reading values from the MemoryState.
@@ -731,5 +1213,102 @@ void MemoryState::setChunk(const uint1 *val,AddrSpace *spc,uintb off,int4 size)
   if (mspace == (MemoryBank *)0)
     throw LowlevelError("Setting chunk of unmapped memory space: "+spc->getName());
   mspace->setChunk(off,size,val);
+  notifyWrite(spc,off,size);
+}
+
+/// Unlike getValue(), the size is not limited to a uintb, so SSE and AVX
+/// registers can be read whole. The bytes are put in significance order
+/// whatever the endianness of the space. A constant fills the low bytes.
+/// \param spc is the address space being queried
+/// \param off is the offset of the value
+/// \param size is the number of bytes to read
+/// \param res receives the value, least significant byte first
+void MemoryState::getWideValue(AddrSpace *spc,uintb off,int4 size,uint1 *res) const
+
+{
+  if (spc->getType() == IPTR_CONSTANT) {
+    for(int4 i=0;i<size;++i) {
+      res[i] = (i < (int4)sizeof(uintb)) ? (uint1)(off >> (8*i)) : 0;
+    }
+    return;
+  }
+  getChunk(res,spc,off,size);
+  if (spc->isBigEndian())
+    reverse(res,res+size);
+}
+
+/// The counterpart of getWideValue(): bytes are given in significance order and
+/// stored according to the endianness of the space.
+/// \param spc is the address space being written
+/// \param off is the offset of the value
+/// \param size is the number of bytes to write
+/// \param val is the value, least significant byte first
+void MemoryState::setWideValue(AddrSpace *spc,uintb off,int4 size,const uint1 *val)
+
+{
+  if (!spc->isBigEndian()) {
+    setChunk(val,spc,off,size);
+    return;
+  }
+  vector<uint1> swapped(val,val+size);
+  reverse(swapped.begin(),swapped.end());
+  setChunk(swapped.data(),spc,off,size);
+}
+
+/// Only one observer can be attached to a space; attaching a new one replaces
+/// the previous.  Passing \b null removes the observer.
+/// \param spc is the address space to watch
+/// \param w is the observer to notify after writes to \e spc
+void MemoryState::setWriteWatch(AddrSpace *spc,MemoryWriteWatch *w)
+
+{
+  int4 index = spc->getIndex();
+
+  while(index >= watch.size())
+    watch.push_back((MemoryWriteWatch *)0);
+
+  watch[index] = w;
+}
+
+/// \param spc is the address space being queried
+/// \return the attached observer or \b null
+MemoryWriteWatch *MemoryState::getWriteWatch(AddrSpace *spc) const
+
+{
+  int4 index = spc->getIndex();
+  if (index >= watch.size())
+    return (MemoryWriteWatch *)0;
+  return watch[index];
+}
+
+/// Every registered MemoryBank takes a checkpoint. Pages are shared rather than
+/// copied, so this costs nothing until memory is written.  Every bank must
+/// support snapshots.
+void MemoryState::snapshot(void)
+
+{
+  for(int4 i=0;i<memspace.size();++i) {
+    if (memspace[i] != (MemoryBank *)0)
+      memspace[i]->snapshot();
+  }
+}
+
+/// Every registered MemoryBank undoes the writes made since the last snapshot().
+/// The cost is proportional to the number of pages touched, not the size of the
+/// state. The write observer for each space is told about every page that changed.
+void MemoryState::restore(void)
+
+{
+  vector<uintb> touched;
+  for(int4 i=0;i<memspace.size();++i) {
+    MemoryBank *bank = memspace[i];
+    if (bank == (MemoryBank *)0) continue;
+    touched.clear();
+    bank->restore(touched);
+    MemoryWriteWatch *w = (i < watch.size()) ? watch[i] : (MemoryWriteWatch *)0;
+    if (w == (MemoryWriteWatch *)0) continue;
+    for(int4 j=0;j<touched.size();++j)
+      w->memoryWritten(bank->getSpace(),touched[j],bank->getPageSize());
+  }
 }
 
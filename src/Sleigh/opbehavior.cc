@@ -149,6 +149,118 @@ uintb OpBehavior::recoverInputBinary(int4 slot,int4 sizeout,uintb out,int4 sizei
   throw LowlevelError("Cannot recover input parameter without loss of information");
 }
 
+/// \brief Read one word of a wide value
+///
+/// \param ptr is the wide value, least significant byte first
+/// \param size is the number of bytes in the value
+/// \param pos is the byte position of the word
+/// \return the (up to) 8 bytes starting at \e pos, with bytes past the end reading as zero
+static uintb wide_word(const uint1 *ptr,int4 size,int4 pos)
+
+{
+  uintb res = 0;
+#if HOST_ENDIAN == 0
+  if (size - pos >= (int4)sizeof(uintb)) {
+    memcpy(&res,ptr+pos,sizeof(uintb));
+    return res;
+  }
+#endif
+  int4 end = pos + (int4)sizeof(uintb);
+  if (end > size) end = size;
+  for(int4 i=end-1;i>=pos;--i)
+    res = (res<<8) | ptr[i];
+  return res;
+}
+
+/// \brief Write one word of a wide value
+///
+/// \param val is the word to write
+/// \param ptr is the wide value, least significant byte first
+/// \param size is the number of bytes in the value
+/// \param pos is the byte position of the word; bytes past \e size are not written
+static void wide_store(uintb val,uint1 *ptr,int4 size,int4 pos)
+
+{
+#if HOST_ENDIAN == 0
+  if (size - pos >= (int4)sizeof(uintb)) {
+    memcpy(ptr+pos,&val,sizeof(uintb));
+    return;
+  }
+#endif
+  int4 end = pos + (int4)sizeof(uintb);
+  if (end > size) end = size;
+  for(int4 i=pos;i<end;++i) {
+    ptr[i] = (uint1)val;
+    val >>= 8;
+  }
+}
+
+/// \brief Copy a wide value into a (possibly larger) output, filling the extra bytes
+///
+/// \param in is the value to copy
+/// \param sizein is the number of bytes in the value
+/// \param out is the output
+/// \param sizeout is the number of bytes in the output
+/// \param fill is the byte to store past the end of the input
+static void wide_extend(const uint1 *in,int4 sizein,uint1 *out,int4 sizeout,uint1 fill)
+
+{
+  int4 num = (sizein < sizeout) ? sizein : sizeout;
+  memmove(out,in,num);
+  if (sizeout > num)
+    memset(out+num,fill,sizeout-num);
+}
+
+/// \brief Read a shift amount or byte offset from a wide value
+///
+/// Amounts that do not fit in 31 bits are clamped, which every user treats as
+/// shifting everything out.
+/// \param ptr is the wide value
+/// \param size is the number of bytes in the value
+/// \return the amount
+static int4 wide_amount(const uint1 *ptr,int4 size)
+
+{
+  for(int4 i=sizeof(uintb);i<size;++i)
+    if (ptr[i] != 0) return 0x7fffffff;
+  uintb val = wide_word(ptr,size,0);
+  return (val > 0x7fffffff) ? 0x7fffffff : (int4)val;
+}
+
+/// The default handles values that fit in a uintb by handing them to evaluateUnary().
+/// \param sizeout is the size of the output in bytes
+/// \param sizein is the size of the input in bytes
+/// \param in1 is the input value, least significant byte first
+/// \param out receives the output value, least significant byte first
+void OpBehavior::evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const
+
+{
+  if (sizeout > (int4)sizeof(uintb) || sizein > (int4)sizeof(uintb)) {
+    string name(get_opname(opcode));
+    throw EvaluationError("Wide emulation unimplemented for "+name);
+  }
+  uintb res = evaluateUnary(sizeout,sizein,wide_word(in1,sizein,0));
+  wide_store(res,out,sizeout,0);
+}
+
+/// The default handles values that fit in a uintb by handing them to evaluateBinary().
+/// \param sizeout is the size of the output in bytes
+/// \param sizein1 is the size of the first input in bytes
+/// \param sizein2 is the size of the second input in bytes
+/// \param in1 is the first input value, least significant byte first
+/// \param in2 is the second input value, least significant byte first
+/// \param out receives the output value, least significant byte first
+void OpBehavior::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  if (sizeout > (int4)sizeof(uintb) || sizein1 > (int4)sizeof(uintb) || sizein2 > (int4)sizeof(uintb)) {
+    string name(get_opname(opcode));
+    throw EvaluationError("Wide emulation unimplemented for "+name);
+  }
+  uintb res = evaluateBinary(sizeout,sizein1,wide_word(in1,sizein1,0),wide_word(in2,sizein2,0));
+  wide_store(res,out,sizeout,0);
+}
+
 uintb OpBehaviorCopy::evaluateUnary(int4 sizeout,int4 sizein,uintb in1) const
 
 {
@@ -378,6 +490,7 @@ uintb OpBehaviorIntOr::evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb i
 uintb OpBehaviorIntLeft::evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const
 
 {
+  if ((in2 >= 8*sizeout)||(in2 >= 8*sizeof(uintb))) return 0; // Keeps the host shift in range
   uintb res = (in1 << in2) & calc_mask(sizeout);
   return res;
 }
@@ -397,6 +510,7 @@ uintb OpBehaviorIntLeft::recoverInputBinary(int4 slot,int4 sizeout,uintb out,int
 uintb OpBehaviorIntRight::evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uintb in2) const
 
 {
+  if ((in2 >= 8*sizeout)||(in2 >= 8*sizeof(uintb))) return 0;
   uintb res = (in1&calc_mask(sizeout)) >> in2;
   return res;
 }
@@ -417,6 +531,8 @@ uintb OpBehaviorIntSright::evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uin
 
 {
   uintb res;
+  if ((in2 >= 8*sizein)||(in2 >= 8*sizeof(uintb))) // Every bit is a copy of the sign
+    return signbit_negative(in1,sizein) ? calc_mask(sizein) : 0;
   if (signbit_negative(in1,sizein)) {
     res = in1 >> in2;
     uintb mask = calc_mask(sizein);
@@ -725,3 +841,226 @@ uintb OpBehaviorSubpiece::evaluateBinary(int4 sizeout,int4 sizein,uintb in1,uint
   return res;
 }
 
+// Wide evaluation of the common integer ops works a uintb word at a time, so
+// 16 and 32 byte values take two or four iterations of each loop.
+
+void OpBehaviorCopy::evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const
+
+{
+  wide_extend(in1,sizein,out,sizeout,0);
+}
+
+void OpBehaviorEqual::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  bool res = (sizein1 == sizein2) && (memcmp(in1,in2,sizein1) == 0);
+  memset(out,0,sizeout);
+  out[0] = res ? 1 : 0;
+}
+
+void OpBehaviorNotEqual::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  bool res = (sizein1 != sizein2) || (memcmp(in1,in2,sizein1) != 0);
+  memset(out,0,sizeout);
+  out[0] = res ? 1 : 0;
+}
+
+void OpBehaviorIntZext::evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const
+
+{
+  wide_extend(in1,sizein,out,sizeout,0);
+}
+
+void OpBehaviorIntSext::evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const
+
+{
+  uint1 fill = ((in1[sizein-1] & 0x80) != 0) ? 0xff : 0;
+  wide_extend(in1,sizein,out,sizeout,fill);
+}
+
+void OpBehaviorIntAdd::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  uintb carry = 0;
+  for(int4 pos=0;pos<sizeout;pos+=sizeof(uintb)) {
+    uintb a = wide_word(in1,sizein1,pos);
+    uintb sum = a + wide_word(in2,sizein2,pos);
+    uintb nextcarry = (sum < a) ? 1 : 0;
+    sum += carry;
+    if (sum < carry) nextcarry = 1;
+    wide_store(sum,out,sizeout,pos);
+    carry = nextcarry;
+  }
+}
+
+void OpBehaviorIntSub::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  uintb borrow = 0;
+  for(int4 pos=0;pos<sizeout;pos+=sizeof(uintb)) {
+    uintb a = wide_word(in1,sizein1,pos);
+    uintb b = wide_word(in2,sizein2,pos);
+    uintb diff = a - b - borrow;
+    borrow = (a < b || (a == b && borrow != 0)) ? 1 : 0;
+    wide_store(diff,out,sizeout,pos);
+  }
+}
+
+/// \brief Multiply two words into a double word
+///
+/// \param a is the first word
+/// \param b is the second word
+/// \param hi receives the most significant word of the product
+/// \return the least significant word of the product
+static uintb wide_mult_word(uintb a,uintb b,uintb &hi)
+
+{
+#if defined(UINTB8) && defined(__SIZEOF_INT128__)
+  unsigned __int128 prod = (unsigned __int128)a * b;
+  hi = (uintb)(prod >> 64);
+  return (uintb)prod;
+#else
+  int4 half = 4 * sizeof(uintb);
+  uintb mask = (((uintb)1) << half) - 1;
+  uintb alo = a & mask;
+  uintb ahi = a >> half;
+  uintb blo = b & mask;
+  uintb bhi = b >> half;
+  uintb lolo = alo * blo;
+  uintb lohi = alo * bhi;
+  uintb hilo = ahi * blo;
+  uintb mid = (lolo >> half) + (lohi & mask) + (hilo & mask);
+  hi = ahi * bhi + (lohi >> half) + (hilo >> half) + (mid >> half);
+  return (mid << half) | (lolo & mask);
+#endif
+}
+
+/// Schoolbook multiplication a word at a time. Each partial product is added
+/// straight into the output, and the words past \e sizeout are never formed,
+/// so the result is the product truncated to the output size.
+void OpBehaviorIntMult::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  memset(out,0,sizeout);
+  for(int4 i=0;i<sizeout && i<sizein1;i+=sizeof(uintb)) {
+    uintb a = wide_word(in1,sizein1,i);
+    if (a == 0) continue;
+    uintb carry = 0;
+    for(int4 pos=i;pos<sizeout;pos+=sizeof(uintb)) {
+      uintb hi;
+      uintb lo = wide_mult_word(a,wide_word(in2,sizein2,pos-i),hi);
+      lo += carry;
+      if (lo < carry) hi += 1;
+      uintb acc = wide_word(out,sizeout,pos);
+      lo += acc;
+      if (lo < acc) hi += 1;
+      wide_store(lo,out,sizeout,pos);
+      carry = hi;
+    }
+  }
+}
+
+void OpBehaviorInt2Comp::evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const
+
+{
+  uintb carry = 1;
+  for(int4 pos=0;pos<sizeout;pos+=sizeof(uintb)) {
+    uintb val = ~wide_word(in1,sizein,pos) + carry;
+    carry = (carry != 0 && val == 0) ? 1 : 0;
+    wide_store(val,out,sizeout,pos);
+  }
+}
+
+void OpBehaviorIntNegate::evaluateUnaryWide(int4 sizeout,int4 sizein,const uint1 *in1,uint1 *out) const
+
+{
+  for(int4 pos=0;pos<sizeout;pos+=sizeof(uintb))
+    wide_store(~wide_word(in1,sizein,pos),out,sizeout,pos);
+}
+
+void OpBehaviorIntXor::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  for(int4 pos=0;pos<sizeout;pos+=sizeof(uintb))
+    wide_store(wide_word(in1,sizein1,pos) ^ wide_word(in2,sizein2,pos),out,sizeout,pos);
+}
+
+void OpBehaviorIntAnd::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  for(int4 pos=0;pos<sizeout;pos+=sizeof(uintb))
+    wide_store(wide_word(in1,sizein1,pos) & wide_word(in2,sizein2,pos),out,sizeout,pos);
+}
+
+void OpBehaviorIntOr::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  for(int4 pos=0;pos<sizeout;pos+=sizeof(uintb))
+    wide_store(wide_word(in1,sizein1,pos) | wide_word(in2,sizein2,pos),out,sizeout,pos);
+}
+
+void OpBehaviorIntLeft::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  int4 amount = wide_amount(in2,sizein2);
+  int4 bytes = amount / 8;
+  int4 bits = amount % 8;
+  for(int4 i=sizeout-1;i>=0;--i) {
+    int4 src = i - bytes;
+    uint1 hi = (src >= 0 && src < sizein1) ? in1[src] : 0;
+    uint1 lo = (src >= 1 && src <= sizein1) ? in1[src-1] : 0;
+    out[i] = (bits == 0) ? hi : (uint1)((hi << bits) | (lo >> (8-bits)));
+  }
+}
+
+void OpBehaviorIntRight::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  int4 amount = wide_amount(in2,sizein2);
+  int4 bytes = amount / 8;
+  int4 bits = amount % 8;
+  for(int4 i=0;i<sizeout;++i) {
+    int4 src = (bytes < sizein1) ? i + bytes : sizein1;
+    uint1 lo = (src < sizein1) ? in1[src] : 0;
+    uint1 hi = (src + 1 < sizein1) ? in1[src+1] : 0;
+    out[i] = (bits == 0) ? lo : (uint1)((lo >> bits) | (hi << (8-bits)));
+  }
+}
+
+void OpBehaviorIntSright::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  int4 amount = wide_amount(in2,sizein2);
+  int4 bytes = amount / 8;
+  int4 bits = amount % 8;
+  uint1 fill = ((in1[sizein1-1] & 0x80) != 0) ? 0xff : 0;
+  for(int4 i=0;i<sizeout;++i) {
+    int4 src = (bytes < sizein1) ? i + bytes : sizein1;
+    uint1 lo = (src < sizein1) ? in1[src] : fill;
+    uint1 hi = (src + 1 < sizein1) ? in1[src+1] : fill;
+    out[i] = (bits == 0) ? lo : (uint1)((lo >> bits) | (hi << (8-bits)));
+  }
+}
+
+void OpBehaviorPiece::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  if (sizein2 >= sizeout) {
+    memmove(out,in2,sizeout);
+    return;
+  }
+  memmove(out,in2,sizein2);
+  wide_extend(in1,sizein1,out+sizein2,sizeout-sizein2,0);
+}
+
+void OpBehaviorSubpiece::evaluateBinaryWide(int4 sizeout,int4 sizein1,int4 sizein2,const uint1 *in1,const uint1 *in2,uint1 *out) const
+
+{
+  int4 offset = wide_amount(in2,sizein2);
+  if (offset >= sizein1) {
+    memset(out,0,sizeout);
+    return;
+  }
+  wide_extend(in1+offset,sizein1-offset,out,sizeout,0);
+}
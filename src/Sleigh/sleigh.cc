@@ -18,8 +18,15 @@
  */
 #include "sleigh.hh"
 #include "loadimage.hh"
+#include <cstdio>
 #include <cstring>
 #include <iostream>
+#include <fstream>
+#include <type_traits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 PcodeCacher::PcodeCacher (void)
 
@@ -134,22 +141,15 @@ void PcodeCacher::emit (const Address& addr, PcodeEmit* emt) const
                    (*iter).isize);
 }
 
-vector<struct PcodeData> PcodeCacher::hutch_emitIR () const
-
+void PcodeCacher::hutch_emitIR (vector<PcodeData>& res) const
+// Copy the cached ops into -res-. Only the ops are copied: PcodeData does not
+// own its varnodes, so the copies point into this pool and are valid until
+// the pool is cleared for the next instruction. Nothing is allocated for the
+// varnodes and there is nothing for the caller to free.
 {
-    vector<PcodeData> result;
-    struct PcodeData tmp;
-    vector<PcodeData>::const_iterator iter;
-
-    for (iter = issued.begin (); iter != issued.end (); ++iter) {
-        tmp.outvar = (*iter).outvar;
-        tmp.invar = (*iter).invar;
-        tmp.isize = (*iter).isize;
-        tmp.opc = (*iter).opc;
-
-        result.push_back (tmp);
-    }
-    return result;
+    static_assert (is_trivially_copyable<PcodeData>::value,
+                   "PcodeData must stay a non-owning view of its varnodes");
+    res.assign (issued.begin (), issued.end ());
 }
 
 void SleighBuilder::generateLocation (const VarnodeTpl* vntpl, VarnodeData& vn)
@@ -457,62 +457,527 @@ ParserContext* DisassemblyCache::getParserContext (const Address& addr)
     return res;
 }
 
-Sleigh::Sleigh (LoadImage* ld, ContextDatabase* c_db) : SleighBase ()
+DecodedInstruction::DecodedInstruction (const Address& a, const uintm* ctx,
+                                        int4 ctxsize,
+                                        const InstructionRecord& rec)
+    : addr (a), context (ctx, ctx + ctxsize)
+{
+    ctxbytes = (const uint1*)context.data ();
+    this->ctxsize = ctxsize;
+    record = (const uint1*)0;
+    text = (const uint1*)0;
+    recordsize = 0;
+    numvarnodes = 0;
+    spaces = (const AddrSpaceManager*)0;
+    persisted = false;
+    length = rec.length;
+    fallthrough = rec.fallthrough;
+    mnem = rec.mnem;
+    body = rec.body;
+    memcpy (bytes, rec.bytes, sizeof (bytes));
+
+    // Size the varnode storage up front so the pointers below stay put
+    uint4 num = 0;
+    for (const PcodeData& op : rec.pcode)
+        num += op.isize + ((op.outvar != (VarnodeData*)0) ? 1 : 0);
+    varnodes.reserve (num);
+    pcode.reserve (rec.pcode.size ());
+    for (const PcodeData& op : rec.pcode) {
+        pcode.emplace_back (op.opc, (VarnodeData*)0, (VarnodeData*)0,
+                            op.isize);
+        PcodeData& copy (pcode.back ());
+        if (op.outvar != (VarnodeData*)0) {
+            varnodes.push_back (*op.outvar);
+            copy.outvar = &varnodes.back ();
+        }
+        if (op.isize != 0) {
+            copy.invar = varnodes.data () + varnodes.size ();
+            varnodes.insert (varnodes.end (), op.invar, op.invar + op.isize);
+        }
+    }
+}
+
+bool DecodedInstruction::matches (const Address& a, const uintm* ctx,
+                                  int4 ctxsize) const
 
 {
-    loader = ld;
-    context_db = c_db;
-    cache = new ContextCache (c_db);
-    discache = (DisassemblyCache*)0;
+    if (addr != a || this->ctxsize != ctxsize)
+        return false;
+    return (memcmp (ctxbytes, ctx, ctxsize * sizeof (uintm)) == 0);
 }
 
-void Sleigh::clearForDelete (void)
+// Cache file layout, in host byte order: magic, version, key, then one
+// record per instruction, each prefixed by its length in bytes so a record
+// cut short by an interrupted append is dropped on the next load.
+//
+//   space index, offset, context size, context words,
+//   length, fallthrough, mnemonic, body, instruction bytes,
+//   op count, then per op: opcode, input count, output flag, varnodes
+//
+// A varnode is its space index, offset and size. Strings are a length and
+// the characters.
+
+template <typename T>
+static void putRaw (string& buf, T val)
+{
+    buf.append ((const char*)&val, sizeof (T));
+}
 
+template <typename T>
+static bool getRaw (const uint1*& ptr, const uint1* end, T& val)
 {
-    delete cache;
-    if (discache != (DisassemblyCache*)0)
-        delete discache;
+    if ((uintb)(end - ptr) < sizeof (T))
+        return false;
+    memcpy (&val, ptr, sizeof (T));
+    ptr += sizeof (T);
+    return true;
 }
 
-Sleigh::~Sleigh (void)
+static void putVarnode (string& buf, const VarnodeData& vn)
+{
+    putRaw<int4> (buf, vn.space->getIndex ());
+    putRaw<uintb> (buf, vn.offset);
+    putRaw<uint4> (buf, vn.size);
+}
 
+static bool getVarnode (const uint1*& ptr, const uint1* end,
+                        const AddrSpaceManager* spaces, VarnodeData& vn)
 {
-    clearForDelete ();
+    int4 index;
+    if (!getRaw (ptr, end, index) || !getRaw (ptr, end, vn.offset) ||
+        !getRaw (ptr, end, vn.size))
+        return false;
+    if (index < 0 || index >= spaces->numSpaces ())
+        return false;
+    vn.space = spaces->getSpace (index);
+    return (vn.space != (AddrSpace*)0);
 }
 
-void Sleigh::reset (LoadImage* ld, ContextDatabase* c_db)
+static bool getString (const uint1*& ptr, const uint1* end, string& str)
+{
+    uint4 len;
+    if (!getRaw (ptr, end, len) || (uintb)(end - ptr) < len)
+        return false;
+    str.assign ((const char*)ptr, len);
+    ptr += len;
+    return true;
+}
 
-{ // Completely clear everything except the base and reconstruct
-    // with a new loader and context
-    clearForDelete ();
-    pcode_cache.clear ();
+static bool skipString (const uint1*& ptr, const uint1* end)
+{
+    uint4 len;
+    if (!getRaw (ptr, end, len) || (uintb)(end - ptr) < len)
+        return false;
+    ptr += len;
+    return true;
+}
+
+static bool getPcode (const uint1*& ptr, const uint1* end,
+                      const AddrSpaceManager* spaces, vector<PcodeData>* pcode,
+                      vector<VarnodeData>* varnodes, uint4& numvarnodes)
+// Read the op count and the ops after it, counting their varnodes into
+// -numvarnodes-. If -pcode- is null the ops are only checked, otherwise
+// they go to -pcode- and their varnodes to -varnodes-, whose capacity must
+// already cover them so the pointers stay put.
+{
+    uint4 numops;
+    if (!getRaw (ptr, end, numops))
+        return false;
+    numvarnodes = 0;
+    VarnodeData vn;
+    for (uint4 i = 0; i < numops; ++i) {
+        int4 opc, isize;
+        uint1 hasout;
+        if (!getRaw (ptr, end, opc) || !getRaw (ptr, end, isize) ||
+            !getRaw (ptr, end, hasout) || (opc <= 0) || (opc >= CPUI_MAX) ||
+            (isize < 0))
+            return false;
+        int4 num = isize + ((hasout != 0) ? 1 : 0);
+        numvarnodes += num;
+        if (pcode == (vector<PcodeData>*)0) {
+            for (int4 j = 0; j < num; ++j)
+                if (!getVarnode (ptr, end, spaces, vn))
+                    return false;
+            continue;
+        }
+        for (int4 j = 0; j < num; ++j) {
+            varnodes->emplace_back ();
+            if (!getVarnode (ptr, end, spaces, varnodes->back ()))
+                return false;
+        }
+        VarnodeData* first = varnodes->data () + varnodes->size () - num;
+        pcode->emplace_back ((OpCode)opc, (VarnodeData*)0, (VarnodeData*)0,
+                             isize);
+        if (hasout != 0)
+            pcode->back ().outvar = first++;
+        if (isize != 0)
+            pcode->back ().invar = first;
+    }
+    return true;
+}
+
+void DecodedInstruction::fill (InstructionRecord& rec,
+                               vector<VarnodeData>& scratch) const
+// The pcode handed out points into this entry, or for an entry read from a
+// cache file into -scratch-, either of which outlives any use of -rec- the
+// caller can make before the next decode.
+{
+    rec.length = length;
+    rec.fallthrough = fallthrough;
+    memcpy (rec.bytes, bytes, sizeof (bytes));
+    if (record == (const uint1*)0) {
+        rec.mnem = mnem;
+        rec.body = body;
+        rec.pcode = pcode;
+        return;
+    }
+    // Checked by SharedDecodeCache::readRecord() when the file was loaded
+    const uint1* ptr = text;
+    const uint1* end = record + recordsize;
+    uint4 num;
+    getString (ptr, end, rec.mnem);
+    getString (ptr, end, rec.body);
+    ptr += sizeof (bytes);
+    scratch.clear ();
+    scratch.reserve (numvarnodes);
+    rec.pcode.clear ();
+    getPcode (ptr, end, spaces, &rec.pcode, &scratch, num);
+}
+
+SharedDecodeCache::SharedDecodeCache (int4 size)
+
+{
+    mask = size - 1;
+    uintb masktest = coveringmask ((uintb)mask);
+    if (size <= 0 || masktest != (uintb)mask) // -size- must be a power of 2
+        throw LowlevelError ("Bad size for shared decode cache");
+    table = new atomic<const DecodedInstruction*>[size];
+    for (int4 i = 0; i < size; ++i)
+        table[i].store ((const DecodedInstruction*)0, memory_order_relaxed);
+}
+
+SharedDecodeCache::~SharedDecodeCache (void)
+
+{
+    clear ();
+    delete[] table;
+}
+
+uint4 SharedDecodeCache::hashKey (const Address& addr, const uint1* ctx,
+                                  int4 ctxsize)
+// -ctx- is read a word at a time, it need not be aligned
+{
+    uintb h = addr.getOffset () * 0x9e3779b97f4a7c15ULL;
+    for (int4 i = 0; i < ctxsize; ++i) {
+        uintm word;
+        memcpy (&word, ctx + i * sizeof (uintm), sizeof (uintm));
+        h = (h ^ word) * 0x100000001b3ULL;
+    }
+    return (uint4)(h ^ (h >> 29));
+}
+
+const DecodedInstruction* SharedDecodeCache::find (const Address& addr,
+                                                   const uintm* ctx,
+                                                   int4 ctxsize) const
+// Return the cached instruction decoded at -addr- under context -ctx-, or null
+{
+    uint4 slot = hashKey (addr, (const uint1*)ctx, ctxsize);
+    for (int4 i = 0; i < PROBE; ++i) {
+        const DecodedInstruction* entry =
+            table[(slot + i) & mask].load (memory_order_acquire);
+        if (entry == (const DecodedInstruction*)0)
+            return (const DecodedInstruction*)0;
+        if (entry->matches (addr, ctx, ctxsize))
+            return entry;
+    }
+    return (const DecodedInstruction*)0;
+}
+
+bool SharedDecodeCache::publish (DecodedInstruction* insn)
+// Store -insn- in a free slot of its probe. Returns false, leaving -insn- to
+// the caller, if another thread got there first or there is no free slot.
+{
+    uint4 slot = hashKey (insn->addr, insn->ctxbytes, insn->ctxsize);
+    for (int4 i = 0; i < PROBE; ++i) {
+        atomic<const DecodedInstruction*>& cell = table[(slot + i) & mask];
+        const DecodedInstruction* entry = cell.load (memory_order_acquire);
+        while (entry == (const DecodedInstruction*)0) {
+            if (cell.compare_exchange_weak (entry, insn, memory_order_release,
+                                            memory_order_acquire))
+                return true;
+        }
+        if ((entry->addr == insn->addr) && (entry->ctxsize == insn->ctxsize) &&
+            (memcmp (entry->ctxbytes, insn->ctxbytes,
+                     insn->ctxsize * sizeof (uintm)) == 0))
+            break;
+    }
+    return false;
+}
+
+void SharedDecodeCache::insert (DecodedInstruction* insn)
+// Take ownership of -insn- and publish it, or delete it if it cannot be
+{
+    if (!publish (insn))
+        delete insn;
+}
+
+void SharedDecodeCache::clear (void)
+
+{
+    for (uint4 i = 0; i <= mask; ++i) {
+        const DecodedInstruction* entry = table[i].load (memory_order_relaxed);
+        if ((entry != (const DecodedInstruction*)0) &&
+            (entry->record == (const uint1*)0))
+            delete entry;
+        table[i].store ((const DecodedInstruction*)0, memory_order_relaxed);
+    }
+    for (const Mapping& mapping : mappings) {
+        delete[] mapping.entries;
+        munmap (mapping.base, mapping.size);
+    }
+    mappings.clear ();
+}
+
+void SharedDecodeCache::writeRecord (ostream& s, const DecodedInstruction* insn)
+
+{
+    if (insn->record != (const uint1*)0) {
+        // Still as it was read
+        s.write ((const char*)&insn->recordsize, sizeof (insn->recordsize));
+        s.write ((const char*)insn->record, insn->recordsize);
+        return;
+    }
+    string buf;
+    putRaw<int4> (buf, insn->addr.getSpace ()->getIndex ());
+    putRaw<uintb> (buf, insn->addr.getOffset ());
+    putRaw<uint4> (buf, insn->ctxsize);
+    for (uintm word : insn->context)
+        putRaw<uintm> (buf, word);
+    putRaw<int4> (buf, insn->length);
+    putRaw<int4> (buf, insn->fallthrough);
+    putRaw<uint4> (buf, insn->mnem.size ());
+    buf += insn->mnem;
+    putRaw<uint4> (buf, insn->body.size ());
+    buf += insn->body;
+    buf.append ((const char*)insn->bytes, sizeof (insn->bytes));
+    putRaw<uint4> (buf, insn->pcode.size ());
+    for (const PcodeData& op : insn->pcode) {
+        putRaw<int4> (buf, op.opc);
+        putRaw<int4> (buf, op.isize);
+        putRaw<uint1> (buf, (op.outvar != (VarnodeData*)0) ? 1 : 0);
+        if (op.outvar != (VarnodeData*)0)
+            putVarnode (buf, *op.outvar);
+        for (int4 i = 0; i < op.isize; ++i)
+            putVarnode (buf, op.invar[i]);
+    }
+    uint4 len = buf.size ();
+    s.write ((const char*)&len, sizeof (len));
+    s.write (buf.data (), buf.size ());
+}
+
+bool SharedDecodeCache::readRecord (const uint1* ptr, const uint1* end,
+                                    const AddrSpaceManager* spaces,
+                                    DecodedInstruction& insn)
+// Point -insn- at the record in [ptr,end), checking all of it once so that
+// fill() can read it back without checks. Returns false if the record is
+// damaged or does not fit -spaces-.
+{
+    insn.record = ptr;
+    insn.recordsize = end - ptr;
+    int4 index;
+    uintb offset;
+    uint4 ctxsize;
+    if (!getRaw (ptr, end, index) || !getRaw (ptr, end, offset) ||
+        !getRaw (ptr, end, ctxsize) ||
+        (uintb)(end - ptr) < (uintb)ctxsize * sizeof (uintm))
+        return false;
+    insn.ctxbytes = ptr;
+    insn.ctxsize = ctxsize;
+    ptr += ctxsize * sizeof (uintm);
+    if ((index < 0) || (index >= spaces->numSpaces ()) ||
+        (spaces->getSpace (index) == (AddrSpace*)0) ||
+        !getRaw (ptr, end, insn.length) || !getRaw (ptr, end, insn.fallthrough))
+        return false;
+    insn.text = ptr;
+    if (!skipString (ptr, end) || !skipString (ptr, end) ||
+        !getRaw (ptr, end, insn.bytes) || (insn.length <= 0) ||
+        (insn.length > InstructionRecord::MAX_INSN_LEN) ||
+        !getPcode (ptr, end, spaces, (vector<PcodeData>*)0,
+                   (vector<VarnodeData>*)0, insn.numvarnodes))
+        return false;
+    insn.addr = Address (spaces->getSpace (index), offset);
+    insn.spaces = spaces;
+    insn.persisted = true;
+    return true;
+}
+
+int4 SharedDecodeCache::loadFile (const string& path, uint8 key,
+                                  const AddrSpaceManager* spaces)
+// Map the cache file at -path- and add its entries, which are read from the
+// mapping as they are hit. Returns the number of entries added, or -1 if
+// there is no usable file for -key-.
+{
+    int fd = open (path.c_str (), O_RDONLY);
+    if (fd < 0)
+        return -1;
+    struct stat st;
+    uint4 hdrsize = 2 * sizeof (uint4) + sizeof (uint8);
+    if ((fstat (fd, &st) != 0) || (st.st_size < (off_t)hdrsize)) {
+        close (fd);
+        return -1;
+    }
+    void* map = mmap ((void*)0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close (fd);
+    if (map == MAP_FAILED)
+        return -1;
+    const uint1* ptr = (const uint1*)map;
+    const uint1* end = ptr + st.st_size;
+    uint4 magic = 0, version = 0;
+    uint8 filekey = 0;
+    getRaw (ptr, end, magic);
+    getRaw (ptr, end, version);
+    getRaw (ptr, end, filekey);
+    if ((magic != FILE_MAGIC) || (version != FILE_VERSION) || (filekey != key)) {
+        munmap (map, st.st_size);
+        return -1;
+    }
+    // Every entry goes in one array, sized by a pass over the length prefixes
+    const uint1* start = ptr;
+    uint4 len;
+    int4 num = 0;
+    while (getRaw (ptr, end, len) && ((uintb)(end - ptr) >= len)) {
+        ptr += len;
+        num += 1;
+    }
+    if (num == 0) {
+        munmap (map, st.st_size);
+        return 0;
+    }
+    Mapping mapping;
+    mapping.base = map;
+    mapping.size = st.st_size;
+    mapping.entries = new DecodedInstruction[num];
+    mappings.push_back (mapping);
+    int4 count = 0;
+    ptr = start;
+    for (int4 i = 0; i < num; ++i) {
+        getRaw (ptr, end, len);
+        DecodedInstruction& insn (mapping.entries[i]);
+        if (readRecord (ptr, ptr + len, spaces, insn) && publish (&insn))
+            count += 1;
+        ptr += len;
+    }
+    return count;
+}
+
+int4 SharedDecodeCache::saveFile (const string& path, uint8 key)
+// Append every entry not yet in the file at -path-. If the file is missing
+// or was written for a different -key-, it is started over with everything
+// in the cache. A record cut short by an earlier interrupted save is dropped
+// before appending, so new records never follow garbage. Returns the number
+// of entries written.
+{
+    bool append = false;
+    {
+        ifstream in (path.c_str (), ios::binary);
+        uint4 magic = 0, version = 0;
+        uint8 filekey = 0;
+        in.read ((char*)&magic, sizeof (magic));
+        in.read ((char*)&version, sizeof (version));
+        in.read ((char*)&filekey, sizeof (filekey));
+        append = in && (magic == FILE_MAGIC) && (version == FILE_VERSION) &&
+                 (filekey == key);
+        if (append) {
+            // Step over the length prefixes to the end of the last whole record
+            in.seekg (0, ios::end);
+            off_t size = in.tellg ();
+            off_t valid = 2 * sizeof (uint4) + sizeof (uint8);
+            uint4 len;
+            while ((size - valid >= (off_t)sizeof (len)) &&
+                   in.seekg (valid) && in.read ((char*)&len, sizeof (len)) &&
+                   (size - valid - (off_t)sizeof (len) >= (off_t)len))
+                valid += sizeof (len) + len;
+            in.close ();
+            if ((valid < size) && (truncate (path.c_str (), valid) != 0))
+                append = false; // Cannot cut the tail off, start over
+        }
+    }
+    // A file started over is written beside the old one and renamed over it,
+    // as entries loaded from the old one still read from its mapping
+    string outpath = append ? path : path + ".tmp";
+    ofstream s (outpath.c_str (),
+                ios::binary | (append ? ios::app : ios::trunc));
+    if (!s)
+        throw LowlevelError ("Unable to write decode cache file " + path);
+    if (!append) {
+        uint4 magic = FILE_MAGIC, version = FILE_VERSION;
+        s.write ((const char*)&magic, sizeof (magic));
+        s.write ((const char*)&version, sizeof (version));
+        s.write ((const char*)&key, sizeof (key));
+    }
+    int4 count = 0;
+    for (uint4 i = 0; i <= mask; ++i) {
+        const DecodedInstruction* insn = table[i].load (memory_order_acquire);
+        if (insn == (const DecodedInstruction*)0)
+            continue;
+        if (append && insn->persisted)
+            continue;
+        writeRecord (s, insn);
+        insn->persisted = true;
+        count += 1;
+    }
+    s.close ();
+    if (!s)
+        throw LowlevelError ("Unable to write decode cache file " + path);
+    if (!append && (rename (outpath.c_str (), path.c_str ()) != 0))
+        throw LowlevelError ("Unable to write decode cache file " + path);
+    return count;
+}
+
+SleighDecoder::SleighDecoder (const SleighBase* sp, LoadImage* ld,
+                              ContextDatabase* c_db)
+
+{
+    spec = sp;
     loader = ld;
-    context_db = c_db;
     cache = new ContextCache (c_db);
     discache = (DisassemblyCache*)0;
+    shared = (SharedDecodeCache*)0;
+    if (spec->isInitialized ())
+        initialize ();
 }
 
-void Sleigh::initialize (DocumentStorage& store)
+SleighDecoder::~SleighDecoder (void)
 
 {
-    if (!isInitialized ()) { // Initialize the base if not already
-        const Element* el = store.getTag ("sleigh");
-        if (el == (const Element*)0)
-            throw LowlevelError ("Could not find sleigh tag");
-        restoreXml (el);
-    } else
-        reregisterContext ();
+    delete cache;
+    if (discache != (DisassemblyCache*)0)
+        delete discache;
+}
+
+void SleighDecoder::initialize (void)
+// Size the disassembly cache for the (now loaded) specification
+{
+    if (discache != (DisassemblyCache*)0)
+        delete discache;
     uint4 parser_cachesize = 2;
     uint4 parser_windowsize = 32;
-    if ((maxdelayslotbytes > 1) || (unique_allocatemask != 0)) {
+    if ((spec->getMaxDelaySlotBytes () > 1) ||
+        (spec->getUniqueAllocateMask () != 0)) {
         parser_cachesize = 8;
         parser_windowsize = 256;
     }
-    discache = new DisassemblyCache (cache, getConstantSpace (),
+    discache = new DisassemblyCache (cache, spec->getConstantSpace (),
                                      parser_cachesize, parser_windowsize);
 }
 
-ParserContext* Sleigh::obtainContext (const Address& addr, int4 state) const
+void SleighDecoder::allowContextSet (bool val)
+
+{
+    cache->allowSet (val);
+}
+
+ParserContext* SleighDecoder::obtainContext (const Address& addr, int4 state)
 // Obtain a ParserContext for the instruction at the given -addr-. This may be
 // cached.
 {
@@ -531,11 +996,20 @@ ParserContext* Sleigh::obtainContext (const Address& addr, int4 state) const
     return pos;
 }
 
-void Sleigh::resolve (ParserContext& pos) const
+void SleighDecoder::resolve (ParserContext& pos)
 // Resolve ALL the constructors involved in the
 {
     // instruction at this address
-    loader->loadFill (pos.getBuffer (), 16, pos.getAddr ());
+    // Instruction fields can read a word past the 16 byte window, so only
+    // point into the image when that much is there.
+    const uint1* direct =
+        loader->getDirect (pos.getAddr (), 16 + sizeof (uintm));
+    if (direct != (const uint1*)0) {
+        pos.setBytes (direct);
+    } else {
+        loader->loadFill (pos.getBuffer (), 16, pos.getAddr ());
+        pos.setBytes (pos.getBuffer ());
+    }
     ParserWalkerChange walker (&pos);
     // Clear the previous resolve and initialize the walker
     pos.deallocateState (walker);
@@ -547,7 +1021,7 @@ void Sleigh::resolve (ParserContext& pos) const
     walker.setOffset (0);        // Initial offset
     pos.clearCommits ();         // Clear any old context commits
     pos.loadContext ();          // Get context for current address
-    ct = root->resolve (walker); // Base constructor
+    ct = spec->getRoot ()->resolve (walker); // Base constructor
     walker.setConstructor (ct);
     ct->applyContext (walker);
     while (walker.isState ()) {
@@ -588,7 +1062,7 @@ void Sleigh::resolve (ParserContext& pos) const
     pos.setParserState (ParserContext::disassembly);
 }
 
-void Sleigh::resolveHandles (ParserContext& pos) const
+void SleighDecoder::resolveHandles (ParserContext& pos)
 
 { // Resolve handles (assuming Constructors already resolved)
     TripleSymbol* triple;
@@ -640,14 +1114,14 @@ void Sleigh::resolveHandles (ParserContext& pos) const
     pos.setParserState (ParserContext::pcode);
 }
 
-int4 Sleigh::instructionLength (const Address& baseaddr) const
+int4 SleighDecoder::instructionLength (const Address& baseaddr)
 
 {
     ParserContext* pos = obtainContext (baseaddr, ParserContext::disassembly);
     return pos->getLength ();
 }
 
-void Sleigh::getInstructionBytes (const Address& baseaddr, uint1* buf) const
+void SleighDecoder::getInstructionBytes (const Address& baseaddr, uint1* buf)
 
 {
     ParserContext* pos = obtainContext (baseaddr, ParserContext::disassembly);
@@ -666,7 +1140,7 @@ void Sleigh::getInstructionBytes (const Address& baseaddr, uint1* buf) const
     return;
 }
 
-int4 Sleigh::printAssembly (AssemblyEmit& emit, const Address& baseaddr) const
+int4 SleighDecoder::printAssembly (AssemblyEmit& emit, const Address& baseaddr)
 
 {
     int4 sz;
@@ -675,29 +1149,48 @@ int4 Sleigh::printAssembly (AssemblyEmit& emit, const Address& baseaddr) const
     ParserWalker walker (pos);
     walker.baseState ();
 
-    Constructor* ct = walker.getConstructor ();
-    ostringstream mons;
-    ct->printMnemonic (mons, walker);
-    ostringstream body;
-    ct->printBody (body, walker);
-    emit.dump (baseaddr, mons.str (), body.str ());
+    asmpieces.clear ();
+    walker.getConstructor ()->emitAssembly (asmpieces, walker);
+    string mnem, body;
+    asmpieces.appendText (mnem, 0, asmpieces.getBodyStart ());
+    asmpieces.appendText (body, asmpieces.getBodyStart (),
+                          asmpieces.numPieces ());
+    emit.dump (baseaddr, mnem, body);
     sz = pos->getLength ();
     return sz;
 }
 
-int4 Sleigh::oneInstruction (PcodeEmit& emit, const Address& baseaddr) const
+int4 SleighDecoder::emitAssembly (AsmPieces& pieces, const Address& baseaddr)
+// Fill -pieces- with the disassembly of the instruction at -baseaddr- and
+// return its length. Nothing is formatted, see AsmPieces::appendText().
+{
+    ParserContext* pos = obtainContext (baseaddr, ParserContext::disassembly);
+    ParserWalker walker (pos);
+    walker.baseState ();
+
+    pieces.clear ();
+    walker.getConstructor ()->emitAssembly (pieces, walker);
+    return pos->getLength ();
+}
+
+void SleighDecoder::checkAlignment (const Address& baseaddr)
 
 {
-    int4 fallOffset;
-    if (alignment != 1) {
-        if ((baseaddr.getOffset () % alignment) != 0) {
+    if (spec->getAlignment () != 1) {
+        if ((baseaddr.getOffset () % spec->getAlignment ()) != 0) {
             ostringstream s;
             s << "Instruction address not aligned: " << baseaddr;
             throw UnimplError (s.str (), 0);
         }
     }
+}
+
+int4 SleighDecoder::buildPcode (ParserContext* pos)
+// Fill pcode_cache with the pcode for the fully resolved -pos-. Returns the
+// offset to the fall-through instruction.
+{
+    int4 fallOffset;
 
-    ParserContext* pos = obtainContext (baseaddr, ParserContext::pcode);
     pos->applyCommits ();
     fallOffset = pos->getLength ();
 
@@ -718,13 +1211,13 @@ int4 Sleigh::oneInstruction (PcodeEmit& emit, const Address& baseaddr) const
     ParserWalker walker (pos);
     walker.baseState ();
     pcode_cache.clear ();
-    SleighBuilder builder (&walker, discache, &pcode_cache, getConstantSpace (),
-                           getUniqueSpace (), unique_allocatemask);
+    SleighBuilder builder (&walker, discache, &pcode_cache, spec->getConstantSpace (),
+                           spec->getUniqueSpace (),
+                           spec->getUniqueAllocateMask ());
 
     try {
         builder.build (walker.getConstructor ()->getTempl (), -1);
         pcode_cache.resolveRelatives ();
-        pcode_cache.emit (baseaddr, &emit);
     } catch (UnimplError& err) {
         ostringstream s;
         s << "Instruction not implemented in pcode:\n ";
@@ -743,6 +1236,154 @@ int4 Sleigh::oneInstruction (PcodeEmit& emit, const Address& baseaddr) const
     return fallOffset;
 }
 
+int4 SleighDecoder::oneInstruction (PcodeEmit& emit, const Address& baseaddr)
+
+{
+    checkAlignment (baseaddr);
+
+    ParserContext* pos = obtainContext (baseaddr, ParserContext::pcode);
+    int4 fallOffset = buildPcode (pos);
+    pcode_cache.emit (baseaddr, &emit);
+    return fallOffset;
+}
+
+int4 SleighDecoder::decodeInstruction (InstructionRecord& rec,
+                                const Address& baseaddr)
+// Resolve the instruction at -baseaddr- once and fill -rec- with its length,
+// raw bytes, assembly and pcode. This replaces a printAssembly() followed by
+// oneInstruction() and getInstructionBytes() on the same address.
+{
+    checkAlignment (baseaddr);
+
+    if (shared != (SharedDecodeCache*)0) {
+        contextkey.resize (cache->getDatabase ()->getContextSize ());
+        cache->getContext (baseaddr, contextkey.data ());
+        const DecodedInstruction* hit =
+            shared->find (baseaddr, contextkey.data (), contextkey.size ());
+        if (hit != (const DecodedInstruction*)0) {
+            uint1 buf[InstructionRecord::MAX_INSN_LEN];
+            const uint1* cur = loader->getDirect (baseaddr, hit->length);
+            if (cur == (const uint1*)0) {
+                loader->loadFill (buf, hit->length, baseaddr);
+                cur = buf;
+            }
+            if (memcmp (cur, hit->bytes, hit->length) == 0) {
+                hit->fill (rec, hitvarnodes);
+                return rec.length;
+            }
+        }
+    }
+
+    ParserContext* pos = obtainContext (baseaddr, ParserContext::pcode);
+    ParserWalker walker (pos);
+    walker.baseState ();
+
+    // Formatted straight into the record's strings, which keep their
+    // capacity when the record is reused
+    asmpieces.clear ();
+    walker.getConstructor ()->emitAssembly (asmpieces, walker);
+    rec.mnem.clear ();
+    asmpieces.appendText (rec.mnem, 0, asmpieces.getBodyStart ());
+    rec.body.clear ();
+    asmpieces.appendText (rec.body, asmpieces.getBodyStart (),
+                          asmpieces.numPieces ());
+
+    rec.length = pos->getLength ();
+    memcpy (rec.bytes, pos->getBytes (), rec.length);
+
+    rec.fallthrough = buildPcode (pos);
+    pcode_cache.hutch_emitIR (rec.pcode);
+    // Instructions that set context elsewhere, or that pull in delay slots,
+    // depend on more than their own bytes and context, so they are not shared
+    if ((shared != (SharedDecodeCache*)0) && !pos->hasCommits () &&
+        (pos->getDelaySlot () == 0))
+        shared->insert (new DecodedInstruction (baseaddr, contextkey.data (),
+                                                contextkey.size (), rec));
+    return rec.length;
+}
+
+Sleigh::Sleigh (LoadImage* ld, ContextDatabase* c_db) : SleighBase ()
+
+{
+    context_db = c_db;
+    decoder = new SleighDecoder (this, ld, c_db);
+}
+
+Sleigh::~Sleigh (void)
+
+{
+    delete decoder;
+}
+
+void Sleigh::reset (LoadImage* ld, ContextDatabase* c_db)
+
+{ // Completely clear everything except the base and reconstruct
+    // with a new loader and context
+    delete decoder;
+    context_db = c_db;
+    decoder = new SleighDecoder (this, ld, c_db);
+}
+
+void Sleigh::initialize (DocumentStorage& store)
+
+{
+    if (!isInitialized ()) { // Initialize the base if not already
+        const Element* el = store.getTag ("sleigh");
+        if (el == (const Element*)0)
+            throw LowlevelError ("Could not find sleigh tag");
+        restoreXml (el);
+    } else
+        reregisterContext ();
+    decoder->initialize ();
+}
+
+void Sleigh::initialize (istream& s)
+
+{
+    if (!isInitialized ()) // Initialize the base if not already
+        restoreXml (s);
+    else
+        reregisterContext ();
+    decoder->initialize ();
+}
+
+int4 Sleigh::instructionLength (const Address& baseaddr) const
+
+{
+    return decoder->instructionLength (baseaddr);
+}
+
+void Sleigh::getInstructionBytes (const Address& baseaddr, uint1* buf) const
+
+{
+    decoder->getInstructionBytes (baseaddr, buf);
+}
+
+int4 Sleigh::printAssembly (AssemblyEmit& emit, const Address& baseaddr) const
+
+{
+    return decoder->printAssembly (emit, baseaddr);
+}
+
+int4 Sleigh::emitAssembly (AsmPieces& pieces, const Address& baseaddr) const
+
+{
+    return decoder->emitAssembly (pieces, baseaddr);
+}
+
+int4 Sleigh::oneInstruction (PcodeEmit& emit, const Address& baseaddr) const
+
+{
+    return decoder->oneInstruction (emit, baseaddr);
+}
+
+int4 Sleigh::decodeInstruction (InstructionRecord& rec,
+                                const Address& baseaddr) const
+
+{
+    return decoder->decodeInstruction (rec, baseaddr);
+}
+
 void Sleigh::registerContext (const string& name, int4 sbit, int4 ebit)
 
 { // Inform translator of existence of context variable
@@ -758,6 +1399,6 @@ void Sleigh::setContextDefault (const string& name, uintm val)
 void Sleigh::allowContextSet (bool val) const
 
 {
-    cache->allowSet (val);
+    decoder->allowContextSet (val);
 }
 
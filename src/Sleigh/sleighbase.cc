@@ -14,9 +14,122 @@
  * limitations under the License.
  */
 #include "sleighbase.hh"
+#include <exception>
 
 const int4 SleighBase::SLA_FORMAT_VERSION = 2;
 
+const uintb RegisterIndex::MAX_DENSE = 0x40000;
+
+void RegisterIndex::clear(void)
+
+{
+  spaces.clear();
+  entries.clear();
+  chars.clear();
+  namestart.clear();
+  namestart.push_back(0);
+}
+
+/// The map is sorted by space, then offset, then decreasing size, so each
+/// run of registers at one offset becomes a bucket once reversed.
+/// \param xref is the map from register locations to names
+void RegisterIndex::build(const map<VarnodeData,string> &xref)
+
+{
+  clear();
+  map<VarnodeData,string>::const_iterator iter;
+  for(iter=xref.begin();iter!=xref.end();++iter) {
+    const VarnodeData &vn((*iter).first);
+    int4 ind = vn.space->getIndex();
+    if (spaces.size() <= ind)
+      spaces.resize(ind+1);
+    SpaceTable &tab(spaces[ind]);
+    if (tab.buckets.empty() || tab.buckets.back().offset != vn.offset) {
+      if (tab.buckets.empty()) {
+	tab.minoff = vn.offset;
+	tab.endoff = vn.offset;
+      }
+      Bucket b;
+      b.offset = vn.offset;
+      b.first = entries.size();
+      b.last = b.first;
+      tab.buckets.push_back(b);
+    }
+    Entry ent;
+    ent.size = vn.size;
+    ent.name = namestart.size() - 1;
+    entries.push_back(ent);
+    tab.buckets.back().last += 1;
+    if (vn.offset + vn.size > tab.endoff)
+      tab.endoff = vn.offset + vn.size;
+    chars += (*iter).second;
+    namestart.push_back(chars.size());
+  }
+  for(int4 i=0;i<spaces.size();++i) {
+    SpaceTable &tab(spaces[i]);
+    if (tab.buckets.empty()) continue;
+    for(int4 j=0;j<tab.buckets.size();++j) {
+      const Bucket &b(tab.buckets[j]);
+      reverse(entries.begin()+b.first,entries.begin()+b.last);
+    }
+    if (tab.endoff - tab.minoff > MAX_DENSE) continue;
+    tab.dense.resize(tab.endoff - tab.minoff);
+    int4 cur = 0;
+    for(uintb off=tab.minoff;off<tab.endoff;++off) {
+      if (cur + 1 < tab.buckets.size() && tab.buckets[cur+1].offset <= off)
+	cur += 1;
+      tab.dense[off - tab.minoff] = cur;
+    }
+  }
+}
+
+/// \param tab is the table for the space
+/// \param off is an offset no smaller than the first register
+/// \return the index of the last bucket starting at or before \b off
+int4 RegisterIndex::findBucket(const SpaceTable &tab,uintb off) const
+
+{
+  if (!tab.dense.empty())
+    return tab.dense[off - tab.minoff];
+  int4 min = 0;
+  int4 max = tab.buckets.size() - 1;
+  while(min < max) {
+    int4 mid = (min + max + 1) / 2;
+    if (tab.buckets[mid].offset <= off)
+      min = mid;
+    else
+      max = mid - 1;
+  }
+  return min;
+}
+
+/// This matches the search SleighBase::getRegisterName has always done over
+/// the register map: the smallest register at the closest starting offset
+/// that contains the whole location, where a starting offset equal to the
+/// location's only counts if some register there is at least as big.
+/// \param spaceindex is the index of the address space
+/// \param off is the offset of the location
+/// \param size is the size of the location in bytes
+/// \return the name id of the register, or -1 if no register contains the location
+int4 RegisterIndex::find(int4 spaceindex,uintb off,int4 size) const
+
+{
+  if (spaceindex >= spaces.size()) return -1;
+  const SpaceTable &tab(spaces[spaceindex]);
+  if (tab.buckets.empty() || off < tab.minoff || off >= tab.endoff) return -1;
+  int4 k = findBucket(tab,off);
+  const Bucket *b = &tab.buckets[k];
+  if (b->offset == off && entries[b->last-1].size < size) {
+    if (k == 0) return -1;
+    b = &tab.buckets[k-1];
+  }
+  for(int4 i=b->first;i<b->last;++i) {
+    if (b->offset + entries[i].size >= off + size)
+      return entries[i].name;
+  }
+  return -1;
+}
+
 SleighBase::SleighBase(void)
 
 {
@@ -24,6 +137,9 @@ SleighBase::SleighBase(void)
   maxdelayslotbytes = 0;
   unique_allocatemask = 0;
   numSections = 0;
+  lazyrestore = false;
+  regspace = -1;
+  regindex.clear();
 }
 
 /// Assuming the symbol table is populated, iterate through the table collecting
@@ -64,6 +180,9 @@ void SleighBase::buildXrefs(void)
   }
   if (errors > 0)
     throw SleighError(s.str());
+  regindex.build(varnode_xref);
+  AddrSpace *spc = getSpaceByName("register");
+  regspace = (spc == (AddrSpace *)0) ? -1 : spc->getIndex();
 }
 
 /// If \b this SleighBase is being reused with a new program, the context
@@ -86,6 +205,25 @@ void SleighBase::reregisterContext(void)
   }
 }
 
+/// Context variables are normally registered with the database of the Translate
+/// that loaded the specification. This registers them with any other database,
+/// as needed when several decoders share one specification.
+/// \param db is the context database to register with
+void SleighBase::registerContextFields(ContextDatabase *db) const
+
+{
+  SymbolScope *glb = symtab.getGlobalScope();
+  SymbolTree::const_iterator iter;
+  for(iter=glb->begin();iter!=glb->end();++iter) {
+    SleighSymbol *sym = *iter;
+    if (sym->getType() == SleighSymbol::context_symbol) {
+      ContextSymbol *csym = (ContextSymbol *)sym;
+      ContextField *field = (ContextField *)csym->getPatternValue();
+      db->registerVariable(csym->getName(),field->getStartBit(),field->getEndBit());
+    }
+  }
+}
+
 void SleighBase::addRegister(const string &nm,AddrSpace *base,uintb offset,int4 size)
 
 {
@@ -107,27 +245,15 @@ const VarnodeData &SleighBase::getRegister(const string &nm) const
 string SleighBase::getRegisterName(AddrSpace *base,uintb off,int4 size) const
 
 {
-  VarnodeData sym;
-  sym.space = base;
-  sym.offset = off;
-  sym.size = size;
-  map<VarnodeData,string>::const_iterator iter = varnode_xref.upper_bound(sym); // First point greater than offset
-  if (iter == varnode_xref.begin()) return "";
-  iter--;
-  const VarnodeData &point((*iter).first);
-  if (point.space != base) return "";
-  uintb offbase = point.offset;
-  if (point.offset+point.size >= off+size)
-    return (*iter).second;
-  
-  while(iter != varnode_xref.begin()) {
-    --iter;
-    const VarnodeData &point((*iter).first);
-    if ((point.space != base)||(point.offset != offbase)) return "";
-    if (point.offset+point.size >= off+size)
-      return (*iter).second;
-  }
-  return "";
+  return string(getRegisterNameView(base,off,size));
+}
+
+string_view SleighBase::getRegisterNameView(AddrSpace *base,uintb off,int4 size) const
+
+{
+  int4 id = regindex.find(base->getIndex(),off,size);
+  if (id < 0) return string_view();
+  return regindex.getName(id);
 }
 
 void SleighBase::getAllRegisters(map<VarnodeData,string> &reglist) const
@@ -178,10 +304,10 @@ void SleighBase::saveXml(ostream &s) const
   s << "</sleigh>\n";
 }
 
-/// This parses the main \<sleigh> tag (from a .sla file), which includes the description
-/// of address spaces and the symbol table, with its associated decoding tables
+/// This reads the attributes of the main \<sleigh> tag (from a .sla file), which
+/// must come before any of its children are restored
 /// \param el is the root XML element
-void SleighBase::restoreXml(const Element *el)
+void SleighBase::restoreXmlHeader(const Element *el)
 
 {
   maxdelayslotbytes = 0;
@@ -227,17 +353,188 @@ void SleighBase::restoreXml(const Element *el)
   }
   if (version != SLA_FORMAT_VERSION)
     throw LowlevelError(".sla file has wrong format");
-  const List &list(el->getChildren());
-  List::const_iterator iter;
-  iter = list.begin();
-  while((*iter)->getName() == "floatformat") {
+}
+
+/// The children of the \<sleigh> tag are any \<floatformat> tags, then the
+/// \<spaces> tag, then the \<symbol_table> tag, and must be passed in that order.
+/// \param el is the child element
+void SleighBase::restoreXmlChild(const Element *el)
+
+{
+  if (el->getName() == "floatformat") {
     floatformats.push_back(FloatFormat());
-    floatformats.back().restoreXml(*iter);
-    ++iter;
+    floatformats.back().restoreXml(el);
   }
-  restoreXmlSpaces(*iter,this);
-  iter++;
-  symtab.restoreXml(*iter,this);
+  else if (el->getName() == "spaces")
+    restoreXmlSpaces(el,this);
+  else if (el->getName() == "symbol_table")
+    symtab.restoreXml(el,this);
+}
+
+void SleighBase::restoreXmlFinish(void)
+
+{
   root = (SubtableSymbol *)symtab.getGlobalScope()->findSymbol("instruction");
   buildXrefs();
 }
+
+/// This parses the main \<sleigh> tag (from a .sla file), which includes the description
+/// of address spaces and the symbol table, with its associated decoding tables
+/// \param el is the root XML element
+void SleighBase::restoreXml(const Element *el)
+
+{
+  restoreXmlHeader(el);
+  const List &list(el->getChildren());
+  List::const_iterator iter;
+  for(iter=list.begin();iter!=list.end();++iter)
+    restoreXmlChild(*iter);
+  restoreXmlFinish();
+}
+
+/// \brief Restore a SleighBase from XML parse events, one element at a time
+///
+/// The \<sleigh> and \<symbol_table> tags are read from their attributes alone.
+/// Each of their other children is built into an Element subtree, restored as soon
+/// as its end tag is parsed, and freed again, so only one such subtree is in
+/// memory at any time. After a failed restore, the rest of the document is
+/// parsed but ignored, and the error is rethrown once parsing ends.
+class SleighStreamHandler : public ContentHandler {
+  SleighBase *base;		///< The translator being restored
+  Element *subroot;		///< Root of the subtree being built, or null
+  Element *cur;			///< Innermost open element of the subtree
+  int4 depth;			///< Number of open tags
+  int4 symdepth;		///< Depth of the open \<symbol_table> tag, or -1
+  int4 numsym;			///< Children of \<symbol_table> restored so far
+  bool sawroot;			///< Has the \<sleigh> tag been read
+  exception_ptr failure;	///< The first restore error, if any
+  string error;			///< The parse error, if any
+  void restoreSubtree(void);	///< Restore and free the finished subtree
+public:
+  SleighStreamHandler(SleighBase *b);
+  virtual ~SleighStreamHandler(void) { delete subroot; }
+  virtual void setDocumentLocator(Locator locator) {}
+  virtual void startDocument(void) {}
+  virtual void endDocument(void) {}
+  virtual void startPrefixMapping(const string &prefix,const string &uri) {}
+  virtual void endPrefixMapping(const string &prefix) {}
+  virtual void startElement(const string &namespaceURI,const string &localName,
+			    const string &qualifiedName,const Attributes &atts);
+  virtual void endElement(const string &namespaceURI,const string &localName,
+			  const string &qualifiedName);
+  virtual void characters(const char *text,int4 start,int4 length) {
+    if (cur != (Element *)0) cur->addContent(text,start,length); }
+  virtual void ignorableWhitespace(const char *text,int4 start,int4 length) {}
+  virtual void processingInstruction(const string &target,const string &data) {}
+  virtual void setVersion(const string &val) {}
+  virtual void setEncoding(const string &val) {}
+  virtual void skippedEntity(const string &name) {}
+  virtual void setError(const string &errmsg) { error = errmsg; }
+  void finish(int4 res);	///< Throw any error, or finish the restore
+};
+
+SleighStreamHandler::SleighStreamHandler(SleighBase *b)
+
+{
+  base = b;
+  subroot = (Element *)0;
+  cur = (Element *)0;
+  depth = 0;
+  symdepth = -1;
+  numsym = 0;
+  sawroot = false;
+}
+
+void SleighStreamHandler::startElement(const string &namespaceURI,const string &localName,
+				       const string &qualifiedName,const Attributes &atts)
+{
+  depth += 1;
+  if (failure) return;
+  Element *newel = new Element(cur);
+  newel->setName(localName);
+  for(int4 i=0;i<atts.getLength();++i)
+    newel->addAttribute(atts.getLocalName(i),atts.getValue(i));
+  if (cur != (Element *)0) {	// Inside a subtree, build it up
+    cur->addChild(newel);
+    cur = newel;
+    return;
+  }
+  try {
+    if (depth == 1) {		// The root, read its attributes only
+      if (localName != "sleigh")
+	throw LowlevelError("Could not find sleigh tag");
+      sawroot = true;
+      base->restoreXmlHeader(newel);
+      delete newel;
+    }
+    else if ((depth == 2)&&(localName == "symbol_table")) {
+      symdepth = depth;
+      base->symtab.restoreXmlHeader(newel);
+      delete newel;
+    }
+    else			// Start a subtree
+      subroot = cur = newel;
+  } catch(...) {
+    delete newel;
+    failure = current_exception();
+  }
+}
+
+void SleighStreamHandler::endElement(const string &namespaceURI,const string &localName,
+				     const string &qualifiedName)
+{
+  depth -= 1;
+  if (failure) return;
+  if (cur == (Element *)0) {
+    if (depth < symdepth)	// Closing the <symbol_table> tag
+      symdepth = -1;
+  }
+  else if (cur == subroot)
+    restoreSubtree();
+  else
+    cur = cur->getParent();
+}
+
+void SleighStreamHandler::restoreSubtree(void)
+
+{
+  try {
+    if (symdepth >= 0)
+      base->symtab.restoreXmlChild(subroot,numsym++,base);
+    else
+      base->restoreXmlChild(subroot);
+  } catch(...) {
+    failure = current_exception();
+  }
+  delete subroot;
+  subroot = cur = (Element *)0;
+}
+
+/// \param res is the result of the parse
+void SleighStreamHandler::finish(int4 res)
+
+{
+  if (failure)
+    rethrow_exception(failure);
+  if (res != 0)
+    throw XmlError(error);
+  if (!sawroot)
+    throw LowlevelError("Could not find sleigh tag");
+  base->restoreXmlFinish();
+}
+
+/// The specification is restored while it is parsed, so a text .sla never exists
+/// as a complete Element tree. Elements are freed as soon as they are restored,
+/// so decision trees and p-code templates are always restored right away, even
+/// if \b lazyrestore is set.
+/// \param s is the stream holding the \<sleigh> document
+void SleighBase::restoreXml(istream &s)
+
+{
+  SleighStreamHandler handler(this);
+  bool lazy = lazyrestore;
+  lazyrestore = false;
+  int4 res = xml_parse(s,&handler);
+  lazyrestore = lazy;
+  handler.finish(res);
+}
@@ -16,6 +16,12 @@
 #include "slgh_compile.hh"
 #include "filemanage.hh"
 #include <csignal>
+#include <cstdio>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <sys/wait.h>
+#include <unistd.h>
 
 SleighCompile *slgh;		// Global pointer to sleigh object for use with parser
 #ifdef YYDEBUG
@@ -1465,6 +1471,10 @@ SleighCompile::SleighCompile(void)
   lenientconflicterrors = true;
   warnalllocalcollisions = false;
   warnallnops = false;
+  treestats = false;
+  cachetrees = false;
+  writedeps = false;
+  treethreads = 0;
   root = (SubtableSymbol *)0;
 }
 
@@ -1556,28 +1566,198 @@ int4 SleighCompile::calcContextVarLayout(int4 start,int4 sz,int4 numbits)
 
 void SleighCompile::buildDecisionTrees(void)
 
-{
-  DecisionProperties props;
-  root->buildDecisionTree(props);
-
-  for(int4 i=0;i<tables.size();++i)
-    tables[i]->buildDecisionTree(props);
+{				// Subtables do not share patterns or constructors, so their
+				// trees are built concurrently. Each gets its own properties,
+				// merged afterward in table order as if built one by one.
+  vector<SubtableSymbol *> alltables;
+  alltables.push_back(root);
+  alltables.insert(alltables.end(),tables.begin(),tables.end());
+  vector<DecisionProperties> props(alltables.size());
+  vector<double> millis(alltables.size(),0.0);
+  vector<exception_ptr> failures(alltables.size());
+  vector<bool> cached(alltables.size(),false);
+  vector<string> keys(alltables.size());
+  if (!treecache.empty())
+    restoreDecisionTreeCache(alltables,cached,keys);
+  atomic<int4> next(0);
+
+  auto worker = [&]() {
+    for(int4 i=next++;i<alltables.size();i=next++) {
+      if (cached[i]) continue;
+      auto start = chrono::steady_clock::now();
+      try {
+	alltables[i]->buildDecisionTree(props[i]);
+      } catch(...) {
+	failures[i] = current_exception();
+      }
+      chrono::duration<double,milli> elapsed = chrono::steady_clock::now() - start;
+      millis[i] = elapsed.count();
+    }
+  };
+  int4 numthreads = (treethreads > 0) ? treethreads : max((int4)thread::hardware_concurrency(),1);
+  numthreads = min((int4)alltables.size(),numthreads);
+  vector<thread> workers;
+  for(int4 i=1;i<numthreads;++i)
+    workers.emplace_back(worker);
+  worker();
+  for(int4 i=0;i<workers.size();++i)
+    workers[i].join();
+  for(int4 i=0;i<failures.size();++i)
+    if (failures[i])
+      rethrow_exception(failures[i]);
+
+  if (!treecache.empty()) {
+    vector<bool> clean(alltables.size());
+    for(int4 i=0;i<alltables.size();++i)
+      clean[i] = props[i].getIdentErrors().empty() && props[i].getConflictErrors().empty();
+    saveDecisionTreeCache(alltables,clean,keys);
+  }
+
+  if (treestats) {
+    for(int4 i=0;i<alltables.size();++i) {
+      if (cached[i]) {
+	cout << "Decision tree " << alltables[i]->getName() << ": from cache" << endl;
+	continue;
+      }
+      if (props[i].getNumNodes() == 0) continue; // Unreferenced table
+      cout << "Decision tree " << alltables[i]->getName() << ": " << dec
+	   << props[i].getNumNodes() << " nodes, " << props[i].getNumFields()
+	   << " fields scored, " << millis[i] << " ms" << endl;
+    }
+  }
 
-  const vector<string> &ierrors( props.getIdentErrors() );
-  for(int4 i=0;i<ierrors.size();++i) {
-    errors += 1;
-    cerr << ierrors[i];
+  for(int4 j=0;j<props.size();++j) {
+    const vector<string> &ierrors( props[j].getIdentErrors() );
+    for(int4 i=0;i<ierrors.size();++i) {
+      errors += 1;
+      cerr << ierrors[i];
+    }
   }
 
   if (!lenientconflicterrors) {
-    const vector<string> &cerrors( props.getConflictErrors() );
-    for(int4 i=0;i<cerrors.size();++i) {
-      errors += 1;
-      cerr << cerrors[i];
+    for(int4 j=0;j<props.size();++j) {
+      const vector<string> &cerrors( props[j].getConflictErrors() );
+      for(int4 i=0;i<cerrors.size();++i) {
+	errors += 1;
+	cerr << cerrors[i];
+      }
     }
   }
 }
 
+static string escapeMakePath(const string &path)
+
+{				// Spaces separate prerequisites in a Makefile rule
+  string res;
+  for(int4 i=0;i<path.size();++i) {
+    if (path[i] == ' ')
+      res += '\\';
+    res += path[i];
+  }
+  return res;
+}
+
+/// Write a Makefile rule making \e target depend on the slaspec and every file it
+/// included.  Each included file also gets an empty rule so that removing it does not
+/// break the build.
+/// \param s is the stream to write to
+/// \param target is the name of the .sla file
+void SleighCompile::saveDependencies(ostream &s,const string &target) const
+
+{
+  s << escapeMakePath(target) << ':';
+  for(int4 i=0;i<sourcefiles.size();++i)
+    s << " \\\n " << escapeMakePath(sourcefiles[i]);
+  s << '\n';
+  for(int4 i=1;i<sourcefiles.size();++i)
+    s << '\n' << escapeMakePath(sourcefiles[i]) << ":\n";
+}
+
+// Version of the tree building done by DecisionNode::split() and of the cached tree
+// format.  Bump it whenever either changes so trees from an older compiler are rebuilt.
+static const int4 TREECACHE_VERSION = 1;
+
+// 64-bit FNV-1a of -str-, as hex
+static string hashKey(const string &str)
+
+{
+  uint8 hash = 0xcbf29ce484222325ULL;
+  for(int4 i=0;i<str.size();++i)
+    hash = (hash ^ (uint1)str[i]) * 0x100000001b3ULL;
+  ostringstream s;
+  s << hex << hash;
+  return s.str();
+}
+
+/// This is a decision tree cache and nothing more.  Parsing, preprocessing and the p-code
+/// templates are redone on every compile, as their state lives in parser globals and
+/// symbols shared between tables.  Any table whose patterns hash to the key recorded in
+/// the cache file gets its tree back from the file instead of being rebuilt.  The key also covers the tree builder and
+/// format versions, so trees from another compiler are never reused.  Keys are computed
+/// for every table with a pattern, as saveDecisionTreeCache() needs them too.
+/// \return the number of trees restored
+int4 SleighCompile::restoreDecisionTreeCache(vector<SubtableSymbol *> &alltables,vector<bool> &done,vector<string> &keys)
+
+{
+  for(int4 i=0;i<alltables.size();++i) {
+    if (alltables[i]->getPattern() == (TokenPattern *)0) continue;
+    ostringstream s;
+    s << "treecache " << dec << TREECACHE_VERSION << '\n';
+    alltables[i]->saveXmlTreeInput(s);
+    keys[i] = hashKey(s.str());
+  }
+
+  ifstream s(treecache.c_str());
+  if (!s) return 0;		// First compile
+  Document *doc;
+  try {
+    doc = xml_tree(s);
+  } catch(XmlError &err) {
+    return 0;			// A damaged cache is just ignored
+  }
+  map<string,const Element *> cached;
+  const List &list(doc->getRoot()->getChildren());
+  for(List::const_iterator iter=list.begin();iter!=list.end();++iter)
+    cached[(*iter)->getAttributeValue("name") + '/' + (*iter)->getAttributeValue("key")] = *iter;
+
+  int4 count = 0;
+  for(int4 i=0;i<alltables.size();++i) {
+    if (keys[i].empty()) continue;
+    map<string,const Element *>::const_iterator iter = cached.find(alltables[i]->getName() + '/' + keys[i]);
+    if (iter == cached.end()) continue;
+    alltables[i]->restoreDecisionTree((*iter).second->getChildren().front());
+    done[i] = true;
+    count += 1;
+  }
+  delete doc;
+  return count;
+}
+
+/// Record the tree of every table that built without pattern errors, keyed by the hash
+/// of its patterns.  The file is replaced in one step so an interrupted compile cannot
+/// leave half of it behind.
+void SleighCompile::saveDecisionTreeCache(vector<SubtableSymbol *> &alltables,vector<bool> &clean,vector<string> &keys)
+
+{
+  string tmpname = treecache + ".tmp";
+  ofstream s(tmpname.c_str());
+  if (!s) {
+    reportWarning("Unable to write decision tree cache: " + treecache,false);
+    return;
+  }
+  s << "<treecache>\n";
+  for(int4 i=0;i<alltables.size();++i) {
+    if (!clean[i] || !alltables[i]->hasDecisionTree()) continue;
+    s << "<table name=\"" << alltables[i]->getName() << "\" key=\"" << keys[i] << "\">\n";
+    alltables[i]->saveXmlDecisionTree(s);
+    s << "</table>\n";
+  }
+  s << "</treecache>\n";
+  s.close();
+  if (rename(tmpname.c_str(),treecache.c_str()) != 0)
+    reportWarning("Unable to write decision tree cache: " + treecache,false);
+}
+
 void SleighCompile::buildPatterns(void)
 
 {
@@ -1843,6 +2023,9 @@ void SleighCompile::parseFromNewFile(const string &fname)
     relpath.push_back(totalpath);
   }
   lineno.push_back(1);
+  string fullpath = grabCurrentFilePath();
+  if (find(sourcefiles.begin(),sourcefiles.end(),fullpath) == sourcefiles.end())
+    sourcefiles.push_back(fullpath);
 }
 
 void SleighCompile::parsePreprocMacro(void)
@@ -2659,10 +2842,12 @@ void SleighCompile::recordNop(void)
   noplist.push_back(s.str());
 }
 
-static int4 run_compilation(const char *filein,const char *fileout,SleighCompile &compiler)
+static int4 run_compilation(const char *filein,const char *fileout,SleighCompile &compiler,bool packed)
 
 {
   compiler.parseFromNewFile(filein);
+  if (compiler.doesCacheTrees())
+    compiler.setDecisionTreeCache(string(fileout) + ".treecache");
   slgh = &compiler;		// Set global pointer up for parser
   yyin = fopen(filein,"r");	// Open the file for the lexer
   if (yyin == (FILE *)0) {
@@ -2676,14 +2861,33 @@ static int4 run_compilation(const char *filein,const char *fileout,SleighCompile
     if (parseres==0)
       compiler.process();	// Do all the post-processing
     if ((parseres==0)&&(compiler.numErrors()==0)) { // If no errors
-      ofstream s(fileout);
+      ofstream s(fileout,packed ? (ios::out|ios::binary) : ios::out);
       if (!s) {
 	ostringstream errs;
 	errs << "Unable to open output file: " << fileout;
 	throw SleighError(errs.str());
       }
-      compiler.saveXml(s);	// Dump output xml
+      if (packed) {		// Dump output as a packed element tree
+	ostringstream xmlout;
+	compiler.saveXml(xmlout);
+	istringstream xmlin(xmlout.str());
+	Document *doc = xml_tree(xmlin);
+	xml_pack(s,doc->getRoot());
+	delete doc;
+      }
+      else
+	compiler.saveXml(s);	// Dump output xml
       s.close();
+      if (compiler.doesWriteDependencies()) {
+	string depname = string(fileout) + ".d";
+	ofstream deps(depname.c_str());
+	if (!deps) {
+	  ostringstream errs;
+	  errs << "Unable to open dependency file: " << depname;
+	  throw SleighError(errs.str());
+	}
+	compiler.saveDependencies(deps,fileout);
+      }
     }
     else {
       cerr << "No output produced" <<endl;
@@ -2697,7 +2901,7 @@ static int4 run_compilation(const char *filein,const char *fileout,SleighCompile
   return 0;
 }
 
-static int4 run_xml(const char *filein,SleighCompile &compiler)
+static int4 run_xml(const char *filein,SleighCompile &compiler,bool packed)
 
 {
   ifstream s(filein);
@@ -2748,7 +2952,7 @@ static int4 run_xml(const char *filein,SleighCompile &compiler)
     cerr << "Output sla file was not specified in " << filein << endl;
     exit(1);
   }
-  return run_compilation(specfilein.c_str(),specfileout.c_str(),compiler);
+  return run_compilation(specfilein.c_str(),specfileout.c_str(),compiler,packed);
 }
 
 static void findSlaSpecs(vector<string> &res, const string &dir, const string &suffix)
@@ -2767,7 +2971,8 @@ static void findSlaSpecs(vector<string> &res, const string &dir, const string &s
 
 static void initCompiler(SleighCompile &compiler, map<string,string> &defines, bool enableUnnecessaryPcodeWarning,
 			 bool disableLenientConflict, bool enableAllCollisionWarning,
-			 bool enableAllNopWarning,bool enableDeadTempWarning,bool enforceLocalKeyWord)
+			 bool enableAllNopWarning,bool enableDeadTempWarning,bool enforceLocalKeyWord,
+			 bool printTreeStats,bool cacheTrees,bool writeDependencies)
 
 {
   map<string,string>::iterator iter = defines.begin();
@@ -2786,6 +2991,143 @@ static void initCompiler(SleighCompile &compiler, map<string,string> &defines, b
     compiler.setDeadTempWarning(true);
   if (enforceLocalKeyWord)
     compiler.setEnforceLocalKeyWord(true);
+  if (printTreeStats)
+    compiler.setTreeStats(true);
+  if (cacheTrees)
+    compiler.setCacheTrees(true);
+  if (writeDependencies)
+    compiler.setWriteDependencies(true);
+}
+
+/// \brief One specification compiled by a worker process in -a mode
+///
+/// The parser and lexer keep their state in globals, so specifications are compiled
+/// concurrently in forked processes rather than threads.  Each worker's output and
+/// errors go to temporary files that are replayed in specification order once the
+/// worker, and every worker before it, is done.
+struct CompileJob {
+  string slaspec;		///< Input specification
+  string sla;			///< Output file
+  pid_t pid;			///< Worker process, or 0 if not started
+  FILE *out;			///< Captured standard output of the worker
+  FILE *err;			///< Captured standard error of the worker
+  int4 retval;			///< Worker exit status, -1 while running
+  CompileJob(const string &in,const string &outfile) : slaspec(in), sla(outfile) {
+    pid = 0; out = (FILE *)0; err = (FILE *)0; retval = -1; }
+};
+
+static void replay(FILE *from,ostream &to)
+
+{
+  char buf[4096];
+  size_t sz;
+  fflush(from);
+  rewind(from);
+  while((sz = fread(buf,1,sizeof(buf),from)) > 0)
+    to.write(buf,sz);
+  to.flush();
+  fclose(from);
+}
+
+static void startJob(CompileJob &job,int4 treethreads,map<string,string> &defines,
+		     bool enableUnnecessaryPcodeWarning,
+		     bool disableLenientConflict, bool enableAllCollisionWarning,
+		     bool enableAllNopWarning,bool enableDeadTempWarning,bool enforceLocalKeyWord,
+		     bool printTreeStats,bool cacheTrees,bool writeDependencies,bool packed)
+
+{
+  job.out = tmpfile();
+  job.err = tmpfile();
+  if ((job.out == (FILE *)0)||(job.err == (FILE *)0))
+    throw LowlevelError("Unable to create temporary files for compile output");
+  cout.flush();			// Nothing buffered may be written twice
+  cerr.flush();
+  fflush((FILE *)0);
+  job.pid = fork();
+  if (job.pid < 0)
+    throw LowlevelError("Unable to start compile process for " + job.slaspec);
+  if (job.pid != 0) return;
+
+  // The child never returns or unwinds into the parent's code: every way out,
+  // including an exception, ends in _exit()
+  int4 res = 2;
+  try {
+    dup2(fileno(job.out),STDOUT_FILENO);
+    dup2(fileno(job.err),STDERR_FILENO);
+    SleighCompile compiler;
+    initCompiler(compiler, defines, enableUnnecessaryPcodeWarning,
+		 disableLenientConflict, enableAllCollisionWarning, enableAllNopWarning,
+		 enableDeadTempWarning, enforceLocalKeyWord, printTreeStats,
+		 cacheTrees, writeDependencies);
+    compiler.setTreeThreads(treethreads);
+    res = run_compilation(job.slaspec.c_str(),job.sla.c_str(),compiler,packed);
+  } catch(...) {
+    res = 2;
+  }
+  cout.flush();
+  cerr.flush();
+  fflush((FILE *)0);
+  _exit(res);
+}
+
+/// Compile every job, at most \e numworkers at a time.  Results are reported in job
+/// order and, as in the serial loop, no new job is started after one fails.  The cores
+/// are split between the workers, each building its decision trees on its share.
+/// \return the status of the first failing job or 0
+static int4 runJobs(vector<CompileJob> &jobs,int4 numworkers,map<string,string> &defines,
+		    bool enableUnnecessaryPcodeWarning,
+		    bool disableLenientConflict, bool enableAllCollisionWarning,
+		    bool enableAllNopWarning,bool enableDeadTempWarning,bool enforceLocalKeyWord,
+		    bool printTreeStats,bool cacheTrees,bool writeDependencies,bool packed)
+
+{
+  int4 next = 0;		// Next job to start
+  int4 reported = 0;		// Next job to report
+  int4 running = 0;
+  int4 failure = 0;
+  int4 concurrent = min(numworkers,(int4)jobs.size());
+  int4 treethreads = max((int4)thread::hardware_concurrency() / max(concurrent,1),1);
+  while(reported < jobs.size()) {
+    while((failure == 0)&&(running < numworkers)&&(next < jobs.size())) {
+      startJob(jobs[next++],treethreads,defines,enableUnnecessaryPcodeWarning,disableLenientConflict,
+	       enableAllCollisionWarning,enableAllNopWarning,enableDeadTempWarning,
+	       enforceLocalKeyWord,printTreeStats,cacheTrees,writeDependencies,packed);
+      running += 1;
+    }
+    if (running == 0) break;	// Stopped early on a failure
+    int status;
+    pid_t pid = wait(&status);
+    if (pid < 0)
+      throw LowlevelError("Lost track of compile processes");
+    for(int4 j=0;j<next;++j) {
+      if (jobs[j].pid != pid) continue;
+      jobs[j].retval = WIFEXITED(status) ? WEXITSTATUS(status) : 2;
+      if ((jobs[j].retval != 0)&&(failure == 0))
+	failure = jobs[j].retval;
+      running -= 1;
+      break;
+    }
+    while((reported < next)&&(jobs[reported].retval >= 0)) {
+      CompileJob &job(jobs[reported]);
+      reported += 1;
+      cout << "Compiling (" << reported << " of " << jobs.size() << ") " << job.slaspec << "\n";
+      replay(job.out,cout);
+      replay(job.err,cerr);
+      if (job.retval != 0) {
+	// Later jobs may still be running, let them finish but stay quiet
+	while(running > 0) {
+	  wait(&status);
+	  running -= 1;
+	}
+	for(int4 j=reported;j<next;++j) {
+	  fclose(jobs[j].out);
+	  fclose(jobs[j].err);
+	}
+	return job.retval;
+      }
+    }
+  }
+  return failure;
 }
 
 static void segvHandler(int sig) {
@@ -2806,18 +3148,22 @@ int main(int argc,char **argv)
   if (argc < 2) {
     cerr << "USAGE: sleigh [-x] [-dNAME=VALUE] inputfile [outputfile]" << endl;
     cerr << "   -a              scan for all slaspec files recursively where inputfile is a directory" << endl;
+    cerr << "   -j N            with -a, compile up to N slaspec files at once (default: one per core)" << endl;
     cerr << "   -x              turns on parser debugging" << endl;
+    cerr << "   -b              write the packed binary sla format instead of xml, to outputfile.slab" << endl;
     cerr << "   -u              print warnings for unnecessary pcode instructions" << endl;
     cerr << "   -l              report pattern conflicts" << endl;
     cerr << "   -n              print warnings for all NOP constructors" << endl;
     cerr << "   -t              print warnings for dead temporaries" << endl;
     cerr << "   -e              enforce use of 'local' keyword for temporaries" << endl;
     cerr << "   -c              print warnings for all constructors with colliding operands" << endl;
+    cerr << "   -p              print decision tree build statistics for each table" << endl;
+    cerr << "   -k              cache decision trees (only) in outputfile.treecache and reuse unchanged ones" << endl;
+    cerr << "   -M              write a Makefile dependency file, outputfile.d, listing every included file" << endl;
     cerr << "   -DNAME=VALUE    defines a preprocessor macro NAME with value VALUE" << endl;
     exit(2);
   }
 
-  const string SLAEXT(".sla");	// Default sla extension
   const string SLASPECEXT(".slaspec");
   map<string,string> defines;
   bool enableUnnecessaryPcodeWarning = false;
@@ -2826,14 +3172,29 @@ int main(int argc,char **argv)
   bool enableAllNopWarning = false;
   bool enableDeadTempWarning = false;
   bool enforceLocalKeyWord = false;
+  bool printTreeStats = false;
+  bool cacheTrees = false;
+  bool writeDependencies = false;
   
   bool compileAll = false;
+  bool packedOutput = false;
+  int4 numWorkers = 0;
   
   int4 i;
   for(i=1;i<argc;++i) {
     if (argv[i][0] != '-') break;
     if (argv[i][1] == 'a')
       compileAll = true;
+    else if (argv[i][1] == 'j') {
+      const char *val = argv[i]+2;
+      if ((*val == '\0')&&(i+1 < argc))
+	val = argv[++i];
+      numWorkers = atoi(val);
+      if (numWorkers <= 0) {
+	cerr << "Bad sleigh option: -j " << val << endl;
+	exit(1);
+      }
+    }
     else if (argv[i][1] == 'D') {
       string preproc(argv[i]+2);
       string::size_type pos = preproc.find('=');
@@ -2845,6 +3206,8 @@ int main(int argc,char **argv)
       string value = preproc.substr(pos+1);
       defines[name] = value;
     }
+    else if (argv[i][1] == 'b')
+      packedOutput = true;
     else if (argv[i][1] == 'u')
       enableUnnecessaryPcodeWarning = true;
     else if (argv[i][1] == 'l')
@@ -2853,6 +3216,12 @@ int main(int argc,char **argv)
       enableAllCollisionWarning = true;
     else if (argv[i][1] == 'n')
       enableAllNopWarning = true;
+    else if (argv[i][1] == 'p')
+      printTreeStats = true;
+    else if (argv[i][1] == 'k')
+      cacheTrees = true;
+    else if (argv[i][1] == 'M')
+      writeDependencies = true;
     else if (argv[1][1] == 't')
       enableDeadTempWarning = true;
     else if (argv[1][1] == 'e')
@@ -2866,6 +3235,8 @@ int main(int argc,char **argv)
       exit(1);
     }
   }
+  // Default sla extension. Packed output gets its own, so a .sla is always xml
+  const string SLAEXT(packedOutput ? ".slab" : ".sla");
   
   if (compileAll) {
     
@@ -2881,19 +3252,22 @@ int main(int argc,char **argv)
       dirStr = argv[i];
     findSlaSpecs(slaspecs, dirStr,SLASPECEXT);
     cout << "Compiling " << slaspecs.size() << " slaspec files in " << dirStr << "\n";
+    vector<CompileJob> jobs;
     for(int4 j=0;j<slaspecs.size();++j) {
-      string slaspec = slaspecs[j];
-      cout << "Compiling (" << (j+1) << " of " << slaspecs.size() << ") " << slaspec << "\n";
-      string sla = slaspec;
-      sla.replace(slaspec.length() - slaspecExtLen, slaspecExtLen, SLAEXT);
-      SleighCompile compiler;
-      initCompiler(compiler, defines, enableUnnecessaryPcodeWarning, 
-		   disableLenientConflict, enableAllCollisionWarning, enableAllNopWarning,
-		   enableDeadTempWarning, enforceLocalKeyWord);
-      retval = run_compilation(slaspec.c_str(),sla.c_str(),compiler);
-      if (retval != 0) {
-	return retval; // stop on first error
-      }
+      string sla = slaspecs[j];
+      sla.replace(sla.length() - slaspecExtLen, slaspecExtLen, SLAEXT);
+      jobs.push_back(CompileJob(slaspecs[j],sla));
+    }
+    if (numWorkers == 0)
+      numWorkers = max((int4)thread::hardware_concurrency(),1);
+    try {
+      retval = runJobs(jobs,numWorkers,defines,enableUnnecessaryPcodeWarning,
+		       disableLenientConflict,enableAllCollisionWarning,enableAllNopWarning,
+		       enableDeadTempWarning,enforceLocalKeyWord,printTreeStats,cacheTrees,writeDependencies,
+		       packedOutput);
+    } catch(LowlevelError &err) {
+      cerr << "Unrecoverable error: " << err.explain << endl;
+      return 2;
     }
     
   } else { // compile single specification
@@ -2923,7 +3297,8 @@ int main(int argc,char **argv)
     SleighCompile compiler;
     initCompiler(compiler, defines, enableUnnecessaryPcodeWarning, 
 		 disableLenientConflict, enableAllCollisionWarning, enableAllNopWarning,
-		 enableDeadTempWarning, enforceLocalKeyWord);
+		 enableDeadTempWarning, enforceLocalKeyWord, printTreeStats,
+		 cacheTrees, writeDependencies);
     
     if (i < argc - 1) {
       string fileoutExamine(argv[i+1]);
@@ -2931,15 +3306,15 @@ int main(int argc,char **argv)
       if (extOutPos == string::npos) { // No Extension Given...
 	fileoutExamine.append(SLAEXT);
       }
-      retval = run_compilation(fileinExamine.c_str(),fileoutExamine.c_str(),compiler);
+      retval = run_compilation(fileinExamine.c_str(),fileoutExamine.c_str(),compiler,packedOutput);
     }else{
       //First determine whether or not to use Run_XML...
       if (autoExtInSet) { //Assumed format of at least "sleigh file" -> "sleigh file.slaspec file.sla"
 	string fileoutSTR = fileinPreExt;
 	fileoutSTR.append(SLAEXT);
-	retval = run_compilation(fileinExamine.c_str(),fileoutSTR.c_str(),compiler);
+	retval = run_compilation(fileinExamine.c_str(),fileoutSTR.c_str(),compiler,packedOutput);
       }else{
-	retval = run_xml(fileinExamine.c_str(),compiler);
+	retval = run_xml(fileinExamine.c_str(),compiler,packedOutput);
       }
       
     }
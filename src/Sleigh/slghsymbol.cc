@@ -16,6 +16,10 @@
 #include "slghsymbol.hh"
 #include "sleighbase.hh"
 #include <cmath>
+#include <mutex>
+
+// Serializes the deferred restoration of decision trees and p-code templates
+static mutex lazyrestore_lock;
 
 SleighSymbol *SymbolScope::addSymbol(SleighSymbol *a)
 
@@ -165,6 +169,17 @@ void SymbolTable::saveXml(ostream &s) const
 void SymbolTable::restoreXml(const Element *el,SleighBase *trans)
 
 {
+  restoreXmlHeader(el);
+  const List &list(el->getChildren());
+  List::const_iterator iter;
+  int4 i = 0;
+  for(iter=list.begin();iter!=list.end();++iter)
+    restoreXmlChild(*iter,i++,trans);
+}
+
+void SymbolTable::restoreXmlHeader(const Element *el)
+
+{				// Size the tables from the attributes of a <symbol_table> tag
   {
     uint4 size;
     istringstream s(el->getAttributeValue("scopesize"));
@@ -179,50 +194,47 @@ void SymbolTable::restoreXml(const Element *el,SleighBase *trans)
     s >> size;
     symbollist.resize(size,(SleighSymbol *)0);
   }
-  const List &list(el->getChildren());
-  List::const_iterator iter;
-  iter = list.begin();
-  for(int4 i=0;i<table.size();++i) { // Restore the scopes
-    Element *subel = *iter;
-    if (subel->getName() != "scope")
+}
+
+void SymbolTable::restoreXmlChild(const Element *el,int4 i,SleighBase *trans)
+
+{				// Restore child i of a <symbol_table> tag. The scopes come
+				// first, then the symbol shells, then the symbol content
+  if (i < table.size()) {	// Restore a scope
+    if (el->getName() != "scope")
       throw SleighError("Misnumbered symbol scopes");
     uintm id;
     uintm parent;
     {
-      istringstream s(subel->getAttributeValue("id"));
+      istringstream s(el->getAttributeValue("id"));
       s.unsetf(ios::dec | ios::hex | ios::oct);
       s >> id;
     }
     {
-      istringstream s(subel->getAttributeValue("parent"));
+      istringstream s(el->getAttributeValue("parent"));
       s.unsetf(ios::dec | ios::hex | ios::oct);
       s >> parent;
     }
     SymbolScope *parscope = (parent==id) ? (SymbolScope *)0 : table[parent];
     table[id] = new SymbolScope( parscope, id );
-    ++iter;
+    return;
   }
-  curscope = table[0];		// Current scope is global
+  if (i == table.size())
+    curscope = table[0];	// Current scope is global
 
-				// Now restore the symbol shells
-  for(int4 i=0;i<symbollist.size();++i) {
-    restoreSymbolHeader(*iter);
-    ++iter;
+  if (i < table.size() + symbollist.size()) {
+    restoreSymbolHeader(el);	// Restore a symbol shell
+    return;
   }
-				// Now restore the symbol content
-  while(iter != list.end()) {
-    Element *subel = *iter;
-    uintm id;
-    SleighSymbol *sym;
-    {
-      istringstream s(subel->getAttributeValue("id"));
-      s.unsetf(ios::dec | ios::hex | ios::oct);
-      s >> id;
-    }
-    sym = findSymbol(id);
-    sym->restoreXml(subel,trans);
-    ++iter;
+				// Restore the content of a symbol
+  uintm id;
+  {
+    istringstream s(el->getAttributeValue("id"));
+    s.unsetf(ios::dec | ios::hex | ios::oct);
+    s >> id;
   }
+  SleighSymbol *sym = findSymbol(id);
+  sym->restoreXml(el,trans);
 }
 
 void SymbolTable::restoreSymbolHeader(const Element *el)
@@ -425,6 +437,66 @@ PatternlessSymbol::~PatternlessSymbol(void)
   PatternExpression::release(patexp);
 }
 
+AsmPieces::Piece &AsmPieces::addPiece(piece_type tp,const string &text)
+
+{
+  pieces.emplace_back();
+  Piece &piece(pieces.back());
+  piece.type = tp;
+  piece.start = chars.size();
+  piece.len = text.size();
+  piece.value = 0;
+  chars += text;
+  return piece;
+}
+
+/// Write \e val in lowercase hex, with the \e 0x prefix, the same way the
+/// print() methods do through an ostream.
+static void appendHex(string &res,uintb val)
+
+{
+  char buf[2*sizeof(uintb)];
+  int4 pos = sizeof(buf);
+  do {
+    buf[--pos] = "0123456789abcdef"[val & 0xf];
+    val >>= 4;
+  } while(val != 0);
+  res += "0x";
+  res.append(buf+pos,sizeof(buf)-pos);
+}
+
+void AsmPieces::appendText(string &res,int4 first,int4 last) const
+
+{ // Format pieces [first,last) onto the end of -res-
+  for(int4 i=first;i<last;++i) {
+    const Piece &piece(pieces[i]);
+    switch(piece.type) {
+    case constant:
+      if (piece.value < 0) {
+	res += '-';
+	appendHex(res,(uintb)0 - (uintb)piece.value);
+      }
+      else
+	appendHex(res,(uintb)piece.value);
+      break;
+    case address:
+      appendHex(res,(uintb)piece.value);
+      break;
+    default:
+      res.append(chars,piece.start,piece.len);
+      break;
+    }
+  }
+}
+
+void TripleSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{ // Symbols without a structured form hand over their printed text
+  ostringstream s;
+  print(s,walker);
+  pieces.addName(s.str());
+}
+
 void EpsilonSymbol::getFixedHandle(FixedHandle &hand,ParserWalker &walker) const
 
 {
@@ -440,6 +512,12 @@ void EpsilonSymbol::print(ostream &s,ParserWalker &walker) const
   s << '0';
 }
 
+void EpsilonSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{ // Plain "0" as print() gives, not the "0x0" of a constant piece
+  pieces.addName("0");
+}
+
 VarnodeTpl *EpsilonSymbol::getVarnode(void) const
 
 {
@@ -503,6 +581,12 @@ void ValueSymbol::print(ostream &s,ParserWalker &walker) const
     s << "-0x" << hex << -val;
 }
 
+void ValueSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{
+  pieces.addConstant(patval->getValue(walker));
+}
+
 void ValueSymbol::saveXml(ostream &s) const
 
 {
@@ -582,6 +666,14 @@ void ValueMapSymbol::print(ostream &s,ParserWalker &walker) const
     s << "-0x" << hex << -val;
 }
 
+void ValueMapSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{
+  uint4 ind = (uint4)patval->getValue(walker);
+  // ind is already checked to be in range by the resolve routine
+  pieces.addConstant(valuetable[ind]);
+}
+
 void ValueMapSymbol::saveXml(ostream &s) const
 
 {
@@ -660,6 +752,14 @@ void NameSymbol::print(ostream &s,ParserWalker &walker) const
   s << nametable[ind];
 }
 
+void NameSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{
+  uint4 ind = (uint4)patval->getValue(walker);
+  // ind is already checked to be in range by the resolve routine
+  pieces.addName(nametable[ind]);
+}
+
 void NameSymbol::saveXml(ostream &s) const
 
 {
@@ -903,6 +1003,16 @@ void VarnodeListSymbol::print(ostream &s,ParserWalker &walker) const
   s << varnode_table[ind]->getName();
 }
 
+void VarnodeListSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{
+  uint4 ind = (uint4)patval->getValue(walker);
+  if (ind >= varnode_table.size())
+    throw SleighError("Value out of range for varnode table");
+  const VarnodeSymbol *vnsym = varnode_table[ind];
+  pieces.addRegister(vnsym->getName(),vnsym->getFixedVarnode());
+}
+
 void VarnodeListSymbol::saveXml(ostream &s) const
 
 {
@@ -1041,6 +1151,21 @@ void OperandSymbol::print(ostream &s,ParserWalker &walker) const
   walker.popOperand();
 }
 
+void OperandSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{
+  walker.pushOperand(getIndex());
+  if (triple != (TripleSymbol *)0) {
+    if (triple->getType() == SleighSymbol::subtable_symbol)
+      walker.getConstructor()->emit(pieces,walker);
+    else
+      triple->emit(pieces,walker);
+  }
+  else
+    pieces.addConstant(defexp->getValue(walker));
+  walker.popOperand();
+}
+
 void OperandSymbol::collectLocalValues(vector<uintb> &results) const
 
 {
@@ -1166,6 +1291,12 @@ void StartSymbol::print(ostream &s,ParserWalker &walker) const
   s << "0x" << hex << val;
 }
 
+void StartSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{
+  pieces.addAddress(walker.getAddr().getOffset());
+}
+
 void StartSymbol::saveXml(ostream &s) const
 
 {
@@ -1230,6 +1361,12 @@ void EndSymbol::print(ostream &s,ParserWalker &walker) const
   s << "0x" << hex << val;
 }
 
+void EndSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{
+  pieces.addAddress(walker.getNaddr().getOffset());
+}
+
 void EndSymbol::saveXml(ostream &s) const
 
 {
@@ -1286,6 +1423,12 @@ void FlowDestSymbol::print(ostream &s,ParserWalker &walker) const
   s << "0x" << hex << val;
 }
 
+void FlowDestSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{
+  pieces.addAddress(walker.getDestAddr().getOffset());
+}
+
 void FlowDestSymbol::saveXml(ostream &s) const
 
 {
@@ -1340,6 +1483,12 @@ void FlowRefSymbol::print(ostream &s,ParserWalker &walker) const
   s << "0x" << hex << val;
 }
 
+void FlowRefSymbol::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{
+  pieces.addAddress(walker.getRefAddr().getOffset());
+}
+
 void FlowRefSymbol::saveXml(ostream &s) const
 
 {
@@ -1363,24 +1512,28 @@ void FlowRefSymbol::restoreXml(const Element *el,SleighBase *trans)
 }
 
 Constructor::Constructor(void)
-
+  : templready(true)
 {
   pattern = (TokenPattern *)0;
   parent = (SubtableSymbol *)0;
   pateq = (PatternEquation *)0;
   templ = (ConstructTpl *)0;
+  templel = (const Element *)0;
+  templtrans = (SleighBase *)0;
   firstwhitespace = -1;
   flowthruindex = -1;
   inerror = false;
 }
 
 Constructor::Constructor(SubtableSymbol *p)
-
+  : templready(true)
 {
   pattern = (TokenPattern *)0;
   parent = p;
   pateq = (PatternEquation *)0;
   templ = (ConstructTpl *)0;
+  templel = (const Element *)0;
+  templtrans = (SleighBase *)0;
   firstwhitespace = -1;
   inerror = false;
 }
@@ -1467,6 +1620,8 @@ void Constructor::setNamedSection(ConstructTpl *tpl,int4 id)
 ConstructTpl *Constructor::getNamedTempl(int4 secnum) const
 
 {
+  if (!templready.load(memory_order_acquire))
+    restoreTemplates();
   if (secnum < namedtempl.size())
     return namedtempl[secnum];
   return (ConstructTpl *)0;
@@ -1533,6 +1688,49 @@ void Constructor::printBody(ostream &s,ParserWalker &walker) const
   }
 }
 
+void Constructor::emit(AsmPieces &pieces,ParserWalker &walker) const
+
+{ // The structured counterpart of print()
+  for(int4 i=0;i<printpiece.size();++i) {
+    if (printpiece[i][0] == '\n') {
+      int4 index = printpiece[i][1]-'A';
+      operands[index]->emit(pieces,walker);
+    }
+    else
+      pieces.addLiteral(printpiece[i]);
+  }
+}
+
+void Constructor::emitAssembly(AsmPieces &pieces,ParserWalker &walker) const
+
+{ // The structured counterpart of printMnemonic() followed by printBody(). The
+  // mnemonic pieces come first, and AsmPieces::getBodyStart() marks the rest.
+  if (flowthruindex != -1) {
+    SubtableSymbol *sym = dynamic_cast<SubtableSymbol *>(operands[flowthruindex]->getDefiningSymbol());
+    if (sym != (SubtableSymbol *)0) {
+      walker.pushOperand(flowthruindex);
+      walker.getConstructor()->emitAssembly(pieces,walker);
+      walker.popOperand();
+      return;
+    }
+  }
+  int4 endind = (firstwhitespace==-1) ? printpiece.size() : firstwhitespace;
+  for(int4 i=0;i<printpiece.size();++i) {
+    if (i == endind) {
+      pieces.startBody();
+      continue;			// The whitespace separating mnemonic and body
+    }
+    if (printpiece[i][0] == '\n') {
+      int4 index = printpiece[i][1]-'A';
+      operands[index]->emit(pieces,walker);
+    }
+    else
+      pieces.addLiteral(printpiece[i]);
+  }
+  if (endind == printpiece.size())
+    pieces.startBody();
+}
+
 void Constructor::removeTrailingSpace(void)
 
 {
@@ -1559,8 +1757,9 @@ void Constructor::markSubtableOperands(vector<int4> &check) const
 void Constructor::collectLocalExports(vector<uintb> &results) const
 
 {
-  if (templ == (ConstructTpl *)0) return;
-  HandleTpl *handle = templ->getResult();
+  ConstructTpl *tpl = getTempl();
+  if (tpl == (ConstructTpl *)0) return;
+  HandleTpl *handle = tpl->getResult();
   if (handle == (HandleTpl *)0) return;
   if (handle->getSpace().isConstSpace()) return;	// Even if the value is dynamic, the pointed to value won't get used
   if (handle->getPtrSpace().getType() != ConstTpl::real) {
@@ -1682,22 +1881,8 @@ void Constructor::restoreXml(const Element *el,SleighBase *trans)
       c_op->restoreXml(*iter,trans);
       context.push_back(c_op);
     }
-    else {
-      ConstructTpl *cur = new ConstructTpl();
-      int4 sectionid = cur->restoreXml(*iter,trans);
-      if (sectionid < 0) {
-	if (templ != (ConstructTpl *)0)
-	  throw LowlevelError("Duplicate main section");
-	templ = cur;
-      }
-      else {
-	while(namedtempl.size() <= sectionid)
-	  namedtempl.push_back((ConstructTpl *)0);
-	if (namedtempl[sectionid] != (ConstructTpl *)0)
-	  throw LowlevelError("Duplicate named section");
-	namedtempl[sectionid] = cur;
-      }
-    }
+    else if (!trans->isLazyRestore())
+      restoreSection(*iter,trans);
     ++iter;
   }
   pattern = (TokenPattern *)0;
@@ -1705,6 +1890,47 @@ void Constructor::restoreXml(const Element *el,SleighBase *trans)
     flowthruindex = printpiece[0][1] - 'A';
   else
     flowthruindex = -1;
+  if (trans->isLazyRestore()) {	// Keep the element; the sections are restored by getTempl()
+    templel = el;
+    templtrans = trans;
+    templready.store(false,memory_order_release);
+  }
+}
+
+void Constructor::restoreSection(const Element *el,SleighBase *trans) const
+
+{				// Restore one p-code section, main or named
+  ConstructTpl *cur = new ConstructTpl();
+  int4 sectionid = cur->restoreXml(el,trans);
+  if (sectionid < 0) {
+    if (templ != (ConstructTpl *)0)
+      throw LowlevelError("Duplicate main section");
+    templ = cur;
+  }
+  else {
+    while(namedtempl.size() <= sectionid)
+      namedtempl.push_back((ConstructTpl *)0);
+    if (namedtempl[sectionid] != (ConstructTpl *)0)
+      throw LowlevelError("Duplicate named section");
+    namedtempl[sectionid] = cur;
+  }
+}
+
+void Constructor::restoreTemplates(void) const
+
+{				// Restore the p-code sections skipped by a lazy restoreXml()
+  lock_guard<mutex> guard(lazyrestore_lock);
+  if (templready.load(memory_order_relaxed)) return; // Another thread got here first
+  const List &list(templel->getChildren());
+  List::const_iterator iter;
+  for(iter=list.begin();iter!=list.end();++iter) {
+    const string &nm((*iter)->getName());
+    if (nm == "oper" || nm == "print" || nm == "opprint" || nm == "context_op" || nm == "commit")
+      continue;
+    restoreSection(*iter,templtrans);
+  }
+  templel = (const Element *)0;
+  templready.store(true,memory_order_release);
 }
 
 void Constructor::orderOperands(void)
@@ -1878,12 +2104,13 @@ void Constructor::printInfo(ostream &s) const
   s << "\" constructor starting at line " << dec << lineno;
 }
 
-SubtableSymbol::SubtableSymbol(const string &nm) : TripleSymbol(nm)
+SubtableSymbol::SubtableSymbol(const string &nm) : TripleSymbol(nm), treeready(true)
 
 {
   beingbuilt = false;
   pattern = (TokenPattern *)0;
   decisiontree = (DecisionNode *)0;
+  decisionel = (const Element *)0;
   errors = 0;
 }
 
@@ -1947,8 +2174,15 @@ void SubtableSymbol::restoreXml(const Element *el,SleighBase *trans)
       ct->restoreXml(*iter,trans);
     }
     else if ((*iter)->getName() == "decision") {
-      decisiontree = new DecisionNode();
-      decisiontree->restoreXml(*iter,(DecisionNode *)0,this);
+      if (trans->isLazyRestore()) { // Build the tree on the first resolve()
+	decisionel = *iter;
+	treeready.store(false,memory_order_release);
+      }
+      else {
+	decisiontree = new DecisionNode();
+	decisiontree->restoreXml(*iter,(DecisionNode *)0,this);
+	table.build(decisiontree);
+      }
     }
     ++iter;
   }
@@ -1957,6 +2191,18 @@ void SubtableSymbol::restoreXml(const Element *el,SleighBase *trans)
   errors = 0;
 }
 
+void SubtableSymbol::restoreDecision(void)
+
+{				// Restore the decision tree skipped by a lazy restoreXml()
+  lock_guard<mutex> guard(lazyrestore_lock);
+  if (treeready.load(memory_order_relaxed)) return; // Another thread got here first
+  decisiontree = new DecisionNode();
+  decisiontree->restoreXml(decisionel,(DecisionNode *)0,this);
+  table.build(decisiontree);
+  decisionel = (const Element *)0;
+  treeready.store(true,memory_order_release);
+}
+
 void SubtableSymbol::buildDecisionTree(DecisionProperties &props)
 
 {				// Associate pattern disjoints to constructors
@@ -1974,6 +2220,28 @@ void SubtableSymbol::buildDecisionTree(DecisionProperties &props)
   decisiontree->split(props);	// Create the decision strategy
 }
 
+void SubtableSymbol::restoreDecisionTree(const Element *el)
+
+{				// Take a tree saved by buildDecisionTree() from a previous compile
+  if (decisiontree != (DecisionNode *)0)
+    delete decisiontree;
+  decisiontree = new DecisionNode();
+  decisiontree->restoreXml(el,(DecisionNode *)0,this);
+}
+
+void SubtableSymbol::saveXmlTreeInput(ostream &s) const
+
+{				// Everything buildDecisionTree() bases the tree on: the pattern
+				// disjoints of each constructor, in order
+  s << "<treeinput name=\"" << getName() << "\">\n";
+  for(int4 i=0;i<construct.size();++i) {
+    s << "<pair id=\"" << dec << construct[i]->getId() << "\">\n";
+    construct[i]->getPattern()->getPattern()->saveXml(s);
+    s << "</pair>\n";
+  }
+  s << "</treeinput>\n";
+}
+
 TokenPattern *SubtableSymbol::buildPattern(ostream &s)
 
 {
@@ -2086,54 +2354,115 @@ int4 DecisionNode::getMaximumLength(bool context)
   return max;
 }
 
-int4 DecisionNode::getNumFixed(int4 low,int4 size,bool context)
+// The bits of every pattern at one DecisionNode, stored by column: for each bit
+// position, a bitset of the patterns that fix the bit, and one of the patterns that fix
+// it to 1.  How many patterns fix a field, and how they spread over its values, are then
+// a few word-wide ANDs and popcounts per field rather than a getMask() and getValue()
+// call per pattern.
+class PatternMatrix {
+  int4 numwords;		// Words in one column bitset
+  int4 numbits;			// Bit positions covered
+  vector<uint8> fixed;		// Patterns fixing each bit, numwords per bit
+  vector<uint8> ones;		// Patterns fixing each bit to 1
+  vector<uint8> scratch;	// One bitset per level of the bin partition
+  void partition(const uint8 *set,int4 low,int4 size,int4 depth,uintm val,vector<int4> &count);
+public:
+  PatternMatrix(const vector<pair<DisjointPattern *,Constructor *> > &list,int4 maxlength,bool context);
+  int4 getNumFixed(int4 low,int4 size,uint8 *all) const;
+  double getScore(int4 low,int4 size,const uint8 *all,int4 listsize);
+  int4 getNumWords(void) const { return numwords; }
+};
+
+PatternMatrix::PatternMatrix(const vector<pair<DisjointPattern *,Constructor *> > &list,int4 maxlength,bool context)
+
+{
+  numwords = (list.size() + 63) / 64;
+  numbits = maxlength;
+  fixed.assign(numbits * numwords,0);
+  ones.assign(numbits * numwords,0);
+  scratch.resize(9 * numwords);
+  for(int4 i=0;i<list.size();++i) {
+    uint8 bit = ((uint8)1) << (i%64);
+    int4 word = i/64;
+    for(int4 sbit=0;sbit<numbits;sbit+=8) { // maxlength is a whole number of bytes
+      uintm mask = list[i].first->getMask(sbit,8,context);
+      if (mask == 0) continue;
+      uintm val = list[i].first->getValue(sbit,8,context);
+      for(int4 j=0;j<8;++j) {
+	uintm m = ((uintm)0x80) >> j; // First bit of the field is the most significant
+	if ((mask & m) == 0) continue;
+	fixed[(sbit+j)*numwords + word] |= bit;
+	if ((val & m) != 0)
+	  ones[(sbit+j)*numwords + word] |= bit;
+      }
+    }
+  }
+}
+
+int4 PatternMatrix::getNumFixed(int4 low,int4 size,uint8 *all) const
 
-{				// Get number of patterns that specify this field
+{				// Get number of patterns that specify this field, and which ones in -all-
   int4 count = 0;
-  uintm mask;
-				// Bits which must be specified in the mask
-  uintm m = (size==8*sizeof(uintm)) ? 0 : (((uintm)1)<<size);
-  m = m-1;
-
-  for(int4 i=0;i<list.size();++i) {
-    mask = list[i].first->getMask(low,size,context);
-    if ((mask&m)==m)
-      count += 1;
+  for(int4 w=0;w<numwords;++w) {
+    uint8 res = fixed[low*numwords + w];
+    for(int4 i=1;i<size;++i)
+      res &= fixed[(low+i)*numwords + w];
+    all[w] = res;
+    count += __builtin_popcountll(res);
   }
   return count;
 }
 
-double DecisionNode::getScore(int4 low,int4 size,bool context)
+void PatternMatrix::partition(const uint8 *set,int4 low,int4 size,int4 depth,uintm val,vector<int4> &count)
 
-{
-  int4 numBins = 1 << size;		// size is between 1 and 8
-  int4 i;
-  uintm val,mask;
-  uintm m = ((uintm)1)<<size;
-  m = m-1;
+{				// Split -set- on the remaining bits of the field, counting each bin
+  if (depth == size) {
+    int4 total = 0;
+    for(int4 w=0;w<numwords;++w)
+      total += __builtin_popcountll(set[w]);
+    count[val] = total;
+    return;
+  }
+  uint8 *one = scratch.data() + depth * numwords;
+  const uint8 *col = ones.data() + (low+depth)*numwords;
+  bool anyzero = false;
+  bool anyone = false;
+  for(int4 w=0;w<numwords;++w) {
+    one[w] = set[w] & col[w];
+    anyone = anyone || (one[w] != 0);
+    anyzero = anyzero || ((set[w] & ~col[w]) != 0);
+  }
+  if (anyone)
+    partition(one,low,size,depth+1,(val<<1)|1,count);
+  if (anyzero) {			// Reuse the same level for the zero half
+    for(int4 w=0;w<numwords;++w)
+      one[w] = set[w] & ~col[w];
+    partition(one,low,size,depth+1,val<<1,count);
+  }
+}
 
-  int4 total = 0;
-  vector<int4> count(numBins,0);
+double PatternMatrix::getScore(int4 low,int4 size,const uint8 *all,int4 listsize)
 
-  for(i=0;i<list.size();++i) {
-    mask = list[i].first->getMask(low,size,context);
-    if ((mask&m)!=m) continue;	// Skip if field not fully specified
-    val = list[i].first->getValue(low,size,context);
-    total += 1;
-    count[val] += 1;
-  }
+{				// Same score as DecisionNode::getScore over the patterns in -all-
+  int4 numBins = 1 << size;		// size is between 1 and 8
+  int4 total = 0;
+  for(int4 w=0;w<numwords;++w)
+    total += __builtin_popcountll(all[w]);
   if (total <= 0) return -1.0;
+
+  vector<int4> count(numBins,0);
+  partition(all,low,size,0,0,count);
   double sc = 0.0;
-  for(i=0;i<numBins;++i) {
+  for(int4 i=0;i<numBins;++i) {
     if (count[i] <= 0) continue;
-    if (count[i] >= list.size()) return -1.0;
+    if (count[i] >= listsize) return -1.0;
     double p = ((double)count[i])/total;
     sc -= p * log(p);
   }
   return ( sc / log(2.0) );
 }
 
-void DecisionNode::chooseOptimalField(void)
+void DecisionNode::chooseOptimalField(DecisionProperties &props)
 
 {
   double score = 0.0;
@@ -2144,14 +2473,21 @@ void DecisionNode::chooseOptimalField(void)
 
   int4 maxlength,numfixed,maxfixed;
 
+  // Both matrices are built once and then serve every candidate field
+  PatternMatrix contextbits(list,8*getMaximumLength(true),true);
+  PatternMatrix instrbits(list,8*getMaximumLength(false),false);
+  vector<uint8> all(instrbits.getNumWords());
+
   maxfixed = 1;
   context = true;
   do {
+    PatternMatrix &matrix( context ? contextbits : instrbits );
     maxlength = 8*getMaximumLength(context);
     for(sbit=0;sbit<maxlength;++sbit) {
-      numfixed = getNumFixed(sbit,1,context); // How may patterns specify this bit
+      numfixed = matrix.getNumFixed(sbit,1,all.data()); // How may patterns specify this bit
       if (numfixed < maxfixed) continue; // Skip this bit, if we don't have maximum specification
-      sc = getScore(sbit,1,context);
+      sc = matrix.getScore(sbit,1,all.data(),list.size());
+      props.countField();
 
  // if we got more patterns this time than previously, and a positive score, reset
  // the high score (we prefer this bit, because it has a higher numfixed, regardless
@@ -2177,11 +2513,13 @@ void DecisionNode::chooseOptimalField(void)
 
   context = true;
   do {
+    PatternMatrix &matrix( context ? contextbits : instrbits );
     maxlength = 8*getMaximumLength(context);
     for(size=2;size <= 8;++size) {
       for(sbit=0;sbit<maxlength-size+1;++sbit) {
-	if (getNumFixed(sbit,size,context) < maxfixed) continue; // Consider only maximal fields
-	sc = getScore(sbit,size,context);
+	if (matrix.getNumFixed(sbit,size,all.data()) < maxfixed) continue; // Consider only maximal fields
+	sc = matrix.getScore(sbit,size,all.data(),list.size());
+	props.countField();
 	if (sc > score) {
 	  score = sc;
 	  startbit = sbit;
@@ -2217,12 +2555,13 @@ void DecisionNode::consistentValues(vector<uint4> &bins,DisjointPattern *pat)
 void DecisionNode::split(DecisionProperties &props)
 
 {
+  props.countNode();
   if (list.size() <= 1) {
     bitsize = 0;		// Only one pattern, terminal node by default
     return;
   }
 
-  chooseOptimalField();
+  chooseOptimalField(props);
   if (bitsize == 0) {
     orderPatterns(props);
     return;
@@ -2428,6 +2767,109 @@ void DecisionNode::restoreXml(const Element *el,DecisionNode *par,SubtableSymbol
   }
 }
 
+void DecisionTable::clear(void)
+
+{
+  nodes.clear();
+  leaves.clear();
+  words.clear();
+}
+
+uint2 DecisionTable::addWords(const PatternBlock *block,bool &never)
+
+{ // Append the mask/value words of -block-, return how many were added
+  if (block == (const PatternBlock *)0) return 0;
+  if (block->alwaysFalse()) {
+    never = true;
+    return 0;
+  }
+  if (block->alwaysTrue()) return 0;
+  int4 num = block->numWords();
+  for(int4 i=0;i<num;++i) {
+    words.push_back(PatternWord());
+    PatternWord &word(words.back());
+    word.offset = block->getOffset() + i*sizeof(uintm);
+    word.mask = block->getMaskWord(i);
+    word.value = block->getValueWord(i);
+  }
+  return num;
+}
+
+void DecisionTable::addLeaf(const DisjointPattern *pat,Constructor *ct)
+
+{
+  Leaf leaf;
+  leaf.ct = ct;
+  leaf.first = words.size();
+  leaf.never = false;
+  leaf.numinstr = addWords(pat->getPatternBlock(false),leaf.never);
+  leaf.numcontext = addWords(pat->getPatternBlock(true),leaf.never);
+  leaves.push_back(leaf);
+}
+
+void DecisionTable::build(const DecisionNode *root)
+
+{ // Lower the tree breadth first, so the children of each node end up next to each other
+  clear();
+  vector<const DecisionNode *> order;	// order[i] is the DecisionNode lowered into nodes[i]
+  order.push_back(root);
+  nodes.push_back(Node());
+  for(uint4 i=0;i<order.size();++i) {
+    const DecisionNode *src = order[i];
+    nodes[i].startbit = src->startbit;
+    nodes[i].bitsize = src->bitsize;
+    nodes[i].contextdecision = src->contextdecision;
+    if (src->bitsize == 0) {
+      nodes[i].first = leaves.size();
+      nodes[i].count = src->list.size();
+      for(int4 j=0;j<src->list.size();++j)
+	addLeaf(src->list[j].first,src->list[j].second);
+    }
+    else {
+      nodes[i].first = nodes.size();
+      nodes[i].count = src->children.size();
+      for(int4 j=0;j<src->children.size();++j) {
+	order.push_back(src->children[j]);
+	nodes.push_back(Node());
+      }
+    }
+  }
+}
+
+Constructor *DecisionTable::resolve(ParserWalker &walker) const
+
+{ // Same result as DecisionNode::resolve on the tree this table was built from
+  const Node *node = nodes.data();
+  while(node->bitsize != 0) {
+    uintm val;
+    if (node->contextdecision)
+      val = walker.getContextBits(node->startbit,node->bitsize);
+    else
+      val = walker.getInstructionBits(node->startbit,node->bitsize);
+    node = nodes.data() + node->first + val;
+  }
+  const Leaf *leaf = leaves.data() + node->first;
+  const Leaf *endleaf = leaf + node->count;
+  for(;leaf!=endleaf;++leaf) {
+    if (leaf->never) continue;
+    const PatternWord *word = words.data() + leaf->first;
+    const PatternWord *endword = word + leaf->numinstr;
+    for(;word!=endword;++word)
+      if ((walker.getInstructionBytes(word->offset,sizeof(uintm)) & word->mask) != word->value) break;
+    if (word != endword) continue;
+    endword += leaf->numcontext;
+    for(;word!=endword;++word)
+      if ((walker.getContextBytes(word->offset,sizeof(uintm)) & word->mask) != word->value) break;
+    if (word != endword) continue;
+    return leaf->ct;
+  }
+  ostringstream s;
+  s << walker.getAddr().getShortcut();
+  walker.getAddr().printRaw(s);
+  s << ": Unable to resolve constructor";
+  throw BadDataError(s.str());
+}
+
 static void calc_maskword(int4 sbit,int4 ebit,int4 &num,int4 &shift,uintm &mask)
 
 {
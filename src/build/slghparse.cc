@@ -0,0 +1,4188 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 16 "parser-tools/slghparse.y"
+
+#include "slgh_compile.hh"
+
+#define YYERROR_VERBOSE
+
+  extern SleighCompile *slgh;
+  extern int4 actionon;
+  extern FILE *yyin;
+  extern int yydebug;
+  extern int yylex(void);
+  extern int yyerror(const char *str );
+
+#line 84 "src/build/slghparse.cc"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "slghparse.hh"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_OP_BOOL_OR = 3,                 /* OP_BOOL_OR  */
+  YYSYMBOL_OP_BOOL_AND = 4,                /* OP_BOOL_AND  */
+  YYSYMBOL_OP_BOOL_XOR = 5,                /* OP_BOOL_XOR  */
+  YYSYMBOL_6_ = 6,                         /* '|'  */
+  YYSYMBOL_OP_OR = 7,                      /* OP_OR  */
+  YYSYMBOL_8_ = 8,                         /* ';'  */
+  YYSYMBOL_9_ = 9,                         /* '^'  */
+  YYSYMBOL_OP_XOR = 10,                    /* OP_XOR  */
+  YYSYMBOL_11_ = 11,                       /* '&'  */
+  YYSYMBOL_OP_AND = 12,                    /* OP_AND  */
+  YYSYMBOL_OP_EQUAL = 13,                  /* OP_EQUAL  */
+  YYSYMBOL_OP_NOTEQUAL = 14,               /* OP_NOTEQUAL  */
+  YYSYMBOL_OP_FEQUAL = 15,                 /* OP_FEQUAL  */
+  YYSYMBOL_OP_FNOTEQUAL = 16,              /* OP_FNOTEQUAL  */
+  YYSYMBOL_17_ = 17,                       /* '<'  */
+  YYSYMBOL_18_ = 18,                       /* '>'  */
+  YYSYMBOL_OP_GREATEQUAL = 19,             /* OP_GREATEQUAL  */
+  YYSYMBOL_OP_LESSEQUAL = 20,              /* OP_LESSEQUAL  */
+  YYSYMBOL_OP_SLESS = 21,                  /* OP_SLESS  */
+  YYSYMBOL_OP_SGREATEQUAL = 22,            /* OP_SGREATEQUAL  */
+  YYSYMBOL_OP_SLESSEQUAL = 23,             /* OP_SLESSEQUAL  */
+  YYSYMBOL_OP_SGREAT = 24,                 /* OP_SGREAT  */
+  YYSYMBOL_OP_FLESS = 25,                  /* OP_FLESS  */
+  YYSYMBOL_OP_FGREAT = 26,                 /* OP_FGREAT  */
+  YYSYMBOL_OP_FLESSEQUAL = 27,             /* OP_FLESSEQUAL  */
+  YYSYMBOL_OP_FGREATEQUAL = 28,            /* OP_FGREATEQUAL  */
+  YYSYMBOL_OP_LEFT = 29,                   /* OP_LEFT  */
+  YYSYMBOL_OP_RIGHT = 30,                  /* OP_RIGHT  */
+  YYSYMBOL_OP_SRIGHT = 31,                 /* OP_SRIGHT  */
+  YYSYMBOL_32_ = 32,                       /* '+'  */
+  YYSYMBOL_33_ = 33,                       /* '-'  */
+  YYSYMBOL_OP_FADD = 34,                   /* OP_FADD  */
+  YYSYMBOL_OP_FSUB = 35,                   /* OP_FSUB  */
+  YYSYMBOL_36_ = 36,                       /* '*'  */
+  YYSYMBOL_37_ = 37,                       /* '/'  */
+  YYSYMBOL_38_ = 38,                       /* '%'  */
+  YYSYMBOL_OP_SDIV = 39,                   /* OP_SDIV  */
+  YYSYMBOL_OP_SREM = 40,                   /* OP_SREM  */
+  YYSYMBOL_OP_FMULT = 41,                  /* OP_FMULT  */
+  YYSYMBOL_OP_FDIV = 42,                   /* OP_FDIV  */
+  YYSYMBOL_43_ = 43,                       /* '!'  */
+  YYSYMBOL_44_ = 44,                       /* '~'  */
+  YYSYMBOL_OP_ZEXT = 45,                   /* OP_ZEXT  */
+  YYSYMBOL_OP_CARRY = 46,                  /* OP_CARRY  */
+  YYSYMBOL_OP_BORROW = 47,                 /* OP_BORROW  */
+  YYSYMBOL_OP_SEXT = 48,                   /* OP_SEXT  */
+  YYSYMBOL_OP_SCARRY = 49,                 /* OP_SCARRY  */
+  YYSYMBOL_OP_SBORROW = 50,                /* OP_SBORROW  */
+  YYSYMBOL_OP_NAN = 51,                    /* OP_NAN  */
+  YYSYMBOL_OP_ABS = 52,                    /* OP_ABS  */
+  YYSYMBOL_OP_SQRT = 53,                   /* OP_SQRT  */
+  YYSYMBOL_OP_CEIL = 54,                   /* OP_CEIL  */
+  YYSYMBOL_OP_FLOOR = 55,                  /* OP_FLOOR  */
+  YYSYMBOL_OP_ROUND = 56,                  /* OP_ROUND  */
+  YYSYMBOL_OP_INT2FLOAT = 57,              /* OP_INT2FLOAT  */
+  YYSYMBOL_OP_FLOAT2FLOAT = 58,            /* OP_FLOAT2FLOAT  */
+  YYSYMBOL_OP_TRUNC = 59,                  /* OP_TRUNC  */
+  YYSYMBOL_OP_CPOOLREF = 60,               /* OP_CPOOLREF  */
+  YYSYMBOL_OP_NEW = 61,                    /* OP_NEW  */
+  YYSYMBOL_BADINTEGER = 62,                /* BADINTEGER  */
+  YYSYMBOL_GOTO_KEY = 63,                  /* GOTO_KEY  */
+  YYSYMBOL_CALL_KEY = 64,                  /* CALL_KEY  */
+  YYSYMBOL_RETURN_KEY = 65,                /* RETURN_KEY  */
+  YYSYMBOL_IF_KEY = 66,                    /* IF_KEY  */
+  YYSYMBOL_DEFINE_KEY = 67,                /* DEFINE_KEY  */
+  YYSYMBOL_ATTACH_KEY = 68,                /* ATTACH_KEY  */
+  YYSYMBOL_MACRO_KEY = 69,                 /* MACRO_KEY  */
+  YYSYMBOL_SPACE_KEY = 70,                 /* SPACE_KEY  */
+  YYSYMBOL_TYPE_KEY = 71,                  /* TYPE_KEY  */
+  YYSYMBOL_RAM_KEY = 72,                   /* RAM_KEY  */
+  YYSYMBOL_DEFAULT_KEY = 73,               /* DEFAULT_KEY  */
+  YYSYMBOL_REGISTER_KEY = 74,              /* REGISTER_KEY  */
+  YYSYMBOL_ENDIAN_KEY = 75,                /* ENDIAN_KEY  */
+  YYSYMBOL_WITH_KEY = 76,                  /* WITH_KEY  */
+  YYSYMBOL_ALIGN_KEY = 77,                 /* ALIGN_KEY  */
+  YYSYMBOL_OP_UNIMPL = 78,                 /* OP_UNIMPL  */
+  YYSYMBOL_TOKEN_KEY = 79,                 /* TOKEN_KEY  */
+  YYSYMBOL_SIGNED_KEY = 80,                /* SIGNED_KEY  */
+  YYSYMBOL_NOFLOW_KEY = 81,                /* NOFLOW_KEY  */
+  YYSYMBOL_HEX_KEY = 82,                   /* HEX_KEY  */
+  YYSYMBOL_DEC_KEY = 83,                   /* DEC_KEY  */
+  YYSYMBOL_BIG_KEY = 84,                   /* BIG_KEY  */
+  YYSYMBOL_LITTLE_KEY = 85,                /* LITTLE_KEY  */
+  YYSYMBOL_SIZE_KEY = 86,                  /* SIZE_KEY  */
+  YYSYMBOL_WORDSIZE_KEY = 87,              /* WORDSIZE_KEY  */
+  YYSYMBOL_OFFSET_KEY = 88,                /* OFFSET_KEY  */
+  YYSYMBOL_NAMES_KEY = 89,                 /* NAMES_KEY  */
+  YYSYMBOL_VALUES_KEY = 90,                /* VALUES_KEY  */
+  YYSYMBOL_VARIABLES_KEY = 91,             /* VARIABLES_KEY  */
+  YYSYMBOL_PCODEOP_KEY = 92,               /* PCODEOP_KEY  */
+  YYSYMBOL_IS_KEY = 93,                    /* IS_KEY  */
+  YYSYMBOL_LOCAL_KEY = 94,                 /* LOCAL_KEY  */
+  YYSYMBOL_DELAYSLOT_KEY = 95,             /* DELAYSLOT_KEY  */
+  YYSYMBOL_CROSSBUILD_KEY = 96,            /* CROSSBUILD_KEY  */
+  YYSYMBOL_EXPORT_KEY = 97,                /* EXPORT_KEY  */
+  YYSYMBOL_BUILD_KEY = 98,                 /* BUILD_KEY  */
+  YYSYMBOL_CONTEXT_KEY = 99,               /* CONTEXT_KEY  */
+  YYSYMBOL_ELLIPSIS_KEY = 100,             /* ELLIPSIS_KEY  */
+  YYSYMBOL_GLOBALSET_KEY = 101,            /* GLOBALSET_KEY  */
+  YYSYMBOL_BITRANGE_KEY = 102,             /* BITRANGE_KEY  */
+  YYSYMBOL_CHAR = 103,                     /* CHAR  */
+  YYSYMBOL_INTEGER = 104,                  /* INTEGER  */
+  YYSYMBOL_INTB = 105,                     /* INTB  */
+  YYSYMBOL_STRING = 106,                   /* STRING  */
+  YYSYMBOL_SYMBOLSTRING = 107,             /* SYMBOLSTRING  */
+  YYSYMBOL_SPACESYM = 108,                 /* SPACESYM  */
+  YYSYMBOL_SECTIONSYM = 109,               /* SECTIONSYM  */
+  YYSYMBOL_TOKENSYM = 110,                 /* TOKENSYM  */
+  YYSYMBOL_USEROPSYM = 111,                /* USEROPSYM  */
+  YYSYMBOL_VALUESYM = 112,                 /* VALUESYM  */
+  YYSYMBOL_VALUEMAPSYM = 113,              /* VALUEMAPSYM  */
+  YYSYMBOL_CONTEXTSYM = 114,               /* CONTEXTSYM  */
+  YYSYMBOL_NAMESYM = 115,                  /* NAMESYM  */
+  YYSYMBOL_VARSYM = 116,                   /* VARSYM  */
+  YYSYMBOL_BITSYM = 117,                   /* BITSYM  */
+  YYSYMBOL_SPECSYM = 118,                  /* SPECSYM  */
+  YYSYMBOL_VARLISTSYM = 119,               /* VARLISTSYM  */
+  YYSYMBOL_OPERANDSYM = 120,               /* OPERANDSYM  */
+  YYSYMBOL_STARTSYM = 121,                 /* STARTSYM  */
+  YYSYMBOL_ENDSYM = 122,                   /* ENDSYM  */
+  YYSYMBOL_MACROSYM = 123,                 /* MACROSYM  */
+  YYSYMBOL_LABELSYM = 124,                 /* LABELSYM  */
+  YYSYMBOL_SUBTABLESYM = 125,              /* SUBTABLESYM  */
+  YYSYMBOL_126_ = 126,                     /* '}'  */
+  YYSYMBOL_127_ = 127,                     /* '='  */
+  YYSYMBOL_128_ = 128,                     /* '('  */
+  YYSYMBOL_129_ = 129,                     /* ')'  */
+  YYSYMBOL_130_ = 130,                     /* ','  */
+  YYSYMBOL_131_ = 131,                     /* '['  */
+  YYSYMBOL_132_ = 132,                     /* ']'  */
+  YYSYMBOL_133_ = 133,                     /* '{'  */
+  YYSYMBOL_134_ = 134,                     /* ':'  */
+  YYSYMBOL_135_ = 135,                     /* ' '  */
+  YYSYMBOL_YYACCEPT = 136,                 /* $accept  */
+  YYSYMBOL_spec = 137,                     /* spec  */
+  YYSYMBOL_definition = 138,               /* definition  */
+  YYSYMBOL_constructorlike = 139,          /* constructorlike  */
+  YYSYMBOL_endiandef = 140,                /* endiandef  */
+  YYSYMBOL_aligndef = 141,                 /* aligndef  */
+  YYSYMBOL_tokendef = 142,                 /* tokendef  */
+  YYSYMBOL_tokenprop = 143,                /* tokenprop  */
+  YYSYMBOL_contextdef = 144,               /* contextdef  */
+  YYSYMBOL_contextprop = 145,              /* contextprop  */
+  YYSYMBOL_fielddef = 146,                 /* fielddef  */
+  YYSYMBOL_contextfielddef = 147,          /* contextfielddef  */
+  YYSYMBOL_spacedef = 148,                 /* spacedef  */
+  YYSYMBOL_spaceprop = 149,                /* spaceprop  */
+  YYSYMBOL_varnodedef = 150,               /* varnodedef  */
+  YYSYMBOL_bitrangedef = 151,              /* bitrangedef  */
+  YYSYMBOL_bitrangelist = 152,             /* bitrangelist  */
+  YYSYMBOL_bitrangesingle = 153,           /* bitrangesingle  */
+  YYSYMBOL_pcodeopdef = 154,               /* pcodeopdef  */
+  YYSYMBOL_valueattach = 155,              /* valueattach  */
+  YYSYMBOL_nameattach = 156,               /* nameattach  */
+  YYSYMBOL_varattach = 157,                /* varattach  */
+  YYSYMBOL_macrodef = 158,                 /* macrodef  */
+  YYSYMBOL_withblockstart = 159,           /* withblockstart  */
+  YYSYMBOL_withblockmid = 160,             /* withblockmid  */
+  YYSYMBOL_withblock = 161,                /* withblock  */
+  YYSYMBOL_id_or_nil = 162,                /* id_or_nil  */
+  YYSYMBOL_bitpat_or_nil = 163,            /* bitpat_or_nil  */
+  YYSYMBOL_macrostart = 164,               /* macrostart  */
+  YYSYMBOL_rtlbody = 165,                  /* rtlbody  */
+  YYSYMBOL_constructor = 166,              /* constructor  */
+  YYSYMBOL_constructprint = 167,           /* constructprint  */
+  YYSYMBOL_subtablestart = 168,            /* subtablestart  */
+  YYSYMBOL_pexpression = 169,              /* pexpression  */
+  YYSYMBOL_pequation = 170,                /* pequation  */
+  YYSYMBOL_elleq = 171,                    /* elleq  */
+  YYSYMBOL_ellrt = 172,                    /* ellrt  */
+  YYSYMBOL_atomic = 173,                   /* atomic  */
+  YYSYMBOL_constraint = 174,               /* constraint  */
+  YYSYMBOL_contextblock = 175,             /* contextblock  */
+  YYSYMBOL_contextlist = 176,              /* contextlist  */
+  YYSYMBOL_section_def = 177,              /* section_def  */
+  YYSYMBOL_rtlfirstsection = 178,          /* rtlfirstsection  */
+  YYSYMBOL_rtlcontinue = 179,              /* rtlcontinue  */
+  YYSYMBOL_rtl = 180,                      /* rtl  */
+  YYSYMBOL_rtlmid = 181,                   /* rtlmid  */
+  YYSYMBOL_statement = 182,                /* statement  */
+  YYSYMBOL_expr = 183,                     /* expr  */
+  YYSYMBOL_sizedstar = 184,                /* sizedstar  */
+  YYSYMBOL_jumpdest = 185,                 /* jumpdest  */
+  YYSYMBOL_varnode = 186,                  /* varnode  */
+  YYSYMBOL_integervarnode = 187,           /* integervarnode  */
+  YYSYMBOL_lhsvarnode = 188,               /* lhsvarnode  */
+  YYSYMBOL_label = 189,                    /* label  */
+  YYSYMBOL_exportvarnode = 190,            /* exportvarnode  */
+  YYSYMBOL_familysymbol = 191,             /* familysymbol  */
+  YYSYMBOL_specificsymbol = 192,           /* specificsymbol  */
+  YYSYMBOL_charstring = 193,               /* charstring  */
+  YYSYMBOL_intblist = 194,                 /* intblist  */
+  YYSYMBOL_intbpart = 195,                 /* intbpart  */
+  YYSYMBOL_stringlist = 196,               /* stringlist  */
+  YYSYMBOL_stringpart = 197,               /* stringpart  */
+  YYSYMBOL_anystringlist = 198,            /* anystringlist  */
+  YYSYMBOL_anystringpart = 199,            /* anystringpart  */
+  YYSYMBOL_valuelist = 200,                /* valuelist  */
+  YYSYMBOL_valuepart = 201,                /* valuepart  */
+  YYSYMBOL_varlist = 202,                  /* varlist  */
+  YYSYMBOL_varpart = 203,                  /* varpart  */
+  YYSYMBOL_paramlist = 204,                /* paramlist  */
+  YYSYMBOL_oplist = 205,                   /* oplist  */
+  YYSYMBOL_anysymbol = 206                 /* anysymbol  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  5
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   2529
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  136
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  71
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  335
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  705
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   367
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,   135,    43,     2,     2,     2,    38,    11,     2,
+     128,   129,    36,    32,   130,    33,     2,    37,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   134,     8,
+      17,   127,    18,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   131,     2,   132,     9,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   133,     6,   126,    44,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     7,    10,    12,    13,    14,    15,    16,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    34,    35,    39,    40,    41,    42,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   156,   156,   157,   158,   159,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   172,   173,   174,   175,
+     177,   178,   180,   182,   184,   185,   186,   188,   190,   191,
+     194,   195,   196,   197,   198,   200,   201,   202,   203,   204,
+     205,   207,   209,   210,   211,   212,   213,   214,   215,   217,
+     219,   221,   223,   224,   226,   229,   231,   233,   235,   237,
+     240,   242,   243,   244,   246,   248,   249,   250,   253,   254,
+     257,   259,   260,   261,   263,   264,   266,   267,   268,   269,
+     270,   271,   272,   273,   274,   276,   277,   278,   279,   281,
+     283,   286,   287,   288,   289,   290,   291,   292,   293,   294,
+     295,   296,   297,   298,   300,   301,   302,   303,   305,   306,
+     308,   309,   311,   312,   314,   315,   316,   317,   318,   319,
+     320,   323,   324,   325,   326,   328,   329,   331,   332,   333,
+     334,   335,   336,   338,   339,   341,   343,   344,   346,   347,
+     348,   349,   350,   352,   353,   354,   355,   357,   358,   359,
+     360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
+     380,   381,   383,   384,   385,   386,   387,   388,   389,   390,
+     391,   392,   393,   394,   395,   396,   397,   398,   399,   400,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     411,   412,   413,   414,   415,   416,   417,   418,   419,   420,
+     421,   422,   423,   424,   425,   426,   427,   428,   429,   430,
+     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   449,   450,   451,
+     452,   454,   455,   456,   457,   458,   459,   460,   461,   463,
+     464,   465,   466,   468,   469,   470,   471,   472,   474,   475,
+     476,   478,   479,   481,   482,   483,   484,   485,   486,   488,
+     489,   490,   491,   492,   494,   495,   496,   497,   498,   500,
+     501,   503,   504,   505,   507,   508,   509,   511,   512,   513,
+     516,   517,   519,   520,   521,   523,   525,   526,   527,   528,
+     530,   531,   532,   534,   535,   536,   537,   538,   540,   541,
+     543,   544,   546,   547,   550,   551,   552,   554,   555,   556,
+     558,   559,   560,   561,   562,   563,   564,   565,   566,   567,
+     568,   569,   570,   571,   572,   573
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "OP_BOOL_OR",
+  "OP_BOOL_AND", "OP_BOOL_XOR", "'|'", "OP_OR", "';'", "'^'", "OP_XOR",
+  "'&'", "OP_AND", "OP_EQUAL", "OP_NOTEQUAL", "OP_FEQUAL", "OP_FNOTEQUAL",
+  "'<'", "'>'", "OP_GREATEQUAL", "OP_LESSEQUAL", "OP_SLESS",
+  "OP_SGREATEQUAL", "OP_SLESSEQUAL", "OP_SGREAT", "OP_FLESS", "OP_FGREAT",
+  "OP_FLESSEQUAL", "OP_FGREATEQUAL", "OP_LEFT", "OP_RIGHT", "OP_SRIGHT",
+  "'+'", "'-'", "OP_FADD", "OP_FSUB", "'*'", "'/'", "'%'", "OP_SDIV",
+  "OP_SREM", "OP_FMULT", "OP_FDIV", "'!'", "'~'", "OP_ZEXT", "OP_CARRY",
+  "OP_BORROW", "OP_SEXT", "OP_SCARRY", "OP_SBORROW", "OP_NAN", "OP_ABS",
+  "OP_SQRT", "OP_CEIL", "OP_FLOOR", "OP_ROUND", "OP_INT2FLOAT",
+  "OP_FLOAT2FLOAT", "OP_TRUNC", "OP_CPOOLREF", "OP_NEW", "BADINTEGER",
+  "GOTO_KEY", "CALL_KEY", "RETURN_KEY", "IF_KEY", "DEFINE_KEY",
+  "ATTACH_KEY", "MACRO_KEY", "SPACE_KEY", "TYPE_KEY", "RAM_KEY",
+  "DEFAULT_KEY", "REGISTER_KEY", "ENDIAN_KEY", "WITH_KEY", "ALIGN_KEY",
+  "OP_UNIMPL", "TOKEN_KEY", "SIGNED_KEY", "NOFLOW_KEY", "HEX_KEY",
+  "DEC_KEY", "BIG_KEY", "LITTLE_KEY", "SIZE_KEY", "WORDSIZE_KEY",
+  "OFFSET_KEY", "NAMES_KEY", "VALUES_KEY", "VARIABLES_KEY", "PCODEOP_KEY",
+  "IS_KEY", "LOCAL_KEY", "DELAYSLOT_KEY", "CROSSBUILD_KEY", "EXPORT_KEY",
+  "BUILD_KEY", "CONTEXT_KEY", "ELLIPSIS_KEY", "GLOBALSET_KEY",
+  "BITRANGE_KEY", "CHAR", "INTEGER", "INTB", "STRING", "SYMBOLSTRING",
+  "SPACESYM", "SECTIONSYM", "TOKENSYM", "USEROPSYM", "VALUESYM",
+  "VALUEMAPSYM", "CONTEXTSYM", "NAMESYM", "VARSYM", "BITSYM", "SPECSYM",
+  "VARLISTSYM", "OPERANDSYM", "STARTSYM", "ENDSYM", "MACROSYM", "LABELSYM",
+  "SUBTABLESYM", "'}'", "'='", "'('", "')'", "','", "'['", "']'", "'{'",
+  "':'", "' '", "$accept", "spec", "definition", "constructorlike",
+  "endiandef", "aligndef", "tokendef", "tokenprop", "contextdef",
+  "contextprop", "fielddef", "contextfielddef", "spacedef", "spaceprop",
+  "varnodedef", "bitrangedef", "bitrangelist", "bitrangesingle",
+  "pcodeopdef", "valueattach", "nameattach", "varattach", "macrodef",
+  "withblockstart", "withblockmid", "withblock", "id_or_nil",
+  "bitpat_or_nil", "macrostart", "rtlbody", "constructor",
+  "constructprint", "subtablestart", "pexpression", "pequation", "elleq",
+  "ellrt", "atomic", "constraint", "contextblock", "contextlist",
+  "section_def", "rtlfirstsection", "rtlcontinue", "rtl", "rtlmid",
+  "statement", "expr", "sizedstar", "jumpdest", "varnode",
+  "integervarnode", "lhsvarnode", "label", "exportvarnode", "familysymbol",
+  "specificsymbol", "charstring", "intblist", "intbpart", "stringlist",
+  "stringpart", "anystringlist", "anystringpart", "valuelist", "valuepart",
+  "varlist", "varpart", "paramlist", "oplist", "anysymbol", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-313)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-268)
+
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     -18,     1,    10,  -313,   -27,  -313,     4,   331,   369,    26,
+     -75,   -13,    57,  -313,  -313,  -313,  -313,  -313,   396,  -313,
+     426,  -313,    24,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,    22,  -313,     5,  -313,    30,    65,   142,  -313,  -313,
+    2357,    33,  2375,   -66,   160,    43,   193,   -50,   -50,   -50,
+     157,  -313,  -313,   156,  -313,  -313,  -313,   172,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,   288,   182,  -313,   195,   312,   205,
+    -313,   207,  -313,   247,   249,   392,  -313,  -313,  -313,  -313,
+    -313,   198,  -313,  -313,  -313,  -313,   217,  -313,   198,  -313,
+    -313,  -313,   217,   397,   401,  -313,  -313,   274,   283,  -313,
+    -313,   309,   417,  -313,   328,    25,  -313,   346,  -313,  -313,
+      67,   305,   -19,   -43,   360,   198,   348,  -313,  -313,  -313,
+     350,   352,  -313,  -313,  -313,  -313,   357,   135,   383,   391,
+     372,  1619,  1675,  -313,  -313,  -313,  -313,  -313,  -313,   376,
+    -313,   198,    14,  -313,  -313,   425,  -313,    -1,  -313,    14,
+    -313,  -313,   519,   427,  -313,  2253,  -313,   428,  -313,  -313,
+     -35,  -313,  -313,    63,  2393,   542,   448,  -313,    60,   545,
+    -313,     2,   546,  -313,   185,   424,   443,   452,   461,   462,
+     464,  -313,  -313,  -313,  -313,  -313,    72,   -65,   -63,  -313,
+    1390,  1395,    28,  1487,   408,   442,   263,   361,   485,   472,
+     138,   480,  -313,   483,  -313,  -313,  -313,  -313,   517,   -79,
+    -313,  1487,   -15,  -313,    77,  -313,   146,  -313,  1519,   190,
+     198,   198,   198,  -313,   -72,  -313,  1519,  1519,  1519,  1519,
+    1519,  1519,   -72,  -313,   521,  -313,  -313,  -313,   515,  -313,
+     562,  -313,  -313,  -313,  -313,  -313,  2278,  -313,  -313,  -313,
+     581,  -313,  -313,   -12,  -313,  -313,  -313,   -78,  -313,  -313,
+     580,   555,   595,   596,   631,   632,  -313,  -313,   624,  -313,
+    -313,   752,   754,   699,   706,  -313,   681,  -313,  -313,  -313,
+    -313,  1487,   839,  -313,  1487,   842,  -313,  1487,  1487,  1487,
+    1487,  1487,   724,   759,   764,   795,   803,   805,   843,   845,
+     883,   885,   916,   924,   926,   964,   966,  1004,  1006,  -313,
+    1487,  1742,  1487,  -313,    71,    -5,   761,   824,   838,   162,
+     874,  1041,  -313,   306,  1081,  -313,  1121,  1061,  1487,  1066,
+    1487,  1487,  1487,  1445,  1069,  1071,  1487,  1106,  1519,  1519,
+    -313,  1519,  1657,  -313,  -313,  -313,   159,  1202,  -313,   -48,
+    -313,  -313,  -313,  1657,  1657,  1657,  1657,  1657,  1657,  -313,
+    -313,  1111,  1123,  -313,  -313,  -313,  -313,  1149,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  1151,  1182,  1187,  1190,
+     263,  -313,  -313,  1164,  -313,  1223,   324,  -313,   558,  -313,
+     598,  -313,  -313,  -313,  -313,  1487,  1487,  1487,  1487,  1487,
+    1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,
+    1487,  1487,   800,  1487,  1487,  1487,  1487,  1487,  1487,  1487,
+    1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,
+    1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,
+    1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,  1487,   269,
+    -313,    13,  1230,  1232,  -313,  1487,  1267,  -313,  1245,   215,
+    1272,  -313,  1311,  1409,  -313,  1447,  -313,  -313,  -313,  -313,
+    1793,  1361,  2113,   257,  1833,   334,  1487,  1360,  1363,  1873,
+    1362,  -313,  -313,   370,  1519,  1519,  1519,  1519,  1519,  1519,
+    1519,  1519,  1519,  1367,  -313,  1370,  1373,  -313,  -313,  -313,
+     -25,  1379,  1387,  -313,  1384,  1385,  1389,  1396,  -313,  1393,
+    1392,  1511,  1520,  1521,   840,   678,   880,   718,   760,   921,
+     961,  1001,  1042,  1082,  1122,  1163,  1203,  1243,   339,   638,
+     393,  -313,  2152,  2189,  2189,  2223,  2255,  2316,  2394,  2394,
+    2394,  2394,  2420,  2420,  2420,  2420,  2420,  2420,  2420,  2420,
+    2420,  2420,  2420,  2420,  2272,  2272,  2272,  1466,  1466,  1466,
+    1466,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  1542,  1422,
+    1423,  -313,  1913,    -3,  1546,  1549,  1551,   263,  -313,  -313,
+    -313,  1487,  1553,  1487,  -313,  1556,  1953,  -313,  -313,  -313,
+    1458,  -313,   460,  1666,   384,   256,   256,    78,    78,  -313,
+    -313,  2407,  1519,  1519,  1554,   323,  -313,  -313,  1462,   -66,
+    -313,  -313,  -313,  -313,  1463,  -313,  -313,  -313,  -313,  -313,
+    1487,  -313,  1487,  1487,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  1487,  -313,  -313,  -313,  1464,
+    -313,  -313,  1487,  -313,  -313,  -313,  -313,  1993,  -313,  2113,
+    -313,  -313,  1437,  1440,  1443,  1548,  2291,  -313,  -313,  1544,
+    1545,  1444,  1571,  -313,  1284,  1324,  1364,  1405,  1450,  2033,
+    -313,  1459,  1473,  1474,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  1487,  1460,  1465,  2073,
+    1584,  1587,  -313,  -313,  -313
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     0,     0,     2,     0,     1,     0,     0,     0,     0,
+      65,     0,     0,    87,     4,     5,     3,     6,     0,     7,
+       0,     8,     0,     9,    10,    11,    12,    13,    14,    17,
+      61,     0,    18,     0,    16,     0,     0,     0,    15,    19,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    67,    66,     0,    86,    85,    23,     0,   320,   321,
+     322,   323,   326,   327,   328,   329,   330,   335,   331,   332,
+     333,   334,   324,   325,    25,     0,    27,     0,    29,     0,
+      41,     0,    48,     0,     0,     0,    64,    62,    63,   143,
+      80,     0,   279,    81,    84,    83,    82,    79,     0,    76,
+      78,    88,    77,     0,     0,    42,    43,     0,     0,    26,
+     291,     0,     0,    28,     0,     0,    52,     0,   301,   302,
+       0,     0,     0,     0,   317,    68,     0,    32,    33,    34,
+       0,     0,    37,    38,    39,    40,     0,     0,     0,     0,
+       0,   138,     0,   269,   270,   271,   272,   122,   273,   121,
+     124,     0,   125,   104,   109,   111,   112,   123,   280,   125,
+      20,    21,     0,     0,   292,     0,    55,     0,    51,    53,
+       0,   303,   304,     0,     0,     0,     0,   282,     0,     0,
+     309,     0,     0,   318,     0,   125,    69,     0,     0,     0,
+       0,    44,    45,    46,    47,    59,     0,     0,   240,   254,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   253,
+     251,     0,   274,     0,   275,   276,   277,   278,     0,   252,
+     144,     0,     0,   250,     0,   171,   249,   108,     0,     0,
+       0,     0,     0,   127,     0,   110,     0,     0,     0,     0,
+       0,     0,     0,    22,     0,   293,   290,   294,     0,    50,
+       0,   307,   305,   306,   300,   296,     0,   297,    57,   283,
+       0,   284,   286,     0,    56,   311,   310,     0,    58,    70,
+       0,     0,     0,     0,     0,     0,   251,   252,     0,   256,
+     249,     0,     0,     0,     0,   244,   243,   248,   245,   241,
+     242,     0,     0,   247,     0,     0,   168,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   234,
+       0,     0,     0,   172,   249,     0,     0,     0,     0,     0,
+       0,   141,   268,     0,     0,   263,     0,     0,     0,     0,
+     314,     0,   314,     0,     0,     0,     0,     0,     0,     0,
+      89,     0,   120,    90,    91,   113,   106,   107,   105,     0,
+      73,   143,    74,   115,   116,   118,   119,   117,   114,    75,
+      24,     0,     0,   298,   295,   299,   285,     0,   287,   289,
+     281,   313,   312,   308,   319,    60,     0,     0,     0,     0,
+       0,   262,   261,     0,   239,     0,     0,   163,     0,   166,
+       0,   187,   214,   200,   188,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   314,
+       0,   314,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     173,     0,     0,     0,   145,     0,     0,   152,     0,     0,
+       0,   264,     0,   142,   260,     0,   258,   139,   159,   255,
+       0,     0,   315,     0,     0,     0,     0,     0,     0,     0,
+       0,   102,   103,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   132,     0,     0,   126,   136,   143,
+       0,     0,     0,   288,     0,     0,     0,     0,   257,   238,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   174,   203,   202,   201,   191,   189,   190,   177,   178,
+     204,   205,   179,   182,   180,   181,   183,   184,   185,   186,
+     206,   207,   208,   209,   192,   193,   194,   175,   176,   210,
+     211,   195,   196,   198,   197,   199,   212,   213,     0,     0,
+       0,   232,     0,     0,     0,     0,     0,     0,   266,   140,
+     149,     0,     0,     0,   156,     0,     0,   158,   157,   147,
+       0,    92,    99,   100,    98,    96,    97,    93,    94,    95,
+     101,     0,     0,     0,     0,     0,    71,   135,     0,     0,
+      30,    31,    35,    36,     0,   246,   165,   167,   169,   218,
+       0,   217,     0,     0,   224,   215,   216,   226,   227,   228,
+     223,   222,   225,   236,   229,     0,   235,   164,   231,     0,
+     148,   146,     0,   162,   161,   160,   265,     0,   154,   316,
+     170,   153,     0,     0,     0,     0,     0,    72,   137,     0,
+       0,     0,     0,   237,     0,     0,     0,     0,     0,     0,
+     151,     0,     0,     0,   128,   131,   133,   134,    54,    49,
+     219,   220,   221,   230,   233,   150,     0,     0,     0,     0,
+       0,     0,   155,   129,   130
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -313,  -313,  1565,  1566,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  1484,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  1358,
+    -313,  -313,  -313,  -194,   -69,  -313,  1468,  -313,  -313,  -122,
+    -313,   987,  -313,  -313,  1241,  1097,  -313,  -195,  -140,  -192,
+    -126,  1150,  1280,  -139,  -313,   -91,   -54,  1578,  -313,  -313,
+    1002,  -313,  -313,  -313,   404,  -313,  -313,  -313,  -312,  -313,
+      15
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     2,    14,    15,     3,    16,    17,    18,    19,    20,
+      74,    78,    21,    22,    23,    24,   115,   116,    25,    26,
+      27,    28,    29,    30,    31,    32,    53,   185,    33,   362,
+      34,    35,    36,   352,   152,   153,   154,   155,   156,   234,
+     359,   617,   508,   509,   140,   141,   220,   482,   322,   292,
+     323,   223,   224,   293,   334,   353,   324,    96,   179,   263,
+     112,   165,   175,   256,   121,   173,   182,   267,   483,   184,
+      75
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     157,   221,   225,   464,   615,   651,   360,   157,   321,   295,
+       5,     6,    38,   236,   176,   222,   237,   238,   239,   240,
+     230,   377,   231,     6,   196,   232,   343,   249,   381,   159,
+     485,    51,    80,   168,   157,    79,   296,   242,   382,    90,
+     110,   281,   363,   364,   365,   366,   367,   368,  -260,     1,
+      52,   157,  -260,   503,   383,   106,   186,   109,   504,   282,
+     157,   361,   118,   271,   119,   111,   505,   333,   283,   250,
+     279,   284,   506,   180,    97,   199,     4,     7,     8,     9,
+     328,   120,   229,   196,   507,   177,    10,   226,   181,    85,
+       8,     9,   378,   260,   379,    81,   396,    82,    10,   398,
+      37,   616,   400,   401,   402,   403,   404,   538,   265,   540,
+      83,    84,   178,   344,   501,   502,    11,   209,   266,   345,
+     380,    54,   465,    91,   652,   422,   241,   460,    11,   466,
+      39,   114,    50,    92,   199,    12,    93,    94,    89,   157,
+     157,   157,   280,   480,    13,   233,   484,    12,    86,   114,
+     326,   489,   280,   335,   491,   492,    13,   493,    98,   297,
+     107,   356,   357,   358,   261,    95,   262,   231,    92,   251,
+     232,    99,   100,   196,   354,   252,   209,   253,   276,   171,
+     247,   172,   354,   354,   354,   354,   354,   354,   212,   257,
+     214,    55,   215,   216,   217,   254,   230,   277,   231,   461,
+     101,   232,   462,   471,   346,   463,   278,   191,   347,   192,
+     524,   525,   526,   527,   528,   529,   530,   531,   532,   533,
+     534,   535,   536,   537,   199,   539,   103,   104,   542,   543,
+     544,   545,   546,   547,   548,   549,   550,   551,   552,   553,
+     554,   555,   556,   557,   558,   559,   560,   561,   562,   563,
+     564,   565,   566,   567,   568,   569,   570,   571,   572,   573,
+     574,   575,   576,   577,   518,   338,   209,   578,   276,  -259,
+     582,   375,   339,  -258,   196,   280,   113,  -258,   212,   476,
+     214,   117,   215,   216,   217,   124,   197,   277,   499,   500,
+     125,   596,   501,   502,   354,   354,   470,   354,   142,   126,
+     602,   603,   604,   605,   606,   607,   608,   609,   610,   130,
+     143,   144,   145,   146,   269,   270,   147,   148,   149,   355,
+     158,   585,   131,   150,   586,   199,   151,   423,   424,   425,
+     426,   285,   136,   427,   137,   428,   280,   429,   430,   431,
+     432,   433,   434,   435,   436,   437,   438,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,   458,   209,   127,   276,
+     128,   129,   329,   286,   138,   287,   139,   494,   162,   212,
+     495,   214,   496,   215,   216,   217,   592,   593,   277,   288,
+     289,   290,   132,   133,   134,   135,   657,   198,   659,   497,
+     498,    40,   499,   500,    56,   160,   501,   502,    41,   161,
+      42,   163,   473,   497,   498,   164,   499,   500,   665,   666,
+     501,   502,   212,    43,   214,   166,   215,   216,   217,   669,
+      44,   474,   670,    45,    76,   674,   174,   675,   676,    46,
+     354,   354,   354,   354,   354,   354,   354,   354,   354,   230,
+     677,   231,   122,   123,   232,   167,   521,   679,    47,    48,
+      49,   656,    40,   595,   593,   330,   183,   331,   643,   593,
+     495,    42,   496,   170,   221,   225,   187,   212,   188,   214,
+     189,   215,   216,   217,    43,   190,   332,   193,   222,   497,
+     498,    44,   499,   500,    45,   194,   501,   502,   195,   601,
+      46,   699,    57,   228,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,   325,    68,    69,    70,    71,    72,
+     663,    73,   646,   593,   212,   235,   214,   243,   215,   216,
+     217,   244,    77,   280,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,   248,    68,    69,    70,    71,    72,
+     258,    73,   259,   264,   268,   233,   272,   664,   354,   354,
+     226,   423,   424,   425,   426,   273,   274,   427,   275,   428,
+     327,   429,   430,   431,   432,   433,   434,   435,   436,   437,
+     438,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     458,   423,   424,   425,   426,   336,   337,   427,   340,   428,
+     341,   429,   430,   431,   432,   433,   434,   435,   436,   437,
+     438,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     458,   423,   424,   425,   426,   342,   371,   427,   372,   428,
+     370,   429,   430,   431,   432,   433,   434,   435,   436,   437,
+     438,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     458,   423,   424,   425,   426,   376,   384,   427,   385,   428,
+     522,   429,   430,   431,   432,   433,   434,   435,   436,   437,
+     438,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     458,   423,   424,   425,   426,   386,   387,   427,   390,   428,
+     523,   429,   430,   431,   432,   433,   434,   435,   436,   437,
+     438,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     458,   388,   389,   423,   424,   425,   426,   644,   645,   427,
+     391,   428,   392,   429,   430,   431,   432,   433,   434,   435,
+     436,   437,   438,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   423,   424,   425,   426,   393,   630,   427,
+     394,   428,   395,   429,   430,   431,   432,   433,   434,   435,
+     436,   437,   438,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   423,   424,   425,   426,   397,   632,   427,
+     399,   428,   405,   429,   430,   431,   432,   433,   434,   435,
+     436,   437,   438,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   423,   424,   425,   426,   406,   467,   427,
+     633,   428,   407,   429,   430,   431,   432,   433,   434,   435,
+     436,   437,   438,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   408,   423,   424,   425,   426,   468,   541,
+     427,   409,   428,   410,   429,   430,   431,   432,   433,   434,
+     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   458,   423,   424,   425,   426,   469,   629,
+     427,   411,   428,   412,   429,   430,   431,   432,   433,   434,
+     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   458,   423,   424,   425,   426,   472,   631,
+     427,   413,   428,   414,   429,   430,   431,   432,   433,   434,
+     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   458,   415,   423,   424,   425,   426,  -267,
+     634,   427,   416,   428,   417,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,   423,   424,   425,   426,   477,
+     635,   427,   418,   428,   419,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,   423,   424,   425,   426,   478,
+     636,   427,   420,   428,   421,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,   479,   423,   424,   425,   426,
+     481,   637,   427,   487,   428,   488,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+     490,   638,   427,   232,   428,   511,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+     512,   639,   427,   513,   428,   514,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   515,   423,   424,   425,
+     426,   516,   640,   427,   517,   428,   519,   429,   430,   431,
+     432,   433,   434,   435,   436,   437,   438,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,   458,   423,   424,   425,
+     426,   520,   641,   427,   580,   428,   581,   429,   430,   431,
+     432,   433,   434,   435,   436,   437,   438,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,   458,   423,   424,   425,
+     426,   583,   642,   427,   584,   428,   587,   429,   430,   431,
+     432,   433,   434,   435,   436,   437,   438,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,   458,   197,   423,   424,
+     425,   426,   197,   690,   427,   588,   428,  -259,   429,   430,
+     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,   458,   423,   424,
+     425,   426,   285,   691,   427,   589,   428,   285,   429,   430,
+     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,   458,   591,   597,
+     598,   619,   600,   692,   286,   611,   287,   612,   196,   286,
+     613,   287,   452,   453,   454,   455,   456,   457,   458,   618,
+     288,   289,   290,   620,   621,   288,   289,   290,   622,   626,
+     298,   291,   299,   198,   625,   623,   294,   624,   627,   628,
+     300,   301,   302,   303,   693,   304,   305,   306,   307,   308,
+     309,   310,   311,   312,   313,   314,   315,   316,   317,   199,
+     647,   648,   348,   649,   653,   494,   684,   654,   495,   655,
+     496,   658,   662,   349,   660,   196,   671,   673,   678,   681,
+     682,   197,   486,   683,   686,   687,   688,   497,   498,   689,
+     499,   500,   694,   615,   501,   502,   696,   697,   698,   700,
+     198,   209,   703,   276,   701,   704,    87,    88,   318,   169,
+     369,   668,   510,   212,   319,   214,   614,   215,   216,   217,
+     227,   579,   277,   475,   102,   320,   199,   200,   201,   202,
+     203,   672,     0,     0,   350,     0,     0,     0,     0,     0,
+     196,   143,   144,   145,   146,   212,   197,   214,   148,   215,
+     216,   217,     0,     0,     0,     0,     0,   351,   204,   205,
+     206,     0,   208,     0,     0,   198,     0,     0,   209,     0,
+     210,     0,     0,     0,   494,   211,     0,   495,     0,   496,
+     212,   213,   214,     0,   215,   216,   217,   218,   496,   219,
+     667,   199,   200,   201,   202,   203,   497,   498,     0,   499,
+     500,     0,     0,   501,   502,   497,   498,     0,   499,   500,
+       0,     0,   501,   502,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   204,   205,   206,   207,   208,     0,     0,
+       0,     0,     0,   209,     0,   210,     0,     0,     0,     0,
+     211,     0,     0,     0,     0,   212,   213,   214,     0,   215,
+     216,   217,   218,     0,   219,   423,   424,   425,   426,     0,
+       0,   427,     0,   428,     0,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,     0,     0,   143,   144,   145,
+     146,     0,     0,   147,   148,   149,   423,   424,   425,   426,
+     150,   590,   427,   151,   428,   459,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+       0,   594,   427,     0,   428,     0,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+       0,   599,   427,     0,   428,     0,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+       0,   650,   427,     0,   428,     0,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+       0,   661,   427,     0,   428,     0,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+       0,   680,   427,     0,   428,     0,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+       0,   695,   427,     0,   428,     0,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+       0,   702,   427,     0,   428,     0,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   423,   424,   425,   426,
+       0,     0,   427,     0,   428,     0,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   424,   425,   426,     0,
+       0,   427,     0,   428,     0,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,   426,     0,     0,   427,     0,
+     428,     0,   429,   430,   431,   432,   433,   434,   435,   436,
+     437,   438,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,   458,   427,     0,   428,     0,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   428,     0,   429,   430,
+     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,   458,   494,   685,
+       0,   495,     0,   496,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,     0,     0,     0,     0,     0,
+     497,   498,     0,   499,   500,     0,     0,   501,   502,   429,
+     430,   431,   432,   433,   434,   435,   436,   437,   438,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,   458,   245,
+       0,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,     0,    68,    69,    70,    71,    72,     0,    73,     0,
+       0,     0,     0,     0,   373,   246,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,     0,    68,    69,    70,
+      71,    72,     0,    73,     0,     0,     0,     0,     0,     0,
+     374,   433,   434,   435,   436,   437,   438,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,   458,  -268,  -268,  -268,
+    -268,  -268,  -268,  -268,  -268,  -268,  -268,  -268,  -268,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   105,     0,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,     0,    68,    69,    70,    71,
+      72,   108,    73,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,     0,    68,    69,    70,    71,    72,   255,
+      73,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,     0,    68,    69,    70,    71,    72,     0,    73,   143,
+     144,   145,   146,   212,     0,   214,   148,   215,   216,   217
+};
+
+static const yytype_int16 yycheck[] =
+{
+      91,   141,   141,     8,    29,     8,    78,    98,   203,   201,
+       0,     1,     8,    14,    33,   141,    17,    18,    19,    20,
+       6,    33,     8,     1,    11,    11,   221,    62,   106,    98,
+     342,   106,     8,     8,   125,    20,     8,   159,   116,     9,
+     106,   106,   236,   237,   238,   239,   240,   241,   127,    67,
+     125,   142,   131,   101,   132,    40,   125,    42,   106,   124,
+     151,   133,   112,   185,   114,   131,   114,   207,   131,   104,
+     196,   134,   120,   116,     9,    62,    75,    67,    68,    69,
+     206,   131,   151,    11,   132,   104,    76,   141,   131,    67,
+      68,    69,   104,    33,   106,    71,   291,    73,    76,   294,
+     127,   126,   297,   298,   299,   300,   301,   419,   106,   421,
+      86,    87,   131,   128,    36,    37,   106,   104,   116,   134,
+     132,   134,   127,    93,   127,   320,   127,   322,   106,   134,
+     126,   106,   106,   103,    62,   125,   106,   107,   133,   230,
+     231,   232,   196,   338,   134,   131,   341,   125,   126,   106,
+     204,   346,   206,   207,   348,   349,   134,   351,    93,   131,
+     127,   230,   231,   232,   104,   135,   106,     8,   103,   106,
+      11,   106,   107,    11,   228,   112,   104,   114,   106,   112,
+     165,   114,   236,   237,   238,   239,   240,   241,   116,   174,
+     118,   134,   120,   121,   122,   132,     6,   125,     8,   128,
+     135,    11,   131,   329,   127,   134,   134,    72,   131,    74,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,    62,   420,    84,    85,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   458,   390,   127,   104,   459,   106,   131,
+     465,   256,   134,   127,    11,   329,   116,   131,   116,   333,
+     118,    88,   120,   121,   122,   128,    17,   125,    32,    33,
+     134,   486,    36,    37,   348,   349,   134,   351,   100,   127,
+     494,   495,   496,   497,   498,   499,   500,   501,   502,   127,
+     112,   113,   114,   115,   129,   130,   118,   119,   120,   129,
+     103,   106,   127,   125,   109,    62,   128,     3,     4,     5,
+       6,    62,   127,     9,   127,    11,   390,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,   104,    80,   106,
+      82,    83,    11,   104,   127,   106,   127,     7,   104,   116,
+      10,   118,    12,   120,   121,   122,   129,   130,   125,   120,
+     121,   122,    80,    81,    82,    83,   591,    36,   593,    29,
+      30,    70,    32,    33,     8,     8,    36,    37,    77,     8,
+      79,   128,   106,    29,    30,   106,    32,    33,   612,   613,
+      36,    37,   116,    92,   118,     8,   120,   121,   122,   106,
+      99,   125,   109,   102,     8,   630,   131,   632,   633,   108,
+     494,   495,   496,   497,   498,   499,   500,   501,   502,     6,
+     645,     8,    48,    49,    11,   127,   132,   652,    89,    90,
+      91,   587,    70,   129,   130,   104,   106,   106,   129,   130,
+      10,    79,    12,   127,   614,   614,   128,   116,   128,   118,
+     128,   120,   121,   122,    92,   128,   125,   104,   614,    29,
+      30,    99,    32,    33,   102,   104,    36,    37,   126,   129,
+     108,   696,   106,   127,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   106,   119,   120,   121,   122,   123,
+     611,   125,   129,   130,   116,   100,   118,     8,   120,   121,
+     122,   104,   106,   587,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   116,   119,   120,   121,   122,   123,
+       8,   125,   104,     8,     8,   131,   104,   611,   612,   613,
+     614,     3,     4,     5,     6,   104,   104,     9,   104,    11,
+     128,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,     3,     4,     5,     6,   120,   134,     9,   128,    11,
+     127,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,     3,     4,     5,     6,   128,   131,     9,    86,    11,
+     129,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,     3,     4,     5,     6,   104,   106,     9,   133,    11,
+     132,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,     3,     4,     5,     6,   130,   130,     9,   104,    11,
+     132,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,   130,   130,     3,     4,     5,     6,   129,   130,     9,
+      18,    11,    18,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,     3,     4,     5,     6,   108,   130,     9,
+     104,    11,   131,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,     3,     4,     5,     6,     8,   130,     9,
+       8,    11,   128,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,     3,     4,     5,     6,   128,   127,     9,
+     130,    11,   128,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,   128,     3,     4,     5,     6,   104,   129,
+       9,   128,    11,   128,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,     3,     4,     5,     6,   130,   129,
+       9,   128,    11,   128,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,     3,     4,     5,     6,   134,   129,
+       9,   128,    11,   128,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,   128,     3,     4,     5,     6,     8,
+     129,     9,   128,    11,   128,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,     3,     4,     5,     6,     8,
+     129,     9,   128,    11,   128,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,     3,     4,     5,     6,     8,
+     129,     9,   128,    11,   128,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,   104,     3,     4,     5,     6,
+     104,   129,     9,   104,    11,   104,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+     104,   129,     9,    11,    11,   104,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+     127,   129,     9,   104,    11,   104,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,   104,     3,     4,     5,
+       6,   104,   129,     9,   104,    11,   132,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,     3,     4,     5,
+       6,   108,   129,     9,   104,    11,   104,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,     3,     4,     5,
+       6,   104,   129,     9,   129,    11,   104,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    17,     3,     4,
+       5,     6,    17,   129,     9,   104,    11,     8,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,     3,     4,
+       5,     6,    62,   129,     9,     8,    11,    62,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,   127,   129,
+     127,   104,   130,   129,   104,   128,   106,   127,    11,   104,
+     127,   106,    36,    37,    38,    39,    40,    41,    42,   130,
+     120,   121,   122,   129,   129,   120,   121,   122,   129,     8,
+      33,   131,    35,    36,   132,   129,   131,   134,     8,     8,
+      43,    44,    45,    46,   129,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+       8,   129,    33,   130,     8,     7,     8,     8,    10,     8,
+      12,     8,   104,    44,     8,    11,   104,   104,   104,   132,
+     130,    17,   127,   130,    30,    30,   132,    29,    30,     8,
+      32,    33,   132,    29,    36,    37,   127,   114,   114,   129,
+      36,   104,     8,   106,   129,     8,    31,    31,   111,   115,
+     242,   614,   361,   116,   117,   118,   509,   120,   121,   122,
+     142,   461,   125,   333,    36,   128,    62,    63,    64,    65,
+      66,   619,    -1,    -1,   105,    -1,    -1,    -1,    -1,    -1,
+      11,   112,   113,   114,   115,   116,    17,   118,   119,   120,
+     121,   122,    -1,    -1,    -1,    -1,    -1,   128,    94,    95,
+      96,    -1,    98,    -1,    -1,    36,    -1,    -1,   104,    -1,
+     106,    -1,    -1,    -1,     7,   111,    -1,    10,    -1,    12,
+     116,   117,   118,    -1,   120,   121,   122,   123,    12,   125,
+     126,    62,    63,    64,    65,    66,    29,    30,    -1,    32,
+      33,    -1,    -1,    36,    37,    29,    30,    -1,    32,    33,
+      -1,    -1,    36,    37,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    94,    95,    96,    97,    98,    -1,    -1,
+      -1,    -1,    -1,   104,    -1,   106,    -1,    -1,    -1,    -1,
+     111,    -1,    -1,    -1,    -1,   116,   117,   118,    -1,   120,
+     121,   122,   123,    -1,   125,     3,     4,     5,     6,    -1,
+      -1,     9,    -1,    11,    -1,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    -1,    -1,   112,   113,   114,
+     115,    -1,    -1,   118,   119,   120,     3,     4,     5,     6,
+     125,     8,     9,   128,    11,    63,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+      -1,     8,     9,    -1,    11,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+      -1,     8,     9,    -1,    11,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+      -1,     8,     9,    -1,    11,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+      -1,     8,     9,    -1,    11,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+      -1,     8,     9,    -1,    11,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+      -1,     8,     9,    -1,    11,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+      -1,     8,     9,    -1,    11,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     3,     4,     5,     6,
+      -1,    -1,     9,    -1,    11,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,     4,     5,     6,    -1,
+      -1,     9,    -1,    11,    -1,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,     6,    -1,    -1,     9,    -1,
+      11,    -1,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,     9,    -1,    11,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    11,    -1,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,     7,     8,
+      -1,    10,    -1,    12,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    -1,    -1,    -1,    -1,    -1,
+      29,    30,    -1,    32,    33,    -1,    -1,    36,    37,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,   106,
+      -1,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,    -1,   119,   120,   121,   122,   123,    -1,   125,    -1,
+      -1,    -1,    -1,    -1,   106,   132,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,    -1,   119,   120,   121,
+     122,   123,    -1,   125,    -1,    -1,    -1,    -1,    -1,    -1,
+     132,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,   106,    -1,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,    -1,   119,   120,   121,   122,
+     123,   106,   125,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,    -1,   119,   120,   121,   122,   123,   106,
+     125,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,    -1,   119,   120,   121,   122,   123,    -1,   125,   112,
+     113,   114,   115,   116,    -1,   118,   119,   120,   121,   122
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,    67,   137,   140,    75,     0,     1,    67,    68,    69,
+      76,   106,   125,   134,   138,   139,   141,   142,   143,   144,
+     145,   148,   149,   150,   151,   154,   155,   156,   157,   158,
+     159,   160,   161,   164,   166,   167,   168,   127,     8,   126,
+      70,    77,    79,    92,    99,   102,   108,    89,    90,    91,
+     106,   106,   125,   162,   134,   134,     8,   106,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   119,   120,
+     121,   122,   123,   125,   146,   206,     8,   106,   147,   206,
+       8,    71,    73,    86,    87,    67,   126,   138,   139,   133,
+       9,    93,   103,   106,   107,   135,   193,     9,    93,   106,
+     107,   135,   193,    84,    85,   106,   206,   127,   106,   206,
+     106,   131,   196,   116,   106,   152,   153,    88,   112,   114,
+     131,   200,   200,   200,   128,   134,   127,    80,    82,    83,
+     127,   127,    80,    81,    82,    83,   127,   127,   127,   127,
+     180,   181,   100,   112,   113,   114,   115,   118,   119,   120,
+     125,   128,   170,   171,   172,   173,   174,   191,   103,   170,
+       8,     8,   104,   128,   106,   197,     8,   127,     8,   153,
+     127,   112,   114,   201,   131,   198,    33,   104,   131,   194,
+     116,   131,   202,   106,   205,   163,   170,   128,   128,   128,
+     128,    72,    74,   104,   104,   126,    11,    17,    36,    62,
+      63,    64,    65,    66,    94,    95,    96,    97,    98,   104,
+     106,   111,   116,   117,   118,   120,   121,   122,   123,   125,
+     182,   184,   186,   187,   188,   189,   192,   172,   127,   170,
+       6,     8,    11,   131,   175,   100,    14,    17,    18,    19,
+      20,   127,   175,     8,   104,   106,   132,   206,   116,    62,
+     104,   106,   112,   114,   132,   106,   199,   206,     8,   104,
+      33,   104,   106,   195,     8,   106,   116,   203,     8,   129,
+     130,   175,   104,   104,   104,   104,   106,   125,   134,   186,
+     192,   106,   124,   131,   134,    62,   104,   106,   120,   121,
+     122,   131,   185,   189,   131,   185,     8,   131,    33,    35,
+      43,    44,    45,    46,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,   111,   117,
+     128,   183,   184,   186,   192,   106,   192,   128,   186,    11,
+     104,   106,   125,   184,   190,   192,   120,   134,   127,   134,
+     128,   127,   128,   183,   128,   134,   127,   131,    33,    44,
+     105,   128,   169,   191,   192,   129,   170,   170,   170,   176,
+      78,   133,   165,   169,   169,   169,   169,   169,   169,   165,
+     129,   131,    86,   106,   132,   206,   104,    33,   104,   106,
+     132,   106,   116,   132,   106,   133,   130,   130,   130,   130,
+     104,    18,    18,   108,   104,   131,   183,     8,   183,     8,
+     183,   183,   183,   183,   183,   128,   128,   128,   128,   128,
+     128,   128,   128,   128,   128,   128,   128,   128,   128,   128,
+     128,   128,   183,     3,     4,     5,     6,     9,    11,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    63,
+     183,   128,   131,   134,     8,   127,   134,   127,   104,   130,
+     134,   186,   134,   106,   125,   188,   192,     8,     8,   104,
+     183,   104,   183,   204,   183,   204,   127,   104,   104,   183,
+     104,   169,   169,   169,     7,    10,    12,    29,    30,    32,
+      33,    36,    37,   101,   106,   114,   120,   132,   178,   179,
+     180,   104,   127,   104,   104,   104,   104,   104,   186,   132,
+     108,   132,   132,   132,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   204,   183,
+     204,   129,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   185,   187,
+     104,   104,   183,   104,   129,   106,   109,   104,   104,     8,
+       8,   127,   129,   130,     8,   129,   183,   129,   127,     8,
+     130,   129,   169,   169,   169,   169,   169,   169,   169,   169,
+     169,   128,   127,   127,   181,    29,   126,   177,   130,   104,
+     129,   129,   129,   129,   134,   132,     8,     8,     8,   129,
+     130,   129,   130,   130,   129,   129,   129,   129,   129,   129,
+     129,   129,   129,   129,   129,   130,   129,     8,   129,   130,
+       8,     8,   127,     8,     8,     8,   186,   183,     8,   183,
+       8,     8,   104,   191,   192,   169,   169,   126,   177,   106,
+     109,   104,   196,   104,   183,   183,   183,   183,   104,   183,
+       8,   132,   130,   130,     8,     8,    30,    30,   132,     8,
+     129,   129,   129,   129,   132,     8,   127,   114,   114,   183,
+     129,   129,     8,     8,     8
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   136,   137,   137,   137,   137,   138,   138,   138,   138,
+     138,   138,   138,   138,   138,   138,   139,   139,   139,   139,
+     140,   140,   141,   142,   143,   143,   143,   144,   145,   145,
+     146,   146,   146,   146,   146,   147,   147,   147,   147,   147,
+     147,   148,   149,   149,   149,   149,   149,   149,   149,   150,
+     150,   151,   152,   152,   153,   154,   155,   156,   157,   158,
+     159,   160,   160,   160,   161,   162,   162,   162,   163,   163,
+     164,   165,   165,   165,   166,   166,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   168,   168,   168,   168,   169,
+     169,   169,   169,   169,   169,   169,   169,   169,   169,   169,
+     169,   169,   169,   169,   170,   170,   170,   170,   171,   171,
+     172,   172,   173,   173,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   175,   175,   176,   176,   176,
+     176,   176,   176,   177,   177,   178,   179,   179,   180,   180,
+     180,   180,   180,   181,   181,   181,   181,   182,   182,   182,
+     182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
+     182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
+     182,   182,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   184,   184,   184,
+     184,   185,   185,   185,   185,   185,   185,   185,   185,   186,
+     186,   186,   186,   187,   187,   187,   187,   187,   188,   188,
+     188,   189,   189,   190,   190,   190,   190,   190,   190,   191,
+     191,   191,   191,   191,   192,   192,   192,   192,   192,   193,
+     193,   194,   194,   194,   195,   195,   195,   195,   195,   195,
+     196,   196,   197,   197,   197,   198,   199,   199,   199,   199,
+     200,   200,   200,   201,   201,   201,   201,   201,   202,   202,
+     203,   203,   203,   203,   204,   204,   204,   205,   205,   205,
+     206,   206,   206,   206,   206,   206,   206,   206,   206,   206,
+     206,   206,   206,   206,   206,   206
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     2,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     1,     1,     1,     2,
+       5,     5,     5,     2,     6,     2,     3,     2,     3,     2,
+       7,     7,     2,     2,     2,     7,     7,     2,     2,     2,
+       2,     2,     3,     3,     4,     4,     4,     4,     2,    10,
+       5,     4,     1,     2,     8,     4,     5,     5,     5,     4,
+       6,     1,     2,     2,     2,     0,     1,     1,     0,     1,
+       5,     3,     4,     1,     5,     5,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     1,     2,     1,
+       1,     1,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     2,     2,     1,     3,     3,     3,     2,     1,
+       2,     1,     1,     3,     3,     3,     3,     3,     3,     3,
+       3,     1,     1,     1,     1,     0,     3,     0,     5,     8,
+       8,     5,     2,     3,     3,     2,     1,     3,     1,     4,
+       5,     3,     4,     0,     2,     4,     6,     4,     5,     4,
+       7,     6,     3,     5,     5,     9,     4,     4,     4,     3,
+       5,     5,     5,     3,     5,     5,     3,     5,     2,     5,
+       5,     1,     1,     2,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     2,     2,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       2,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     2,     4,     4,     4,     4,     6,
+       6,     6,     4,     4,     4,     4,     4,     4,     4,     4,
+       6,     4,     3,     6,     1,     4,     4,     6,     4,     3,
+       1,     1,     1,     1,     1,     1,     4,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     2,     4,     1,     1,
+       1,     3,     3,     1,     2,     4,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     3,     1,     2,     1,     2,     1,     2,     3,     2,
+       3,     1,     1,     2,     2,     3,     1,     1,     2,     2,
+       3,     1,     1,     1,     1,     2,     2,     2,     3,     1,
+       1,     1,     2,     2,     0,     1,     3,     0,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 19: /* constructorlike: error '}'  */
+#line 175 "parser-tools/slghparse.y"
+                                       { slgh->resetConstructors(); }
+#line 2138 "src/build/slghparse.cc"
+    break;
+
+  case 20: /* endiandef: DEFINE_KEY ENDIAN_KEY '=' BIG_KEY ';'  */
+#line 177 "parser-tools/slghparse.y"
+                                                 { slgh->setEndian(1); }
+#line 2144 "src/build/slghparse.cc"
+    break;
+
+  case 21: /* endiandef: DEFINE_KEY ENDIAN_KEY '=' LITTLE_KEY ';'  */
+#line 178 "parser-tools/slghparse.y"
+                                             { slgh->setEndian(0); }
+#line 2150 "src/build/slghparse.cc"
+    break;
+
+  case 22: /* aligndef: DEFINE_KEY ALIGN_KEY '=' INTEGER ';'  */
+#line 180 "parser-tools/slghparse.y"
+                                               { slgh->setAlignment(*(yyvsp[-1].i)); delete (yyvsp[-1].i); }
+#line 2156 "src/build/slghparse.cc"
+    break;
+
+  case 23: /* tokendef: tokenprop ';'  */
+#line 182 "parser-tools/slghparse.y"
+                                       {}
+#line 2162 "src/build/slghparse.cc"
+    break;
+
+  case 24: /* tokenprop: DEFINE_KEY TOKEN_KEY STRING '(' INTEGER ')'  */
+#line 184 "parser-tools/slghparse.y"
+                                                       { (yyval.tokensym) = slgh->defineToken((yyvsp[-3].str),(yyvsp[-1].i)); }
+#line 2168 "src/build/slghparse.cc"
+    break;
+
+  case 25: /* tokenprop: tokenprop fielddef  */
+#line 185 "parser-tools/slghparse.y"
+                                       { (yyval.tokensym) = (yyvsp[-1].tokensym); slgh->addTokenField((yyvsp[-1].tokensym),(yyvsp[0].fieldqual)); }
+#line 2174 "src/build/slghparse.cc"
+    break;
+
+  case 26: /* tokenprop: DEFINE_KEY TOKEN_KEY anysymbol  */
+#line 186 "parser-tools/slghparse.y"
+                                       { string errmsg=(yyvsp[0].anysym)->getName()+": redefined as a token"; yyerror(errmsg.c_str()); YYERROR; }
+#line 2180 "src/build/slghparse.cc"
+    break;
+
+  case 27: /* contextdef: contextprop ';'  */
+#line 188 "parser-tools/slghparse.y"
+                                       {}
+#line 2186 "src/build/slghparse.cc"
+    break;
+
+  case 28: /* contextprop: DEFINE_KEY CONTEXT_KEY VARSYM  */
+#line 190 "parser-tools/slghparse.y"
+                                           { (yyval.varsym) = (yyvsp[0].varsym); }
+#line 2192 "src/build/slghparse.cc"
+    break;
+
+  case 29: /* contextprop: contextprop contextfielddef  */
+#line 191 "parser-tools/slghparse.y"
+                                         { (yyval.varsym) = (yyvsp[-1].varsym); if (!slgh->addContextField( (yyvsp[-1].varsym), (yyvsp[0].fieldqual) ))
+                                            { yyerror("All context definitions must come before constructors"); YYERROR; } }
+#line 2199 "src/build/slghparse.cc"
+    break;
+
+  case 30: /* fielddef: STRING '=' '(' INTEGER ',' INTEGER ')'  */
+#line 194 "parser-tools/slghparse.y"
+                                                 { (yyval.fieldqual) = new FieldQuality((yyvsp[-6].str),(yyvsp[-3].i),(yyvsp[-1].i)); }
+#line 2205 "src/build/slghparse.cc"
+    break;
+
+  case 31: /* fielddef: anysymbol '=' '(' INTEGER ',' INTEGER ')'  */
+#line 195 "parser-tools/slghparse.y"
+                                              { delete (yyvsp[-3].i); delete (yyvsp[-1].i); string errmsg = (yyvsp[-6].anysym)->getName()+": redefined as field"; yyerror(errmsg.c_str()); YYERROR; }
+#line 2211 "src/build/slghparse.cc"
+    break;
+
+  case 32: /* fielddef: fielddef SIGNED_KEY  */
+#line 196 "parser-tools/slghparse.y"
+                                        { (yyval.fieldqual) = (yyvsp[-1].fieldqual); (yyval.fieldqual)->signext = true; }
+#line 2217 "src/build/slghparse.cc"
+    break;
+
+  case 33: /* fielddef: fielddef HEX_KEY  */
+#line 197 "parser-tools/slghparse.y"
+                                        { (yyval.fieldqual) = (yyvsp[-1].fieldqual); (yyval.fieldqual)->hex = true; }
+#line 2223 "src/build/slghparse.cc"
+    break;
+
+  case 34: /* fielddef: fielddef DEC_KEY  */
+#line 198 "parser-tools/slghparse.y"
+                                        { (yyval.fieldqual) = (yyvsp[-1].fieldqual); (yyval.fieldqual)->hex = false; }
+#line 2229 "src/build/slghparse.cc"
+    break;
+
+  case 35: /* contextfielddef: STRING '=' '(' INTEGER ',' INTEGER ')'  */
+#line 200 "parser-tools/slghparse.y"
+                                                        { (yyval.fieldqual) = new FieldQuality((yyvsp[-6].str),(yyvsp[-3].i),(yyvsp[-1].i)); }
+#line 2235 "src/build/slghparse.cc"
+    break;
+
+  case 36: /* contextfielddef: anysymbol '=' '(' INTEGER ',' INTEGER ')'  */
+#line 201 "parser-tools/slghparse.y"
+                                              { delete (yyvsp[-3].i); delete (yyvsp[-1].i); string errmsg = (yyvsp[-6].anysym)->getName()+": redefined as field"; yyerror(errmsg.c_str()); YYERROR; }
+#line 2241 "src/build/slghparse.cc"
+    break;
+
+  case 37: /* contextfielddef: contextfielddef SIGNED_KEY  */
+#line 202 "parser-tools/slghparse.y"
+                                                { (yyval.fieldqual) = (yyvsp[-1].fieldqual); (yyval.fieldqual)->signext = true; }
+#line 2247 "src/build/slghparse.cc"
+    break;
+
+  case 38: /* contextfielddef: contextfielddef NOFLOW_KEY  */
+#line 203 "parser-tools/slghparse.y"
+                                                { (yyval.fieldqual) = (yyvsp[-1].fieldqual); (yyval.fieldqual)->flow = false; }
+#line 2253 "src/build/slghparse.cc"
+    break;
+
+  case 39: /* contextfielddef: contextfielddef HEX_KEY  */
+#line 204 "parser-tools/slghparse.y"
+                                                { (yyval.fieldqual) = (yyvsp[-1].fieldqual); (yyval.fieldqual)->hex = true; }
+#line 2259 "src/build/slghparse.cc"
+    break;
+
+  case 40: /* contextfielddef: contextfielddef DEC_KEY  */
+#line 205 "parser-tools/slghparse.y"
+                                                { (yyval.fieldqual) = (yyvsp[-1].fieldqual); (yyval.fieldqual)->hex = false; }
+#line 2265 "src/build/slghparse.cc"
+    break;
+
+  case 41: /* spacedef: spaceprop ';'  */
+#line 207 "parser-tools/slghparse.y"
+                                        { slgh->newSpace((yyvsp[-1].spacequal)); }
+#line 2271 "src/build/slghparse.cc"
+    break;
+
+  case 42: /* spaceprop: DEFINE_KEY SPACE_KEY STRING  */
+#line 209 "parser-tools/slghparse.y"
+                                        { (yyval.spacequal) = new SpaceQuality(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 2277 "src/build/slghparse.cc"
+    break;
+
+  case 43: /* spaceprop: DEFINE_KEY SPACE_KEY anysymbol  */
+#line 210 "parser-tools/slghparse.y"
+                                        { string errmsg = (yyvsp[0].anysym)->getName()+": redefined as space"; yyerror(errmsg.c_str()); YYERROR; }
+#line 2283 "src/build/slghparse.cc"
+    break;
+
+  case 44: /* spaceprop: spaceprop TYPE_KEY '=' RAM_KEY  */
+#line 211 "parser-tools/slghparse.y"
+                                        { (yyval.spacequal) = (yyvsp[-3].spacequal); (yyval.spacequal)->type = SpaceQuality::ramtype; }
+#line 2289 "src/build/slghparse.cc"
+    break;
+
+  case 45: /* spaceprop: spaceprop TYPE_KEY '=' REGISTER_KEY  */
+#line 212 "parser-tools/slghparse.y"
+                                        { (yyval.spacequal) = (yyvsp[-3].spacequal); (yyval.spacequal)->type = SpaceQuality::registertype; }
+#line 2295 "src/build/slghparse.cc"
+    break;
+
+  case 46: /* spaceprop: spaceprop SIZE_KEY '=' INTEGER  */
+#line 213 "parser-tools/slghparse.y"
+                                        { (yyval.spacequal) = (yyvsp[-3].spacequal); (yyval.spacequal)->size = *(yyvsp[0].i); delete (yyvsp[0].i); }
+#line 2301 "src/build/slghparse.cc"
+    break;
+
+  case 47: /* spaceprop: spaceprop WORDSIZE_KEY '=' INTEGER  */
+#line 214 "parser-tools/slghparse.y"
+                                        { (yyval.spacequal) = (yyvsp[-3].spacequal); (yyval.spacequal)->wordsize = *(yyvsp[0].i); delete (yyvsp[0].i); }
+#line 2307 "src/build/slghparse.cc"
+    break;
+
+  case 48: /* spaceprop: spaceprop DEFAULT_KEY  */
+#line 215 "parser-tools/slghparse.y"
+                                        { (yyval.spacequal) = (yyvsp[-1].spacequal); (yyval.spacequal)->isdefault = true; }
+#line 2313 "src/build/slghparse.cc"
+    break;
+
+  case 49: /* varnodedef: DEFINE_KEY SPACESYM OFFSET_KEY '=' INTEGER SIZE_KEY '=' INTEGER stringlist ';'  */
+#line 217 "parser-tools/slghparse.y"
+                                                                                           {
+               slgh->defineVarnodes((yyvsp[-8].spacesym),(yyvsp[-5].i),(yyvsp[-2].i),(yyvsp[-1].strlist)); }
+#line 2320 "src/build/slghparse.cc"
+    break;
+
+  case 50: /* varnodedef: DEFINE_KEY SPACESYM OFFSET_KEY '=' BADINTEGER  */
+#line 219 "parser-tools/slghparse.y"
+                                                  { yyerror("Parsed integer is too big (overflow)"); YYERROR; }
+#line 2326 "src/build/slghparse.cc"
+    break;
+
+  case 54: /* bitrangesingle: STRING '=' VARSYM '[' INTEGER ',' INTEGER ']'  */
+#line 226 "parser-tools/slghparse.y"
+                                                              {
+               slgh->defineBitrange((yyvsp[-7].str),(yyvsp[-5].varsym),(uint4)*(yyvsp[-3].i),(uint4)*(yyvsp[-1].i)); delete (yyvsp[-3].i); delete (yyvsp[-1].i); }
+#line 2333 "src/build/slghparse.cc"
+    break;
+
+  case 55: /* pcodeopdef: DEFINE_KEY PCODEOP_KEY stringlist ';'  */
+#line 229 "parser-tools/slghparse.y"
+                                                  { slgh->addUserOp((yyvsp[-1].strlist)); }
+#line 2339 "src/build/slghparse.cc"
+    break;
+
+  case 56: /* valueattach: ATTACH_KEY VALUES_KEY valuelist intblist ';'  */
+#line 231 "parser-tools/slghparse.y"
+                                                          { slgh->attachValues((yyvsp[-2].symlist),(yyvsp[-1].biglist)); }
+#line 2345 "src/build/slghparse.cc"
+    break;
+
+  case 57: /* nameattach: ATTACH_KEY NAMES_KEY valuelist anystringlist ';'  */
+#line 233 "parser-tools/slghparse.y"
+                                                             { slgh->attachNames((yyvsp[-2].symlist),(yyvsp[-1].strlist)); }
+#line 2351 "src/build/slghparse.cc"
+    break;
+
+  case 58: /* varattach: ATTACH_KEY VARIABLES_KEY valuelist varlist ';'  */
+#line 235 "parser-tools/slghparse.y"
+                                                          { slgh->attachVarnodes((yyvsp[-2].symlist),(yyvsp[-1].symlist)); }
+#line 2357 "src/build/slghparse.cc"
+    break;
+
+  case 59: /* macrodef: macrostart '{' rtl '}'  */
+#line 237 "parser-tools/slghparse.y"
+                                        { slgh->buildMacro((yyvsp[-3].macrosym),(yyvsp[-1].sem)); }
+#line 2363 "src/build/slghparse.cc"
+    break;
+
+  case 60: /* withblockstart: WITH_KEY id_or_nil ':' bitpat_or_nil contextblock '{'  */
+#line 240 "parser-tools/slghparse.y"
+                                                                       {  slgh->pushWith((yyvsp[-4].subtablesym),(yyvsp[-2].pateq),(yyvsp[-1].contop)); }
+#line 2369 "src/build/slghparse.cc"
+    break;
+
+  case 64: /* withblock: withblockmid '}'  */
+#line 246 "parser-tools/slghparse.y"
+                             { slgh->popWith(); }
+#line 2375 "src/build/slghparse.cc"
+    break;
+
+  case 65: /* id_or_nil: %empty  */
+#line 248 "parser-tools/slghparse.y"
+                        { (yyval.subtablesym) = (SubtableSymbol *)0; }
+#line 2381 "src/build/slghparse.cc"
+    break;
+
+  case 66: /* id_or_nil: SUBTABLESYM  */
+#line 249 "parser-tools/slghparse.y"
+                        { (yyval.subtablesym) = (yyvsp[0].subtablesym); }
+#line 2387 "src/build/slghparse.cc"
+    break;
+
+  case 67: /* id_or_nil: STRING  */
+#line 250 "parser-tools/slghparse.y"
+                        { (yyval.subtablesym) = slgh->newTable((yyvsp[0].str)); }
+#line 2393 "src/build/slghparse.cc"
+    break;
+
+  case 68: /* bitpat_or_nil: %empty  */
+#line 253 "parser-tools/slghparse.y"
+                           { (yyval.pateq) = (PatternEquation *)0; }
+#line 2399 "src/build/slghparse.cc"
+    break;
+
+  case 69: /* bitpat_or_nil: pequation  */
+#line 254 "parser-tools/slghparse.y"
+                           { (yyval.pateq) = (yyvsp[0].pateq); }
+#line 2405 "src/build/slghparse.cc"
+    break;
+
+  case 70: /* macrostart: MACRO_KEY STRING '(' oplist ')'  */
+#line 257 "parser-tools/slghparse.y"
+                                            { (yyval.macrosym) = slgh->createMacro((yyvsp[-3].str),(yyvsp[-1].strlist)); }
+#line 2411 "src/build/slghparse.cc"
+    break;
+
+  case 71: /* rtlbody: '{' rtl '}'  */
+#line 259 "parser-tools/slghparse.y"
+                     { (yyval.sectionstart) = slgh->standaloneSection((yyvsp[-1].sem)); }
+#line 2417 "src/build/slghparse.cc"
+    break;
+
+  case 72: /* rtlbody: '{' rtlcontinue rtlmid '}'  */
+#line 260 "parser-tools/slghparse.y"
+                               { (yyval.sectionstart) = slgh->finalNamedSection((yyvsp[-2].sectionstart),(yyvsp[-1].sem)); }
+#line 2423 "src/build/slghparse.cc"
+    break;
+
+  case 73: /* rtlbody: OP_UNIMPL  */
+#line 261 "parser-tools/slghparse.y"
+                     { (yyval.sectionstart) = (SectionVector *)0; }
+#line 2429 "src/build/slghparse.cc"
+    break;
+
+  case 74: /* constructor: constructprint IS_KEY pequation contextblock rtlbody  */
+#line 263 "parser-tools/slghparse.y"
+                                                                  { slgh->buildConstructor((yyvsp[-4].construct),(yyvsp[-2].pateq),(yyvsp[-1].contop),(yyvsp[0].sectionstart)); }
+#line 2435 "src/build/slghparse.cc"
+    break;
+
+  case 75: /* constructor: subtablestart IS_KEY pequation contextblock rtlbody  */
+#line 264 "parser-tools/slghparse.y"
+                                                                  { slgh->buildConstructor((yyvsp[-4].construct),(yyvsp[-2].pateq),(yyvsp[-1].contop),(yyvsp[0].sectionstart)); }
+#line 2441 "src/build/slghparse.cc"
+    break;
+
+  case 76: /* constructprint: subtablestart STRING  */
+#line 266 "parser-tools/slghparse.y"
+                                        { (yyval.construct) = (yyvsp[-1].construct); (yyval.construct)->addSyntax(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 2447 "src/build/slghparse.cc"
+    break;
+
+  case 77: /* constructprint: subtablestart charstring  */
+#line 267 "parser-tools/slghparse.y"
+                                        { (yyval.construct) = (yyvsp[-1].construct); (yyval.construct)->addSyntax(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 2453 "src/build/slghparse.cc"
+    break;
+
+  case 78: /* constructprint: subtablestart SYMBOLSTRING  */
+#line 268 "parser-tools/slghparse.y"
+                                        { (yyval.construct) = (yyvsp[-1].construct); if (slgh->isInRoot((yyvsp[-1].construct))) { (yyval.construct)->addSyntax(*(yyvsp[0].str)); delete (yyvsp[0].str); } else slgh->newOperand((yyvsp[-1].construct),(yyvsp[0].str)); }
+#line 2459 "src/build/slghparse.cc"
+    break;
+
+  case 79: /* constructprint: subtablestart '^'  */
+#line 269 "parser-tools/slghparse.y"
+                                                { (yyval.construct) = (yyvsp[-1].construct); if (!slgh->isInRoot((yyvsp[-1].construct))) { yyerror("Unexpected '^' at start of print pieces");  YYERROR; } }
+#line 2465 "src/build/slghparse.cc"
+    break;
+
+  case 80: /* constructprint: constructprint '^'  */
+#line 270 "parser-tools/slghparse.y"
+                                                { (yyval.construct) = (yyvsp[-1].construct); }
+#line 2471 "src/build/slghparse.cc"
+    break;
+
+  case 81: /* constructprint: constructprint STRING  */
+#line 271 "parser-tools/slghparse.y"
+                                                { (yyval.construct) = (yyvsp[-1].construct); (yyval.construct)->addSyntax(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 2477 "src/build/slghparse.cc"
+    break;
+
+  case 82: /* constructprint: constructprint charstring  */
+#line 272 "parser-tools/slghparse.y"
+                                        { (yyval.construct) = (yyvsp[-1].construct); (yyval.construct)->addSyntax(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 2483 "src/build/slghparse.cc"
+    break;
+
+  case 83: /* constructprint: constructprint ' '  */
+#line 273 "parser-tools/slghparse.y"
+                                                { (yyval.construct) = (yyvsp[-1].construct); (yyval.construct)->addSyntax(string(" ")); }
+#line 2489 "src/build/slghparse.cc"
+    break;
+
+  case 84: /* constructprint: constructprint SYMBOLSTRING  */
+#line 274 "parser-tools/slghparse.y"
+                                        { (yyval.construct) = (yyvsp[-1].construct); slgh->newOperand((yyvsp[-1].construct),(yyvsp[0].str)); }
+#line 2495 "src/build/slghparse.cc"
+    break;
+
+  case 85: /* subtablestart: SUBTABLESYM ':'  */
+#line 276 "parser-tools/slghparse.y"
+                                { (yyval.construct) = slgh->createConstructor((yyvsp[-1].subtablesym)); }
+#line 2501 "src/build/slghparse.cc"
+    break;
+
+  case 86: /* subtablestart: STRING ':'  */
+#line 277 "parser-tools/slghparse.y"
+                                                { SubtableSymbol *sym=slgh->newTable((yyvsp[-1].str)); (yyval.construct) = slgh->createConstructor(sym); }
+#line 2507 "src/build/slghparse.cc"
+    break;
+
+  case 87: /* subtablestart: ':'  */
+#line 278 "parser-tools/slghparse.y"
+                                                        { (yyval.construct) = slgh->createConstructor((SubtableSymbol *)0); }
+#line 2513 "src/build/slghparse.cc"
+    break;
+
+  case 88: /* subtablestart: subtablestart ' '  */
+#line 279 "parser-tools/slghparse.y"
+                                        { (yyval.construct) = (yyvsp[-1].construct); }
+#line 2519 "src/build/slghparse.cc"
+    break;
+
+  case 89: /* pexpression: INTB  */
+#line 281 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new ConstantValue(*(yyvsp[0].big)); delete (yyvsp[0].big); }
+#line 2525 "src/build/slghparse.cc"
+    break;
+
+  case 90: /* pexpression: familysymbol  */
+#line 283 "parser-tools/slghparse.y"
+                                        { if ((actionon==1)&&((yyvsp[0].famsym)->getType() != SleighSymbol::context_symbol))
+                                             { string errmsg="Global symbol "+(yyvsp[0].famsym)->getName(); errmsg += " is not allowed in action expression"; yyerror(errmsg.c_str()); } (yyval.patexp) = (yyvsp[0].famsym)->getPatternValue(); }
+#line 2532 "src/build/slghparse.cc"
+    break;
+
+  case 91: /* pexpression: specificsymbol  */
+#line 286 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = (yyvsp[0].specsym)->getPatternExpression(); }
+#line 2538 "src/build/slghparse.cc"
+    break;
+
+  case 92: /* pexpression: '(' pexpression ')'  */
+#line 287 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = (yyvsp[-1].patexp); }
+#line 2544 "src/build/slghparse.cc"
+    break;
+
+  case 93: /* pexpression: pexpression '+' pexpression  */
+#line 288 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new PlusExpression((yyvsp[-2].patexp),(yyvsp[0].patexp)); }
+#line 2550 "src/build/slghparse.cc"
+    break;
+
+  case 94: /* pexpression: pexpression '-' pexpression  */
+#line 289 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new SubExpression((yyvsp[-2].patexp),(yyvsp[0].patexp)); }
+#line 2556 "src/build/slghparse.cc"
+    break;
+
+  case 95: /* pexpression: pexpression '*' pexpression  */
+#line 290 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new MultExpression((yyvsp[-2].patexp),(yyvsp[0].patexp)); }
+#line 2562 "src/build/slghparse.cc"
+    break;
+
+  case 96: /* pexpression: pexpression OP_LEFT pexpression  */
+#line 291 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new LeftShiftExpression((yyvsp[-2].patexp),(yyvsp[0].patexp)); }
+#line 2568 "src/build/slghparse.cc"
+    break;
+
+  case 97: /* pexpression: pexpression OP_RIGHT pexpression  */
+#line 292 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new RightShiftExpression((yyvsp[-2].patexp),(yyvsp[0].patexp)); }
+#line 2574 "src/build/slghparse.cc"
+    break;
+
+  case 98: /* pexpression: pexpression OP_AND pexpression  */
+#line 293 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new AndExpression((yyvsp[-2].patexp),(yyvsp[0].patexp)); }
+#line 2580 "src/build/slghparse.cc"
+    break;
+
+  case 99: /* pexpression: pexpression OP_OR pexpression  */
+#line 294 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new OrExpression((yyvsp[-2].patexp),(yyvsp[0].patexp)); }
+#line 2586 "src/build/slghparse.cc"
+    break;
+
+  case 100: /* pexpression: pexpression OP_XOR pexpression  */
+#line 295 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new XorExpression((yyvsp[-2].patexp),(yyvsp[0].patexp)); }
+#line 2592 "src/build/slghparse.cc"
+    break;
+
+  case 101: /* pexpression: pexpression '/' pexpression  */
+#line 296 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new DivExpression((yyvsp[-2].patexp),(yyvsp[0].patexp)); }
+#line 2598 "src/build/slghparse.cc"
+    break;
+
+  case 102: /* pexpression: '-' pexpression  */
+#line 297 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new MinusExpression((yyvsp[0].patexp)); }
+#line 2604 "src/build/slghparse.cc"
+    break;
+
+  case 103: /* pexpression: '~' pexpression  */
+#line 298 "parser-tools/slghparse.y"
+                                        { (yyval.patexp) = new NotExpression((yyvsp[0].patexp)); }
+#line 2610 "src/build/slghparse.cc"
+    break;
+
+  case 105: /* pequation: pequation '&' pequation  */
+#line 301 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = new EquationAnd((yyvsp[-2].pateq),(yyvsp[0].pateq)); }
+#line 2616 "src/build/slghparse.cc"
+    break;
+
+  case 106: /* pequation: pequation '|' pequation  */
+#line 302 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = new EquationOr((yyvsp[-2].pateq),(yyvsp[0].pateq)); }
+#line 2622 "src/build/slghparse.cc"
+    break;
+
+  case 107: /* pequation: pequation ';' pequation  */
+#line 303 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = new EquationCat((yyvsp[-2].pateq),(yyvsp[0].pateq)); }
+#line 2628 "src/build/slghparse.cc"
+    break;
+
+  case 108: /* elleq: ELLIPSIS_KEY ellrt  */
+#line 305 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = new EquationLeftEllipsis((yyvsp[0].pateq)); }
+#line 2634 "src/build/slghparse.cc"
+    break;
+
+  case 110: /* ellrt: atomic ELLIPSIS_KEY  */
+#line 308 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = new EquationRightEllipsis((yyvsp[-1].pateq)); }
+#line 2640 "src/build/slghparse.cc"
+    break;
+
+  case 113: /* atomic: '(' pequation ')'  */
+#line 312 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = (yyvsp[-1].pateq); }
+#line 2646 "src/build/slghparse.cc"
+    break;
+
+  case 114: /* constraint: familysymbol '=' pexpression  */
+#line 314 "parser-tools/slghparse.y"
+                                         { (yyval.pateq) = new EqualEquation((yyvsp[-2].famsym)->getPatternValue(),(yyvsp[0].patexp)); }
+#line 2652 "src/build/slghparse.cc"
+    break;
+
+  case 115: /* constraint: familysymbol OP_NOTEQUAL pexpression  */
+#line 315 "parser-tools/slghparse.y"
+                                         { (yyval.pateq) = new NotEqualEquation((yyvsp[-2].famsym)->getPatternValue(),(yyvsp[0].patexp)); }
+#line 2658 "src/build/slghparse.cc"
+    break;
+
+  case 116: /* constraint: familysymbol '<' pexpression  */
+#line 316 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = new LessEquation((yyvsp[-2].famsym)->getPatternValue(),(yyvsp[0].patexp)); }
+#line 2664 "src/build/slghparse.cc"
+    break;
+
+  case 117: /* constraint: familysymbol OP_LESSEQUAL pexpression  */
+#line 317 "parser-tools/slghparse.y"
+                                          { (yyval.pateq) = new LessEqualEquation((yyvsp[-2].famsym)->getPatternValue(),(yyvsp[0].patexp)); }
+#line 2670 "src/build/slghparse.cc"
+    break;
+
+  case 118: /* constraint: familysymbol '>' pexpression  */
+#line 318 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = new GreaterEquation((yyvsp[-2].famsym)->getPatternValue(),(yyvsp[0].patexp)); }
+#line 2676 "src/build/slghparse.cc"
+    break;
+
+  case 119: /* constraint: familysymbol OP_GREATEQUAL pexpression  */
+#line 319 "parser-tools/slghparse.y"
+                                           { (yyval.pateq) = new GreaterEqualEquation((yyvsp[-2].famsym)->getPatternValue(),(yyvsp[0].patexp)); }
+#line 2682 "src/build/slghparse.cc"
+    break;
+
+  case 120: /* constraint: OPERANDSYM '=' pexpression  */
+#line 320 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = slgh->constrainOperand((yyvsp[-2].operandsym),(yyvsp[0].patexp)); 
+                                          if ((yyval.pateq) == (PatternEquation *)0) 
+                                            { string errmsg="Constraining currently undefined operand "+(yyvsp[-2].operandsym)->getName(); yyerror(errmsg.c_str()); } }
+#line 2690 "src/build/slghparse.cc"
+    break;
+
+  case 121: /* constraint: OPERANDSYM  */
+#line 323 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = new OperandEquation((yyvsp[0].operandsym)->getIndex()); slgh->selfDefine((yyvsp[0].operandsym)); }
+#line 2696 "src/build/slghparse.cc"
+    break;
+
+  case 122: /* constraint: SPECSYM  */
+#line 324 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = new UnconstrainedEquation((yyvsp[0].specsym)->getPatternExpression()); }
+#line 2702 "src/build/slghparse.cc"
+    break;
+
+  case 123: /* constraint: familysymbol  */
+#line 325 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = slgh->defineInvisibleOperand((yyvsp[0].famsym)); }
+#line 2708 "src/build/slghparse.cc"
+    break;
+
+  case 124: /* constraint: SUBTABLESYM  */
+#line 326 "parser-tools/slghparse.y"
+                                        { (yyval.pateq) = slgh->defineInvisibleOperand((yyvsp[0].subtablesym)); }
+#line 2714 "src/build/slghparse.cc"
+    break;
+
+  case 125: /* contextblock: %empty  */
+#line 328 "parser-tools/slghparse.y"
+                                        { (yyval.contop) = (vector<ContextChange *> *)0; }
+#line 2720 "src/build/slghparse.cc"
+    break;
+
+  case 126: /* contextblock: '[' contextlist ']'  */
+#line 329 "parser-tools/slghparse.y"
+                                        { (yyval.contop) = (yyvsp[-1].contop); }
+#line 2726 "src/build/slghparse.cc"
+    break;
+
+  case 127: /* contextlist: %empty  */
+#line 331 "parser-tools/slghparse.y"
+                                        { (yyval.contop) = new vector<ContextChange *>; }
+#line 2732 "src/build/slghparse.cc"
+    break;
+
+  case 128: /* contextlist: contextlist CONTEXTSYM '=' pexpression ';'  */
+#line 332 "parser-tools/slghparse.y"
+                                                { (yyval.contop) = (yyvsp[-4].contop); if (!slgh->contextMod((yyvsp[-4].contop),(yyvsp[-3].contextsym),(yyvsp[-1].patexp))) { string errmsg="Cannot use 'inst_next' to set context variable: "+(yyvsp[-3].contextsym)->getName(); yyerror(errmsg.c_str()); YYERROR; } }
+#line 2738 "src/build/slghparse.cc"
+    break;
+
+  case 129: /* contextlist: contextlist GLOBALSET_KEY '(' familysymbol ',' CONTEXTSYM ')' ';'  */
+#line 333 "parser-tools/slghparse.y"
+                                                                      { (yyval.contop) = (yyvsp[-7].contop); slgh->contextSet((yyvsp[-7].contop),(yyvsp[-4].famsym),(yyvsp[-2].contextsym)); }
+#line 2744 "src/build/slghparse.cc"
+    break;
+
+  case 130: /* contextlist: contextlist GLOBALSET_KEY '(' specificsymbol ',' CONTEXTSYM ')' ';'  */
+#line 334 "parser-tools/slghparse.y"
+                                                                        { (yyval.contop) = (yyvsp[-7].contop); slgh->contextSet((yyvsp[-7].contop),(yyvsp[-4].specsym),(yyvsp[-2].contextsym)); }
+#line 2750 "src/build/slghparse.cc"
+    break;
+
+  case 131: /* contextlist: contextlist OPERANDSYM '=' pexpression ';'  */
+#line 335 "parser-tools/slghparse.y"
+                                               { (yyval.contop) = (yyvsp[-4].contop); slgh->defineOperand((yyvsp[-3].operandsym),(yyvsp[-1].patexp)); }
+#line 2756 "src/build/slghparse.cc"
+    break;
+
+  case 132: /* contextlist: contextlist STRING  */
+#line 336 "parser-tools/slghparse.y"
+                                        { string errmsg="Expecting context symbol, not "+*(yyvsp[0].str); delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+#line 2762 "src/build/slghparse.cc"
+    break;
+
+  case 133: /* section_def: OP_LEFT STRING OP_RIGHT  */
+#line 338 "parser-tools/slghparse.y"
+                                        { (yyval.sectionsym) = slgh->newSectionSymbol( *(yyvsp[-1].str) ); delete (yyvsp[-1].str); }
+#line 2768 "src/build/slghparse.cc"
+    break;
+
+  case 134: /* section_def: OP_LEFT SECTIONSYM OP_RIGHT  */
+#line 339 "parser-tools/slghparse.y"
+                                        { (yyval.sectionsym) = (yyvsp[-1].sectionsym); }
+#line 2774 "src/build/slghparse.cc"
+    break;
+
+  case 135: /* rtlfirstsection: rtl section_def  */
+#line 341 "parser-tools/slghparse.y"
+                                        { (yyval.sectionstart) = slgh->firstNamedSection((yyvsp[-1].sem),(yyvsp[0].sectionsym)); }
+#line 2780 "src/build/slghparse.cc"
+    break;
+
+  case 136: /* rtlcontinue: rtlfirstsection  */
+#line 343 "parser-tools/slghparse.y"
+                             { (yyval.sectionstart) = (yyvsp[0].sectionstart); }
+#line 2786 "src/build/slghparse.cc"
+    break;
+
+  case 137: /* rtlcontinue: rtlcontinue rtlmid section_def  */
+#line 344 "parser-tools/slghparse.y"
+                                        { (yyval.sectionstart) = slgh->nextNamedSection((yyvsp[-2].sectionstart),(yyvsp[-1].sem),(yyvsp[0].sectionsym)); }
+#line 2792 "src/build/slghparse.cc"
+    break;
+
+  case 138: /* rtl: rtlmid  */
+#line 346 "parser-tools/slghparse.y"
+            { (yyval.sem) = (yyvsp[0].sem); if ((yyval.sem)->getOpvec().empty() && ((yyval.sem)->getResult() == (HandleTpl *)0)) slgh->recordNop(); }
+#line 2798 "src/build/slghparse.cc"
+    break;
+
+  case 139: /* rtl: rtlmid EXPORT_KEY exportvarnode ';'  */
+#line 347 "parser-tools/slghparse.y"
+                                        { (yyval.sem) = slgh->setResultVarnode((yyvsp[-3].sem),(yyvsp[-1].varnode)); }
+#line 2804 "src/build/slghparse.cc"
+    break;
+
+  case 140: /* rtl: rtlmid EXPORT_KEY sizedstar lhsvarnode ';'  */
+#line 348 "parser-tools/slghparse.y"
+                                               { (yyval.sem) = slgh->setResultStarVarnode((yyvsp[-4].sem),(yyvsp[-2].starqual),(yyvsp[-1].varnode)); }
+#line 2810 "src/build/slghparse.cc"
+    break;
+
+  case 141: /* rtl: rtlmid EXPORT_KEY STRING  */
+#line 349 "parser-tools/slghparse.y"
+                                        { string errmsg="Unknown export varnode: "+*(yyvsp[0].str); delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+#line 2816 "src/build/slghparse.cc"
+    break;
+
+  case 142: /* rtl: rtlmid EXPORT_KEY sizedstar STRING  */
+#line 350 "parser-tools/slghparse.y"
+                                        { string errmsg="Unknown pointer varnode: "+*(yyvsp[0].str); delete (yyvsp[-1].starqual); delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+#line 2822 "src/build/slghparse.cc"
+    break;
+
+  case 143: /* rtlmid: %empty  */
+#line 352 "parser-tools/slghparse.y"
+                                        { (yyval.sem) = new ConstructTpl(); }
+#line 2828 "src/build/slghparse.cc"
+    break;
+
+  case 144: /* rtlmid: rtlmid statement  */
+#line 353 "parser-tools/slghparse.y"
+                                        { (yyval.sem) = (yyvsp[-1].sem); if (!(yyval.sem)->addOpList(*(yyvsp[0].stmt))) { delete (yyvsp[0].stmt); yyerror("Multiple delayslot declarations"); YYERROR; } delete (yyvsp[0].stmt); }
+#line 2834 "src/build/slghparse.cc"
+    break;
+
+  case 145: /* rtlmid: rtlmid LOCAL_KEY STRING ';'  */
+#line 354 "parser-tools/slghparse.y"
+                                { (yyval.sem) = (yyvsp[-3].sem); slgh->pcode.newLocalDefinition((yyvsp[-1].str)); }
+#line 2840 "src/build/slghparse.cc"
+    break;
+
+  case 146: /* rtlmid: rtlmid LOCAL_KEY STRING ':' INTEGER ';'  */
+#line 355 "parser-tools/slghparse.y"
+                                            { (yyval.sem) = (yyvsp[-5].sem); slgh->pcode.newLocalDefinition((yyvsp[-3].str),*(yyvsp[-1].i)); delete (yyvsp[-1].i); }
+#line 2846 "src/build/slghparse.cc"
+    break;
+
+  case 147: /* statement: lhsvarnode '=' expr ';'  */
+#line 357 "parser-tools/slghparse.y"
+                                        { (yyvsp[-1].tree)->setOutput((yyvsp[-3].varnode)); (yyval.stmt) = ExprTree::toVector((yyvsp[-1].tree)); }
+#line 2852 "src/build/slghparse.cc"
+    break;
+
+  case 148: /* statement: LOCAL_KEY STRING '=' expr ';'  */
+#line 358 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.newOutput(true,(yyvsp[-1].tree),(yyvsp[-3].str)); }
+#line 2858 "src/build/slghparse.cc"
+    break;
+
+  case 149: /* statement: STRING '=' expr ';'  */
+#line 359 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.newOutput(false,(yyvsp[-1].tree),(yyvsp[-3].str)); }
+#line 2864 "src/build/slghparse.cc"
+    break;
+
+  case 150: /* statement: LOCAL_KEY STRING ':' INTEGER '=' expr ';'  */
+#line 360 "parser-tools/slghparse.y"
+                                                { (yyval.stmt) = slgh->pcode.newOutput(true,(yyvsp[-1].tree),(yyvsp[-5].str),*(yyvsp[-3].i)); delete (yyvsp[-3].i); }
+#line 2870 "src/build/slghparse.cc"
+    break;
+
+  case 151: /* statement: STRING ':' INTEGER '=' expr ';'  */
+#line 361 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.newOutput(true,(yyvsp[-1].tree),(yyvsp[-5].str),*(yyvsp[-3].i)); delete (yyvsp[-3].i); }
+#line 2876 "src/build/slghparse.cc"
+    break;
+
+  case 152: /* statement: LOCAL_KEY specificsymbol '='  */
+#line 362 "parser-tools/slghparse.y"
+                                 { (yyval.stmt) = (vector<OpTpl *> *)0; string errmsg = "Redefinition of symbol: "+(yyvsp[-1].specsym)->getName(); yyerror(errmsg.c_str()); YYERROR; }
+#line 2882 "src/build/slghparse.cc"
+    break;
+
+  case 153: /* statement: sizedstar expr '=' expr ';'  */
+#line 363 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createStore((yyvsp[-4].starqual),(yyvsp[-3].tree),(yyvsp[-1].tree)); }
+#line 2888 "src/build/slghparse.cc"
+    break;
+
+  case 154: /* statement: USEROPSYM '(' paramlist ')' ';'  */
+#line 364 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createUserOpNoOut((yyvsp[-4].useropsym),(yyvsp[-2].param)); }
+#line 2894 "src/build/slghparse.cc"
+    break;
+
+  case 155: /* statement: lhsvarnode '[' INTEGER ',' INTEGER ']' '=' expr ';'  */
+#line 365 "parser-tools/slghparse.y"
+                                                        { (yyval.stmt) = slgh->pcode.assignBitRange((yyvsp[-8].varnode),(uint4)*(yyvsp[-6].i),(uint4)*(yyvsp[-4].i),(yyvsp[-1].tree)); delete (yyvsp[-6].i), delete (yyvsp[-4].i); }
+#line 2900 "src/build/slghparse.cc"
+    break;
+
+  case 156: /* statement: BITSYM '=' expr ';'  */
+#line 366 "parser-tools/slghparse.y"
+                                        { (yyval.stmt)=slgh->pcode.assignBitRange((yyvsp[-3].bitsym)->getParentSymbol()->getVarnode(),(yyvsp[-3].bitsym)->getBitOffset(),(yyvsp[-3].bitsym)->numBits(),(yyvsp[-1].tree)); }
+#line 2906 "src/build/slghparse.cc"
+    break;
+
+  case 157: /* statement: varnode ':' INTEGER '='  */
+#line 367 "parser-tools/slghparse.y"
+                                        { delete (yyvsp[-3].varnode); delete (yyvsp[-1].i); yyerror("Illegal truncation on left-hand side of assignment"); YYERROR; }
+#line 2912 "src/build/slghparse.cc"
+    break;
+
+  case 158: /* statement: varnode '(' INTEGER ')'  */
+#line 368 "parser-tools/slghparse.y"
+                                        { delete (yyvsp[-3].varnode); delete (yyvsp[-1].i); yyerror("Illegal subpiece on left-hand side of assignment"); YYERROR; }
+#line 2918 "src/build/slghparse.cc"
+    break;
+
+  case 159: /* statement: BUILD_KEY OPERANDSYM ';'  */
+#line 369 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createOpConst(BUILD,(yyvsp[-1].operandsym)->getIndex()); }
+#line 2924 "src/build/slghparse.cc"
+    break;
+
+  case 160: /* statement: CROSSBUILD_KEY varnode ',' SECTIONSYM ';'  */
+#line 370 "parser-tools/slghparse.y"
+                                              { (yyval.stmt) = slgh->createCrossBuild((yyvsp[-3].varnode),(yyvsp[-1].sectionsym)); }
+#line 2930 "src/build/slghparse.cc"
+    break;
+
+  case 161: /* statement: CROSSBUILD_KEY varnode ',' STRING ';'  */
+#line 371 "parser-tools/slghparse.y"
+                                            { (yyval.stmt) = slgh->createCrossBuild((yyvsp[-3].varnode),slgh->newSectionSymbol(*(yyvsp[-1].str))); delete (yyvsp[-1].str); }
+#line 2936 "src/build/slghparse.cc"
+    break;
+
+  case 162: /* statement: DELAYSLOT_KEY '(' INTEGER ')' ';'  */
+#line 372 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createOpConst(DELAY_SLOT,*(yyvsp[-2].i)); delete (yyvsp[-2].i); }
+#line 2942 "src/build/slghparse.cc"
+    break;
+
+  case 163: /* statement: GOTO_KEY jumpdest ';'  */
+#line 373 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createOpNoOut(CPUI_BRANCH,new ExprTree((yyvsp[-1].varnode))); }
+#line 2948 "src/build/slghparse.cc"
+    break;
+
+  case 164: /* statement: IF_KEY expr GOTO_KEY jumpdest ';'  */
+#line 374 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createOpNoOut(CPUI_CBRANCH,new ExprTree((yyvsp[-1].varnode)),(yyvsp[-3].tree)); }
+#line 2954 "src/build/slghparse.cc"
+    break;
+
+  case 165: /* statement: GOTO_KEY '[' expr ']' ';'  */
+#line 375 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createOpNoOut(CPUI_BRANCHIND,(yyvsp[-2].tree)); }
+#line 2960 "src/build/slghparse.cc"
+    break;
+
+  case 166: /* statement: CALL_KEY jumpdest ';'  */
+#line 376 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createOpNoOut(CPUI_CALL,new ExprTree((yyvsp[-1].varnode))); }
+#line 2966 "src/build/slghparse.cc"
+    break;
+
+  case 167: /* statement: CALL_KEY '[' expr ']' ';'  */
+#line 377 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createOpNoOut(CPUI_CALLIND,(yyvsp[-2].tree)); }
+#line 2972 "src/build/slghparse.cc"
+    break;
+
+  case 168: /* statement: RETURN_KEY ';'  */
+#line 378 "parser-tools/slghparse.y"
+                                        { yyerror("Must specify an indirect parameter for return"); YYERROR; }
+#line 2978 "src/build/slghparse.cc"
+    break;
+
+  case 169: /* statement: RETURN_KEY '[' expr ']' ';'  */
+#line 379 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.createOpNoOut(CPUI_RETURN,(yyvsp[-2].tree)); }
+#line 2984 "src/build/slghparse.cc"
+    break;
+
+  case 170: /* statement: MACROSYM '(' paramlist ')' ';'  */
+#line 380 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->createMacroUse((yyvsp[-4].macrosym),(yyvsp[-2].param)); }
+#line 2990 "src/build/slghparse.cc"
+    break;
+
+  case 171: /* statement: label  */
+#line 381 "parser-tools/slghparse.y"
+                                        { (yyval.stmt) = slgh->pcode.placeLabel( (yyvsp[0].labelsym) ); }
+#line 2996 "src/build/slghparse.cc"
+    break;
+
+  case 172: /* expr: varnode  */
+#line 383 "parser-tools/slghparse.y"
+              { (yyval.tree) = new ExprTree((yyvsp[0].varnode)); }
+#line 3002 "src/build/slghparse.cc"
+    break;
+
+  case 173: /* expr: sizedstar expr  */
+#line 384 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createLoad((yyvsp[-1].starqual),(yyvsp[0].tree)); }
+#line 3008 "src/build/slghparse.cc"
+    break;
+
+  case 174: /* expr: '(' expr ')'  */
+#line 385 "parser-tools/slghparse.y"
+                                { (yyval.tree) = (yyvsp[-1].tree); }
+#line 3014 "src/build/slghparse.cc"
+    break;
+
+  case 175: /* expr: expr '+' expr  */
+#line 386 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_ADD,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3020 "src/build/slghparse.cc"
+    break;
+
+  case 176: /* expr: expr '-' expr  */
+#line 387 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SUB,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3026 "src/build/slghparse.cc"
+    break;
+
+  case 177: /* expr: expr OP_EQUAL expr  */
+#line 388 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_EQUAL,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3032 "src/build/slghparse.cc"
+    break;
+
+  case 178: /* expr: expr OP_NOTEQUAL expr  */
+#line 389 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_NOTEQUAL,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3038 "src/build/slghparse.cc"
+    break;
+
+  case 179: /* expr: expr '<' expr  */
+#line 390 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_LESS,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3044 "src/build/slghparse.cc"
+    break;
+
+  case 180: /* expr: expr OP_GREATEQUAL expr  */
+#line 391 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_LESSEQUAL,(yyvsp[0].tree),(yyvsp[-2].tree)); }
+#line 3050 "src/build/slghparse.cc"
+    break;
+
+  case 181: /* expr: expr OP_LESSEQUAL expr  */
+#line 392 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_LESSEQUAL,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3056 "src/build/slghparse.cc"
+    break;
+
+  case 182: /* expr: expr '>' expr  */
+#line 393 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_LESS,(yyvsp[0].tree),(yyvsp[-2].tree)); }
+#line 3062 "src/build/slghparse.cc"
+    break;
+
+  case 183: /* expr: expr OP_SLESS expr  */
+#line 394 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SLESS,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3068 "src/build/slghparse.cc"
+    break;
+
+  case 184: /* expr: expr OP_SGREATEQUAL expr  */
+#line 395 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SLESSEQUAL,(yyvsp[0].tree),(yyvsp[-2].tree)); }
+#line 3074 "src/build/slghparse.cc"
+    break;
+
+  case 185: /* expr: expr OP_SLESSEQUAL expr  */
+#line 396 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SLESSEQUAL,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3080 "src/build/slghparse.cc"
+    break;
+
+  case 186: /* expr: expr OP_SGREAT expr  */
+#line 397 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SLESS,(yyvsp[0].tree),(yyvsp[-2].tree)); }
+#line 3086 "src/build/slghparse.cc"
+    break;
+
+  case 187: /* expr: '-' expr  */
+#line 398 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_2COMP,(yyvsp[0].tree)); }
+#line 3092 "src/build/slghparse.cc"
+    break;
+
+  case 188: /* expr: '~' expr  */
+#line 399 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_NEGATE,(yyvsp[0].tree)); }
+#line 3098 "src/build/slghparse.cc"
+    break;
+
+  case 189: /* expr: expr '^' expr  */
+#line 400 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_XOR,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3104 "src/build/slghparse.cc"
+    break;
+
+  case 190: /* expr: expr '&' expr  */
+#line 401 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_AND,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3110 "src/build/slghparse.cc"
+    break;
+
+  case 191: /* expr: expr '|' expr  */
+#line 402 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_OR,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3116 "src/build/slghparse.cc"
+    break;
+
+  case 192: /* expr: expr OP_LEFT expr  */
+#line 403 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_LEFT,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3122 "src/build/slghparse.cc"
+    break;
+
+  case 193: /* expr: expr OP_RIGHT expr  */
+#line 404 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_RIGHT,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3128 "src/build/slghparse.cc"
+    break;
+
+  case 194: /* expr: expr OP_SRIGHT expr  */
+#line 405 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SRIGHT,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3134 "src/build/slghparse.cc"
+    break;
+
+  case 195: /* expr: expr '*' expr  */
+#line 406 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_MULT,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3140 "src/build/slghparse.cc"
+    break;
+
+  case 196: /* expr: expr '/' expr  */
+#line 407 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_DIV,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3146 "src/build/slghparse.cc"
+    break;
+
+  case 197: /* expr: expr OP_SDIV expr  */
+#line 408 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SDIV,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3152 "src/build/slghparse.cc"
+    break;
+
+  case 198: /* expr: expr '%' expr  */
+#line 409 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_REM,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3158 "src/build/slghparse.cc"
+    break;
+
+  case 199: /* expr: expr OP_SREM expr  */
+#line 410 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SREM,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3164 "src/build/slghparse.cc"
+    break;
+
+  case 200: /* expr: '!' expr  */
+#line 411 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_BOOL_NEGATE,(yyvsp[0].tree)); }
+#line 3170 "src/build/slghparse.cc"
+    break;
+
+  case 201: /* expr: expr OP_BOOL_XOR expr  */
+#line 412 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_BOOL_XOR,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3176 "src/build/slghparse.cc"
+    break;
+
+  case 202: /* expr: expr OP_BOOL_AND expr  */
+#line 413 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_BOOL_AND,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3182 "src/build/slghparse.cc"
+    break;
+
+  case 203: /* expr: expr OP_BOOL_OR expr  */
+#line 414 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_BOOL_OR,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3188 "src/build/slghparse.cc"
+    break;
+
+  case 204: /* expr: expr OP_FEQUAL expr  */
+#line 415 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_EQUAL,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3194 "src/build/slghparse.cc"
+    break;
+
+  case 205: /* expr: expr OP_FNOTEQUAL expr  */
+#line 416 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_NOTEQUAL,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3200 "src/build/slghparse.cc"
+    break;
+
+  case 206: /* expr: expr OP_FLESS expr  */
+#line 417 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_LESS,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3206 "src/build/slghparse.cc"
+    break;
+
+  case 207: /* expr: expr OP_FGREAT expr  */
+#line 418 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_LESS,(yyvsp[0].tree),(yyvsp[-2].tree)); }
+#line 3212 "src/build/slghparse.cc"
+    break;
+
+  case 208: /* expr: expr OP_FLESSEQUAL expr  */
+#line 419 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_LESSEQUAL,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3218 "src/build/slghparse.cc"
+    break;
+
+  case 209: /* expr: expr OP_FGREATEQUAL expr  */
+#line 420 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_LESSEQUAL,(yyvsp[0].tree),(yyvsp[-2].tree)); }
+#line 3224 "src/build/slghparse.cc"
+    break;
+
+  case 210: /* expr: expr OP_FADD expr  */
+#line 421 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_ADD,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3230 "src/build/slghparse.cc"
+    break;
+
+  case 211: /* expr: expr OP_FSUB expr  */
+#line 422 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_SUB,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3236 "src/build/slghparse.cc"
+    break;
+
+  case 212: /* expr: expr OP_FMULT expr  */
+#line 423 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_MULT,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3242 "src/build/slghparse.cc"
+    break;
+
+  case 213: /* expr: expr OP_FDIV expr  */
+#line 424 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_DIV,(yyvsp[-2].tree),(yyvsp[0].tree)); }
+#line 3248 "src/build/slghparse.cc"
+    break;
+
+  case 214: /* expr: OP_FSUB expr  */
+#line 425 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_NEG,(yyvsp[0].tree)); }
+#line 3254 "src/build/slghparse.cc"
+    break;
+
+  case 215: /* expr: OP_ABS '(' expr ')'  */
+#line 426 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_ABS,(yyvsp[-1].tree)); }
+#line 3260 "src/build/slghparse.cc"
+    break;
+
+  case 216: /* expr: OP_SQRT '(' expr ')'  */
+#line 427 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_SQRT,(yyvsp[-1].tree)); }
+#line 3266 "src/build/slghparse.cc"
+    break;
+
+  case 217: /* expr: OP_SEXT '(' expr ')'  */
+#line 428 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SEXT,(yyvsp[-1].tree)); }
+#line 3272 "src/build/slghparse.cc"
+    break;
+
+  case 218: /* expr: OP_ZEXT '(' expr ')'  */
+#line 429 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_ZEXT,(yyvsp[-1].tree)); }
+#line 3278 "src/build/slghparse.cc"
+    break;
+
+  case 219: /* expr: OP_CARRY '(' expr ',' expr ')'  */
+#line 430 "parser-tools/slghparse.y"
+                                   { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_CARRY,(yyvsp[-3].tree),(yyvsp[-1].tree)); }
+#line 3284 "src/build/slghparse.cc"
+    break;
+
+  case 220: /* expr: OP_SCARRY '(' expr ',' expr ')'  */
+#line 431 "parser-tools/slghparse.y"
+                                    { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SCARRY,(yyvsp[-3].tree),(yyvsp[-1].tree)); }
+#line 3290 "src/build/slghparse.cc"
+    break;
+
+  case 221: /* expr: OP_SBORROW '(' expr ',' expr ')'  */
+#line 432 "parser-tools/slghparse.y"
+                                     { (yyval.tree) = slgh->pcode.createOp(CPUI_INT_SBORROW,(yyvsp[-3].tree),(yyvsp[-1].tree)); }
+#line 3296 "src/build/slghparse.cc"
+    break;
+
+  case 222: /* expr: OP_FLOAT2FLOAT '(' expr ')'  */
+#line 433 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_FLOAT2FLOAT,(yyvsp[-1].tree)); }
+#line 3302 "src/build/slghparse.cc"
+    break;
+
+  case 223: /* expr: OP_INT2FLOAT '(' expr ')'  */
+#line 434 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_INT2FLOAT,(yyvsp[-1].tree)); }
+#line 3308 "src/build/slghparse.cc"
+    break;
+
+  case 224: /* expr: OP_NAN '(' expr ')'  */
+#line 435 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_NAN,(yyvsp[-1].tree)); }
+#line 3314 "src/build/slghparse.cc"
+    break;
+
+  case 225: /* expr: OP_TRUNC '(' expr ')'  */
+#line 436 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_TRUNC,(yyvsp[-1].tree)); }
+#line 3320 "src/build/slghparse.cc"
+    break;
+
+  case 226: /* expr: OP_CEIL '(' expr ')'  */
+#line 437 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_CEIL,(yyvsp[-1].tree)); }
+#line 3326 "src/build/slghparse.cc"
+    break;
+
+  case 227: /* expr: OP_FLOOR '(' expr ')'  */
+#line 438 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_FLOOR,(yyvsp[-1].tree)); }
+#line 3332 "src/build/slghparse.cc"
+    break;
+
+  case 228: /* expr: OP_ROUND '(' expr ')'  */
+#line 439 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createOp(CPUI_FLOAT_ROUND,(yyvsp[-1].tree)); }
+#line 3338 "src/build/slghparse.cc"
+    break;
+
+  case 229: /* expr: OP_NEW '(' expr ')'  */
+#line 440 "parser-tools/slghparse.y"
+                            { (yyval.tree) = slgh->pcode.createOp(CPUI_NEW,(yyvsp[-1].tree)); }
+#line 3344 "src/build/slghparse.cc"
+    break;
+
+  case 230: /* expr: OP_NEW '(' expr ',' expr ')'  */
+#line 441 "parser-tools/slghparse.y"
+                                 { (yyval.tree) = slgh->pcode.createOp(CPUI_NEW,(yyvsp[-3].tree),(yyvsp[-1].tree)); }
+#line 3350 "src/build/slghparse.cc"
+    break;
+
+  case 231: /* expr: specificsymbol '(' integervarnode ')'  */
+#line 442 "parser-tools/slghparse.y"
+                                          { (yyval.tree) = slgh->pcode.createOp(CPUI_SUBPIECE,new ExprTree((yyvsp[-3].specsym)->getVarnode()),new ExprTree((yyvsp[-1].varnode))); }
+#line 3356 "src/build/slghparse.cc"
+    break;
+
+  case 232: /* expr: specificsymbol ':' INTEGER  */
+#line 443 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createBitRange((yyvsp[-2].specsym),0,(uint4)(*(yyvsp[0].i) * 8)); delete (yyvsp[0].i); }
+#line 3362 "src/build/slghparse.cc"
+    break;
+
+  case 233: /* expr: specificsymbol '[' INTEGER ',' INTEGER ']'  */
+#line 444 "parser-tools/slghparse.y"
+                                               { (yyval.tree) = slgh->pcode.createBitRange((yyvsp[-5].specsym),(uint4)*(yyvsp[-3].i),(uint4)*(yyvsp[-1].i)); delete (yyvsp[-3].i), delete (yyvsp[-1].i); }
+#line 3368 "src/build/slghparse.cc"
+    break;
+
+  case 234: /* expr: BITSYM  */
+#line 445 "parser-tools/slghparse.y"
+                                { (yyval.tree)=slgh->pcode.createBitRange((yyvsp[0].bitsym)->getParentSymbol(),(yyvsp[0].bitsym)->getBitOffset(),(yyvsp[0].bitsym)->numBits()); }
+#line 3374 "src/build/slghparse.cc"
+    break;
+
+  case 235: /* expr: USEROPSYM '(' paramlist ')'  */
+#line 446 "parser-tools/slghparse.y"
+                                { (yyval.tree) = slgh->pcode.createUserOp((yyvsp[-3].useropsym),(yyvsp[-1].param)); }
+#line 3380 "src/build/slghparse.cc"
+    break;
+
+  case 236: /* expr: OP_CPOOLREF '(' paramlist ')'  */
+#line 447 "parser-tools/slghparse.y"
+                                   { if ((*(yyvsp[-1].param)).size() < 2) { string errmsg = "Must at least two inputs to cpool"; yyerror(errmsg.c_str()); YYERROR; } (yyval.tree) = slgh->pcode.createVariadic(CPUI_CPOOLREF,(yyvsp[-1].param)); }
+#line 3386 "src/build/slghparse.cc"
+    break;
+
+  case 237: /* sizedstar: '*' '[' SPACESYM ']' ':' INTEGER  */
+#line 449 "parser-tools/slghparse.y"
+                                            { (yyval.starqual) = new StarQuality; (yyval.starqual)->size = *(yyvsp[0].i); delete (yyvsp[0].i); (yyval.starqual)->id=ConstTpl((yyvsp[-3].spacesym)->getSpace()); }
+#line 3392 "src/build/slghparse.cc"
+    break;
+
+  case 238: /* sizedstar: '*' '[' SPACESYM ']'  */
+#line 450 "parser-tools/slghparse.y"
+                                { (yyval.starqual) = new StarQuality; (yyval.starqual)->size = 0; (yyval.starqual)->id=ConstTpl((yyvsp[-1].spacesym)->getSpace()); }
+#line 3398 "src/build/slghparse.cc"
+    break;
+
+  case 239: /* sizedstar: '*' ':' INTEGER  */
+#line 451 "parser-tools/slghparse.y"
+                                { (yyval.starqual) = new StarQuality; (yyval.starqual)->size = *(yyvsp[0].i); delete (yyvsp[0].i); (yyval.starqual)->id=ConstTpl(slgh->getDefaultSpace()); }
+#line 3404 "src/build/slghparse.cc"
+    break;
+
+  case 240: /* sizedstar: '*'  */
+#line 452 "parser-tools/slghparse.y"
+                                { (yyval.starqual) = new StarQuality; (yyval.starqual)->size = 0; (yyval.starqual)->id=ConstTpl(slgh->getDefaultSpace()); }
+#line 3410 "src/build/slghparse.cc"
+    break;
+
+  case 241: /* jumpdest: STARTSYM  */
+#line 454 "parser-tools/slghparse.y"
+                                { VarnodeTpl *sym = (yyvsp[0].startsym)->getVarnode(); (yyval.varnode) = new VarnodeTpl(ConstTpl(ConstTpl::j_curspace),sym->getOffset(),ConstTpl(ConstTpl::j_curspace_size)); delete sym; }
+#line 3416 "src/build/slghparse.cc"
+    break;
+
+  case 242: /* jumpdest: ENDSYM  */
+#line 455 "parser-tools/slghparse.y"
+                                { VarnodeTpl *sym = (yyvsp[0].endsym)->getVarnode(); (yyval.varnode) = new VarnodeTpl(ConstTpl(ConstTpl::j_curspace),sym->getOffset(),ConstTpl(ConstTpl::j_curspace_size)); delete sym; }
+#line 3422 "src/build/slghparse.cc"
+    break;
+
+  case 243: /* jumpdest: INTEGER  */
+#line 456 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = new VarnodeTpl(ConstTpl(ConstTpl::j_curspace),ConstTpl(ConstTpl::real,*(yyvsp[0].i)),ConstTpl(ConstTpl::j_curspace_size)); delete (yyvsp[0].i); }
+#line 3428 "src/build/slghparse.cc"
+    break;
+
+  case 244: /* jumpdest: BADINTEGER  */
+#line 457 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = new VarnodeTpl(ConstTpl(ConstTpl::j_curspace),ConstTpl(ConstTpl::real,0),ConstTpl(ConstTpl::j_curspace_size)); yyerror("Parsed integer is too big (overflow)"); }
+#line 3434 "src/build/slghparse.cc"
+    break;
+
+  case 245: /* jumpdest: OPERANDSYM  */
+#line 458 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = (yyvsp[0].operandsym)->getVarnode(); (yyvsp[0].operandsym)->setCodeAddress(); }
+#line 3440 "src/build/slghparse.cc"
+    break;
+
+  case 246: /* jumpdest: INTEGER '[' SPACESYM ']'  */
+#line 459 "parser-tools/slghparse.y"
+                                { AddrSpace *spc = (yyvsp[-1].spacesym)->getSpace(); (yyval.varnode) = new VarnodeTpl(ConstTpl(spc),ConstTpl(ConstTpl::real,*(yyvsp[-3].i)),ConstTpl(ConstTpl::real,spc->getAddrSize())); delete (yyvsp[-3].i); }
+#line 3446 "src/build/slghparse.cc"
+    break;
+
+  case 247: /* jumpdest: label  */
+#line 460 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = new VarnodeTpl(ConstTpl(slgh->getConstantSpace()),ConstTpl(ConstTpl::j_relative,(yyvsp[0].labelsym)->getIndex()),ConstTpl(ConstTpl::real,sizeof(uintm))); (yyvsp[0].labelsym)->incrementRefCount(); }
+#line 3452 "src/build/slghparse.cc"
+    break;
+
+  case 248: /* jumpdest: STRING  */
+#line 461 "parser-tools/slghparse.y"
+                                { string errmsg = "Unknown jump destination: "+*(yyvsp[0].str); delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+#line 3458 "src/build/slghparse.cc"
+    break;
+
+  case 249: /* varnode: specificsymbol  */
+#line 463 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = (yyvsp[0].specsym)->getVarnode(); }
+#line 3464 "src/build/slghparse.cc"
+    break;
+
+  case 250: /* varnode: integervarnode  */
+#line 464 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = (yyvsp[0].varnode); }
+#line 3470 "src/build/slghparse.cc"
+    break;
+
+  case 251: /* varnode: STRING  */
+#line 465 "parser-tools/slghparse.y"
+                                { string errmsg = "Unknown varnode parameter: "+*(yyvsp[0].str); delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+#line 3476 "src/build/slghparse.cc"
+    break;
+
+  case 252: /* varnode: SUBTABLESYM  */
+#line 466 "parser-tools/slghparse.y"
+                                { string errmsg = "Subtable not attached to operand: "+(yyvsp[0].subtablesym)->getName(); yyerror(errmsg.c_str()); YYERROR; }
+#line 3482 "src/build/slghparse.cc"
+    break;
+
+  case 253: /* integervarnode: INTEGER  */
+#line 468 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = new VarnodeTpl(ConstTpl(slgh->getConstantSpace()),ConstTpl(ConstTpl::real,*(yyvsp[0].i)),ConstTpl(ConstTpl::real,0)); delete (yyvsp[0].i); }
+#line 3488 "src/build/slghparse.cc"
+    break;
+
+  case 254: /* integervarnode: BADINTEGER  */
+#line 469 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = new VarnodeTpl(ConstTpl(slgh->getConstantSpace()),ConstTpl(ConstTpl::real,0),ConstTpl(ConstTpl::real,0)); yyerror("Parsed integer is too big (overflow)"); }
+#line 3494 "src/build/slghparse.cc"
+    break;
+
+  case 255: /* integervarnode: INTEGER ':' INTEGER  */
+#line 470 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = new VarnodeTpl(ConstTpl(slgh->getConstantSpace()),ConstTpl(ConstTpl::real,*(yyvsp[-2].i)),ConstTpl(ConstTpl::real,*(yyvsp[0].i))); delete (yyvsp[-2].i); delete (yyvsp[0].i); }
+#line 3500 "src/build/slghparse.cc"
+    break;
+
+  case 256: /* integervarnode: '&' varnode  */
+#line 471 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = slgh->pcode.addressOf((yyvsp[0].varnode),0); }
+#line 3506 "src/build/slghparse.cc"
+    break;
+
+  case 257: /* integervarnode: '&' ':' INTEGER varnode  */
+#line 472 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = slgh->pcode.addressOf((yyvsp[0].varnode),*(yyvsp[-1].i)); delete (yyvsp[-1].i); }
+#line 3512 "src/build/slghparse.cc"
+    break;
+
+  case 258: /* lhsvarnode: specificsymbol  */
+#line 474 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = (yyvsp[0].specsym)->getVarnode(); }
+#line 3518 "src/build/slghparse.cc"
+    break;
+
+  case 259: /* lhsvarnode: STRING  */
+#line 475 "parser-tools/slghparse.y"
+                                { string errmsg = "Unknown assignment varnode: "+*(yyvsp[0].str); delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+#line 3524 "src/build/slghparse.cc"
+    break;
+
+  case 260: /* lhsvarnode: SUBTABLESYM  */
+#line 476 "parser-tools/slghparse.y"
+                                { string errmsg = "Subtable not attached to operand: "+(yyvsp[0].subtablesym)->getName(); yyerror(errmsg.c_str()); YYERROR; }
+#line 3530 "src/build/slghparse.cc"
+    break;
+
+  case 261: /* label: '<' LABELSYM '>'  */
+#line 478 "parser-tools/slghparse.y"
+                                { (yyval.labelsym) = (yyvsp[-1].labelsym); }
+#line 3536 "src/build/slghparse.cc"
+    break;
+
+  case 262: /* label: '<' STRING '>'  */
+#line 479 "parser-tools/slghparse.y"
+                                { (yyval.labelsym) = slgh->pcode.defineLabel( (yyvsp[-1].str) ); }
+#line 3542 "src/build/slghparse.cc"
+    break;
+
+  case 263: /* exportvarnode: specificsymbol  */
+#line 481 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = (yyvsp[0].specsym)->getVarnode(); }
+#line 3548 "src/build/slghparse.cc"
+    break;
+
+  case 264: /* exportvarnode: '&' varnode  */
+#line 482 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = slgh->pcode.addressOf((yyvsp[0].varnode),0); }
+#line 3554 "src/build/slghparse.cc"
+    break;
+
+  case 265: /* exportvarnode: '&' ':' INTEGER varnode  */
+#line 483 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = slgh->pcode.addressOf((yyvsp[0].varnode),*(yyvsp[-1].i)); delete (yyvsp[-1].i); }
+#line 3560 "src/build/slghparse.cc"
+    break;
+
+  case 266: /* exportvarnode: INTEGER ':' INTEGER  */
+#line 484 "parser-tools/slghparse.y"
+                                { (yyval.varnode) = new VarnodeTpl(ConstTpl(slgh->getConstantSpace()),ConstTpl(ConstTpl::real,*(yyvsp[-2].i)),ConstTpl(ConstTpl::real,*(yyvsp[0].i))); delete (yyvsp[-2].i); delete (yyvsp[0].i); }
+#line 3566 "src/build/slghparse.cc"
+    break;
+
+  case 267: /* exportvarnode: STRING  */
+#line 485 "parser-tools/slghparse.y"
+                                { string errmsg="Unknown export varnode: "+*(yyvsp[0].str); delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+#line 3572 "src/build/slghparse.cc"
+    break;
+
+  case 268: /* exportvarnode: SUBTABLESYM  */
+#line 486 "parser-tools/slghparse.y"
+                                { string errmsg = "Subtable not attached to operand: "+(yyvsp[0].subtablesym)->getName(); yyerror(errmsg.c_str()); YYERROR; }
+#line 3578 "src/build/slghparse.cc"
+    break;
+
+  case 269: /* familysymbol: VALUESYM  */
+#line 488 "parser-tools/slghparse.y"
+                                { (yyval.famsym) = (yyvsp[0].valuesym); }
+#line 3584 "src/build/slghparse.cc"
+    break;
+
+  case 270: /* familysymbol: VALUEMAPSYM  */
+#line 489 "parser-tools/slghparse.y"
+                                { (yyval.famsym) = (yyvsp[0].valuemapsym); }
+#line 3590 "src/build/slghparse.cc"
+    break;
+
+  case 271: /* familysymbol: CONTEXTSYM  */
+#line 490 "parser-tools/slghparse.y"
+                                { (yyval.famsym) = (yyvsp[0].contextsym); }
+#line 3596 "src/build/slghparse.cc"
+    break;
+
+  case 272: /* familysymbol: NAMESYM  */
+#line 491 "parser-tools/slghparse.y"
+                                { (yyval.famsym) = (yyvsp[0].namesym); }
+#line 3602 "src/build/slghparse.cc"
+    break;
+
+  case 273: /* familysymbol: VARLISTSYM  */
+#line 492 "parser-tools/slghparse.y"
+                                { (yyval.famsym) = (yyvsp[0].varlistsym); }
+#line 3608 "src/build/slghparse.cc"
+    break;
+
+  case 274: /* specificsymbol: VARSYM  */
+#line 494 "parser-tools/slghparse.y"
+                                { (yyval.specsym) = (yyvsp[0].varsym); }
+#line 3614 "src/build/slghparse.cc"
+    break;
+
+  case 275: /* specificsymbol: SPECSYM  */
+#line 495 "parser-tools/slghparse.y"
+                                { (yyval.specsym) = (yyvsp[0].specsym); }
+#line 3620 "src/build/slghparse.cc"
+    break;
+
+  case 276: /* specificsymbol: OPERANDSYM  */
+#line 496 "parser-tools/slghparse.y"
+                                { (yyval.specsym) = (yyvsp[0].operandsym); }
+#line 3626 "src/build/slghparse.cc"
+    break;
+
+  case 277: /* specificsymbol: STARTSYM  */
+#line 497 "parser-tools/slghparse.y"
+                                { (yyval.specsym) = (yyvsp[0].startsym); }
+#line 3632 "src/build/slghparse.cc"
+    break;
+
+  case 278: /* specificsymbol: ENDSYM  */
+#line 498 "parser-tools/slghparse.y"
+                                { (yyval.specsym) = (yyvsp[0].endsym); }
+#line 3638 "src/build/slghparse.cc"
+    break;
+
+  case 279: /* charstring: CHAR  */
+#line 500 "parser-tools/slghparse.y"
+                                { (yyval.str) = new string; (*(yyval.str)) += (yyvsp[0].ch); }
+#line 3644 "src/build/slghparse.cc"
+    break;
+
+  case 280: /* charstring: charstring CHAR  */
+#line 501 "parser-tools/slghparse.y"
+                                { (yyval.str) = (yyvsp[-1].str); (*(yyval.str)) += (yyvsp[0].ch); }
+#line 3650 "src/build/slghparse.cc"
+    break;
+
+  case 281: /* intblist: '[' intbpart ']'  */
+#line 503 "parser-tools/slghparse.y"
+                                { (yyval.biglist) = (yyvsp[-1].biglist); }
+#line 3656 "src/build/slghparse.cc"
+    break;
+
+  case 282: /* intblist: INTEGER  */
+#line 504 "parser-tools/slghparse.y"
+                                { (yyval.biglist) = new vector<intb>; (yyval.biglist)->push_back(intb(*(yyvsp[0].i))); delete (yyvsp[0].i); }
+#line 3662 "src/build/slghparse.cc"
+    break;
+
+  case 283: /* intblist: '-' INTEGER  */
+#line 505 "parser-tools/slghparse.y"
+                                { (yyval.biglist) = new vector<intb>; (yyval.biglist)->push_back(-intb(*(yyvsp[0].i))); delete (yyvsp[0].i); }
+#line 3668 "src/build/slghparse.cc"
+    break;
+
+  case 284: /* intbpart: INTEGER  */
+#line 507 "parser-tools/slghparse.y"
+                                { (yyval.biglist) = new vector<intb>; (yyval.biglist)->push_back(intb(*(yyvsp[0].i))); delete (yyvsp[0].i); }
+#line 3674 "src/build/slghparse.cc"
+    break;
+
+  case 285: /* intbpart: '-' INTEGER  */
+#line 508 "parser-tools/slghparse.y"
+                                { (yyval.biglist) = new vector<intb>; (yyval.biglist)->push_back(-intb(*(yyvsp[0].i))); delete (yyvsp[0].i); }
+#line 3680 "src/build/slghparse.cc"
+    break;
+
+  case 286: /* intbpart: STRING  */
+#line 509 "parser-tools/slghparse.y"
+                                { if (*(yyvsp[0].str)!="_") { string errmsg = "Expecting integer but saw: "+*(yyvsp[0].str); delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+                                  (yyval.biglist) = new vector<intb>; (yyval.biglist)->push_back((intb)0xBADBEEF); delete (yyvsp[0].str); }
+#line 3687 "src/build/slghparse.cc"
+    break;
+
+  case 287: /* intbpart: intbpart INTEGER  */
+#line 511 "parser-tools/slghparse.y"
+                                { (yyval.biglist) = (yyvsp[-1].biglist); (yyval.biglist)->push_back(intb(*(yyvsp[0].i))); delete (yyvsp[0].i); }
+#line 3693 "src/build/slghparse.cc"
+    break;
+
+  case 288: /* intbpart: intbpart '-' INTEGER  */
+#line 512 "parser-tools/slghparse.y"
+                                { (yyval.biglist) = (yyvsp[-2].biglist); (yyval.biglist)->push_back(-intb(*(yyvsp[0].i))); delete (yyvsp[0].i); }
+#line 3699 "src/build/slghparse.cc"
+    break;
+
+  case 289: /* intbpart: intbpart STRING  */
+#line 513 "parser-tools/slghparse.y"
+                                { if (*(yyvsp[0].str)!="_") { string errmsg = "Expecting integer but saw: "+*(yyvsp[0].str); delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+                                  (yyval.biglist) = (yyvsp[-1].biglist); (yyval.biglist)->push_back((intb)0xBADBEEF); delete (yyvsp[0].str); }
+#line 3706 "src/build/slghparse.cc"
+    break;
+
+  case 290: /* stringlist: '[' stringpart ']'  */
+#line 516 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = (yyvsp[-1].strlist); }
+#line 3712 "src/build/slghparse.cc"
+    break;
+
+  case 291: /* stringlist: STRING  */
+#line 517 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = new vector<string>; (yyval.strlist)->push_back(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 3718 "src/build/slghparse.cc"
+    break;
+
+  case 292: /* stringpart: STRING  */
+#line 519 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = new vector<string>; (yyval.strlist)->push_back( *(yyvsp[0].str) ); delete (yyvsp[0].str); }
+#line 3724 "src/build/slghparse.cc"
+    break;
+
+  case 293: /* stringpart: stringpart STRING  */
+#line 520 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = (yyvsp[-1].strlist); (yyval.strlist)->push_back(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 3730 "src/build/slghparse.cc"
+    break;
+
+  case 294: /* stringpart: stringpart anysymbol  */
+#line 521 "parser-tools/slghparse.y"
+                                { string errmsg = (yyvsp[0].anysym)->getName()+": redefined"; yyerror(errmsg.c_str()); YYERROR; }
+#line 3736 "src/build/slghparse.cc"
+    break;
+
+  case 295: /* anystringlist: '[' anystringpart ']'  */
+#line 523 "parser-tools/slghparse.y"
+                                     { (yyval.strlist) = (yyvsp[-1].strlist); }
+#line 3742 "src/build/slghparse.cc"
+    break;
+
+  case 296: /* anystringpart: STRING  */
+#line 525 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = new vector<string>; (yyval.strlist)->push_back( *(yyvsp[0].str) ); delete (yyvsp[0].str); }
+#line 3748 "src/build/slghparse.cc"
+    break;
+
+  case 297: /* anystringpart: anysymbol  */
+#line 526 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = new vector<string>; (yyval.strlist)->push_back( (yyvsp[0].anysym)->getName() ); }
+#line 3754 "src/build/slghparse.cc"
+    break;
+
+  case 298: /* anystringpart: anystringpart STRING  */
+#line 527 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = (yyvsp[-1].strlist); (yyval.strlist)->push_back(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 3760 "src/build/slghparse.cc"
+    break;
+
+  case 299: /* anystringpart: anystringpart anysymbol  */
+#line 528 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = (yyvsp[-1].strlist); (yyval.strlist)->push_back((yyvsp[0].anysym)->getName()); }
+#line 3766 "src/build/slghparse.cc"
+    break;
+
+  case 300: /* valuelist: '[' valuepart ']'  */
+#line 530 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = (yyvsp[-1].symlist); }
+#line 3772 "src/build/slghparse.cc"
+    break;
+
+  case 301: /* valuelist: VALUESYM  */
+#line 531 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = new vector<SleighSymbol *>; (yyval.symlist)->push_back((yyvsp[0].valuesym)); }
+#line 3778 "src/build/slghparse.cc"
+    break;
+
+  case 302: /* valuelist: CONTEXTSYM  */
+#line 532 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = new vector<SleighSymbol *>; (yyval.symlist)->push_back((yyvsp[0].contextsym)); }
+#line 3784 "src/build/slghparse.cc"
+    break;
+
+  case 303: /* valuepart: VALUESYM  */
+#line 534 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = new vector<SleighSymbol *>; (yyval.symlist)->push_back( (yyvsp[0].valuesym) ); }
+#line 3790 "src/build/slghparse.cc"
+    break;
+
+  case 304: /* valuepart: CONTEXTSYM  */
+#line 535 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = new vector<SleighSymbol *>; (yyval.symlist)->push_back((yyvsp[0].contextsym)); }
+#line 3796 "src/build/slghparse.cc"
+    break;
+
+  case 305: /* valuepart: valuepart VALUESYM  */
+#line 536 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = (yyvsp[-1].symlist); (yyval.symlist)->push_back((yyvsp[0].valuesym)); }
+#line 3802 "src/build/slghparse.cc"
+    break;
+
+  case 306: /* valuepart: valuepart CONTEXTSYM  */
+#line 537 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = (yyvsp[-1].symlist); (yyval.symlist)->push_back((yyvsp[0].contextsym)); }
+#line 3808 "src/build/slghparse.cc"
+    break;
+
+  case 307: /* valuepart: valuepart STRING  */
+#line 538 "parser-tools/slghparse.y"
+                                { string errmsg = *(yyvsp[0].str)+": is not a value pattern"; delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+#line 3814 "src/build/slghparse.cc"
+    break;
+
+  case 308: /* varlist: '[' varpart ']'  */
+#line 540 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = (yyvsp[-1].symlist); }
+#line 3820 "src/build/slghparse.cc"
+    break;
+
+  case 309: /* varlist: VARSYM  */
+#line 541 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = new vector<SleighSymbol *>; (yyval.symlist)->push_back((yyvsp[0].varsym)); }
+#line 3826 "src/build/slghparse.cc"
+    break;
+
+  case 310: /* varpart: VARSYM  */
+#line 543 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = new vector<SleighSymbol *>; (yyval.symlist)->push_back((yyvsp[0].varsym)); }
+#line 3832 "src/build/slghparse.cc"
+    break;
+
+  case 311: /* varpart: STRING  */
+#line 544 "parser-tools/slghparse.y"
+                                { if (*(yyvsp[0].str)!="_") { string errmsg = *(yyvsp[0].str)+": is not a varnode symbol"; delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+				  (yyval.symlist) = new vector<SleighSymbol *>; (yyval.symlist)->push_back((SleighSymbol *)0); delete (yyvsp[0].str); }
+#line 3839 "src/build/slghparse.cc"
+    break;
+
+  case 312: /* varpart: varpart VARSYM  */
+#line 546 "parser-tools/slghparse.y"
+                                { (yyval.symlist) = (yyvsp[-1].symlist); (yyval.symlist)->push_back((yyvsp[0].varsym)); }
+#line 3845 "src/build/slghparse.cc"
+    break;
+
+  case 313: /* varpart: varpart STRING  */
+#line 547 "parser-tools/slghparse.y"
+                                { if (*(yyvsp[0].str)!="_") { string errmsg = *(yyvsp[0].str)+": is not a varnode symbol"; delete (yyvsp[0].str); yyerror(errmsg.c_str()); YYERROR; }
+                                  (yyval.symlist) = (yyvsp[-1].symlist); (yyval.symlist)->push_back((SleighSymbol *)0); delete (yyvsp[0].str); }
+#line 3852 "src/build/slghparse.cc"
+    break;
+
+  case 314: /* paramlist: %empty  */
+#line 550 "parser-tools/slghparse.y"
+                                { (yyval.param) = new vector<ExprTree *>; }
+#line 3858 "src/build/slghparse.cc"
+    break;
+
+  case 315: /* paramlist: expr  */
+#line 551 "parser-tools/slghparse.y"
+                                { (yyval.param) = new vector<ExprTree *>; (yyval.param)->push_back((yyvsp[0].tree)); }
+#line 3864 "src/build/slghparse.cc"
+    break;
+
+  case 316: /* paramlist: paramlist ',' expr  */
+#line 552 "parser-tools/slghparse.y"
+                                { (yyval.param) = (yyvsp[-2].param); (yyval.param)->push_back((yyvsp[0].tree)); }
+#line 3870 "src/build/slghparse.cc"
+    break;
+
+  case 317: /* oplist: %empty  */
+#line 554 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = new vector<string>; }
+#line 3876 "src/build/slghparse.cc"
+    break;
+
+  case 318: /* oplist: STRING  */
+#line 555 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = new vector<string>; (yyval.strlist)->push_back(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 3882 "src/build/slghparse.cc"
+    break;
+
+  case 319: /* oplist: oplist ',' STRING  */
+#line 556 "parser-tools/slghparse.y"
+                                { (yyval.strlist) = (yyvsp[-2].strlist); (yyval.strlist)->push_back(*(yyvsp[0].str)); delete (yyvsp[0].str); }
+#line 3888 "src/build/slghparse.cc"
+    break;
+
+  case 320: /* anysymbol: SPACESYM  */
+#line 558 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].spacesym); }
+#line 3894 "src/build/slghparse.cc"
+    break;
+
+  case 321: /* anysymbol: SECTIONSYM  */
+#line 559 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].sectionsym); }
+#line 3900 "src/build/slghparse.cc"
+    break;
+
+  case 322: /* anysymbol: TOKENSYM  */
+#line 560 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].tokensym); }
+#line 3906 "src/build/slghparse.cc"
+    break;
+
+  case 323: /* anysymbol: USEROPSYM  */
+#line 561 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].useropsym); }
+#line 3912 "src/build/slghparse.cc"
+    break;
+
+  case 324: /* anysymbol: MACROSYM  */
+#line 562 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].macrosym); }
+#line 3918 "src/build/slghparse.cc"
+    break;
+
+  case 325: /* anysymbol: SUBTABLESYM  */
+#line 563 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].subtablesym); }
+#line 3924 "src/build/slghparse.cc"
+    break;
+
+  case 326: /* anysymbol: VALUESYM  */
+#line 564 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].valuesym); }
+#line 3930 "src/build/slghparse.cc"
+    break;
+
+  case 327: /* anysymbol: VALUEMAPSYM  */
+#line 565 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].valuemapsym); }
+#line 3936 "src/build/slghparse.cc"
+    break;
+
+  case 328: /* anysymbol: CONTEXTSYM  */
+#line 566 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].contextsym); }
+#line 3942 "src/build/slghparse.cc"
+    break;
+
+  case 329: /* anysymbol: NAMESYM  */
+#line 567 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].namesym); }
+#line 3948 "src/build/slghparse.cc"
+    break;
+
+  case 330: /* anysymbol: VARSYM  */
+#line 568 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].varsym); }
+#line 3954 "src/build/slghparse.cc"
+    break;
+
+  case 331: /* anysymbol: VARLISTSYM  */
+#line 569 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].varlistsym); }
+#line 3960 "src/build/slghparse.cc"
+    break;
+
+  case 332: /* anysymbol: OPERANDSYM  */
+#line 570 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].operandsym); }
+#line 3966 "src/build/slghparse.cc"
+    break;
+
+  case 333: /* anysymbol: STARTSYM  */
+#line 571 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].startsym); }
+#line 3972 "src/build/slghparse.cc"
+    break;
+
+  case 334: /* anysymbol: ENDSYM  */
+#line 572 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].endsym); }
+#line 3978 "src/build/slghparse.cc"
+    break;
+
+  case 335: /* anysymbol: BITSYM  */
+#line 573 "parser-tools/slghparse.y"
+                                { (yyval.anysym) = (yyvsp[0].bitsym); }
+#line 3984 "src/build/slghparse.cc"
+    break;
+
+
+#line 3988 "src/build/slghparse.cc"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 575 "parser-tools/slghparse.y"
+
+
+int yyerror(const char *s)
+
+{
+  slgh->reportError(s,true);
+  return 0;
+}
@@ -21,30 +21,359 @@
 #include <algorithm>
 #include <iterator>
 #include <cstring>
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 /*****************************************************************************/
 // * Functions
 //
-// Returns to position of "byte" inside buffer "buf" of size "sz".
+// Returns to position of "byte" inside buffer "buf" of size "sz", or 0 once
+// there are no more. Passing a null "buf" carries on from the last match.
+// The search is a ByteScanner run over the buffer a window at a time, and
+// the place it has got to is kept per thread.
 // ex.
 //     for (auto [pos, buf] = pair{ 0, img };
 //     pos = bytePosition ("\xc3", buf, imgsize); buf = nullptr)
 uintmax_t bytePosition (string byte, uint1* buf, size_t sz)
 {
-    static uint1* sbufp = nullptr;
-    static uintmax_t spos = 0;  // i.e., s(aved)pos(ition)
+    struct Cursor {
+        const uint1* buf = nullptr;
+        size_t next = 0;        // Where the next window starts
+        size_t resume = 0;      // Just past the last match returned
+        uint1 byte = 0;
+        ByteScanner scanner;
+        vector<ByteMatch> found;
+        size_t foundpos = 0;
+    };
+    static thread_local Cursor cur;
+    const size_t WINDOW = 0x10000;
 
-    sbufp = (buf != nullptr) ? buf : sbufp;
-    spos = (buf != nullptr) ? 0 : spos;
+    if (buf != nullptr) {
+        cur.buf = buf;
+        cur.next = cur.resume = 0;
+        cur.found.clear ();
+        cur.foundpos = 0;
+    }
+    if (cur.buf == nullptr)
+        return 0;
+    if (buf != nullptr || (uint1)byte[0] != cur.byte) {
+        // A different byte searches on from the last match.
+        cur.byte = byte[0];
+        cur.scanner = ByteScanner ();
+        cur.scanner.addByte (cur.byte, 0);
+        cur.scanner.compile ();
+        cur.next = cur.resume;
+        cur.found.clear ();
+        cur.foundpos = 0;
+    }
+
+    while (cur.foundpos == cur.found.size ()) {
+        if (cur.next >= sz)
+            return 0;
+        size_t len = min (WINDOW, sz - cur.next);
+        cur.found.clear ();
+        cur.foundpos = 0;
+        cur.scanner.scan (cur.buf + cur.next, len, cur.found);
+        for (auto& m : cur.found)
+            m.offset += cur.next;
+        cur.next += len;
+    }
+    cur.resume = cur.found[cur.foundpos].offset + 1;
+    return cur.found[cur.foundpos++].offset;
+}
+
+/*****************************************************************************/
+// * ByteScanner
+//
+ByteScanner::ByteScanner () : byteids (256)
+{
+}
+
+bool ByteScanner::Pattern::matches (const uint1* p) const
+{
+    for (auto i = 0; i != bytes.size (); ++i)
+        if ((p[i] & mask[i]) != bytes[i])
+            return false;
+    return true;
+}
+
+void ByteScanner::addByte (uint1 byte, int4 id)
+{
+    addByteSet ({ byte }, id);
+}
 
-    for (; spos <= sz; ++spos) {
-        if (0 == memcmp((uint1*)byte.c_str(), &sbufp[spos], sizeof(uint1))) {
-            return spos++;      // Post increment side effect is important here.
+void ByteScanner::addByteSet (const vector<uint1>& set, int4 id)
+{
+    for (auto b : set) {
+        auto& ids = byteids[b];
+        if (find (ids.begin (), ids.end (), id) != ids.end ())
+            continue;
+        if (ids.empty ())
+            setbytes.push_back (b);
+        ids.push_back (id);
+    }
+    compiled = false;
+}
+
+void ByteScanner::addPattern (const vector<uint1>& bytes, int4 id)
+{
+    addPattern (bytes, vector<uint1> (bytes.size (), 0xff), id);
+}
+
+void ByteScanner::addPattern (const vector<uint1>& bytes,
+                              const vector<uint1>& mask, int4 id)
+{
+    if (bytes.size () != mask.size ())
+        throw LowlevelError ("ByteScanner: pattern and mask differ in length");
+
+    Pattern pat;
+    pat.mask = mask;
+    pat.id = id;
+    for (auto i = 0; i != bytes.size (); ++i)
+        pat.bytes.push_back (bytes[i] & mask[i]);
+
+    // Only fully specified bytes can be searched for directly.
+    for (int4 i = 0, run = 0; i != bytes.size (); ++i) {
+        run = (mask[i] == 0xff) ? run + 1 : 0;
+        if (run > pat.anchorlen) {
+            pat.anchorlen = run;
+            pat.anchor = i - run + 1;
         }
     }
+    if (pat.anchorlen == 0)
+        throw LowlevelError ("ByteScanner: pattern has no fixed bytes");
+
+    if (pat.bytes.size () == 1) {   // Just a byte
+        addByte (pat.bytes[0], id);
+        return;
+    }
+    patterns.push_back (move (pat));
+    compiled = false;
+}
 
+void ByteScanner::addSignature (const string& sig, int4 id)
+{
+    vector<uint1> bytes, mask;
+    istringstream s (sig);
+    string tok;
+    while (s >> tok) {
+        if (tok == "??") {
+            bytes.push_back (0);
+            mask.push_back (0);
+            continue;
+        }
+        size_t end = 0;
+        unsigned long val = 0;
+        try {
+            val = stoul (tok, &end, 16);
+        } catch (const logic_error&) {
+        }
+        if ((tok.size () != 2) || (end != 2))
+            throw LowlevelError ("ByteScanner: bad signature byte: " + tok);
+        bytes.push_back (val);
+        mask.push_back (0xff);
+    }
+    addPattern (bytes, mask, id);
+}
+
+void ByteScanner::compile ()
+{
+    delta.clear ();
+    output.clear ();
+    compiled = true;
+    if (patterns.size () <= DIRECT_PATTERNS)
+        return;
+
+    // Aho-Corasick over the anchor of every pattern. Failure links are folded
+    // into "delta" so a scan is a single table lookup per byte.
+    delta.assign (256, -1);
+    output.emplace_back ();
+    for (auto p = 0; p != patterns.size (); ++p) {
+        const Pattern& pat = patterns[p];
+        int4 state = 0;
+        for (auto i = 0; i != pat.anchorlen; ++i) {
+            uint1 b = pat.bytes[pat.anchor + i];
+            if (delta[state * 256 + b] < 0) {
+                delta[state * 256 + b] = output.size ();
+                delta.resize (delta.size () + 256, -1);
+                output.emplace_back ();
+            }
+            state = delta[state * 256 + b];
+        }
+        output[state].push_back (p);
+    }
+
+    vector<int4> fail (output.size (), 0);
+    deque<int4> queue;
+    for (auto b = 0; b != 256; ++b) {
+        int4& next = delta[b];
+        if (next < 0)
+            next = 0;
+        else
+            queue.push_back (next);
+    }
+    while (!queue.empty ()) {
+        int4 state = queue.front ();
+        queue.pop_front ();
+        const auto& inherited = output[fail[state]];
+        output[state].insert (output[state].end (), inherited.begin (),
+                              inherited.end ());
+        for (auto b = 0; b != 256; ++b) {
+            int4& next = delta[state * 256 + b];
+            int4 fallback = delta[fail[state] * 256 + b];
+            if (next < 0) {
+                next = fallback;
+            } else {
+                fail[next] = fallback;
+                queue.push_back (next);
+            }
+        }
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__ ((target ("avx2"))) static size_t
+findSetAvx2 (const uint1* buf, size_t size, const uint1* set, int4 nset,
+             vector<uintb>& hits)
+{
+    __m256i want[ByteScanner::MAX_SET_BYTES];
+    for (auto i = 0; i != nset; ++i)
+        want[i] = _mm256_set1_epi8 ((char)set[i]);
+    size_t pos = 0;
+    for (; pos + 32 <= size; pos += 32) {
+        __m256i v = _mm256_loadu_si256 ((const __m256i*)(buf + pos));
+        __m256i eq = _mm256_cmpeq_epi8 (v, want[0]);
+        for (auto i = 1; i < nset; ++i)
+            eq = _mm256_or_si256 (eq, _mm256_cmpeq_epi8 (v, want[i]));
+        for (uint4 m = _mm256_movemask_epi8 (eq); m != 0; m &= m - 1)
+            hits.push_back (pos + __builtin_ctz (m));
+    }
+    return pos;
+}
+
+__attribute__ ((target ("sse2"))) static size_t
+findSetSse2 (const uint1* buf, size_t size, const uint1* set, int4 nset,
+             vector<uintb>& hits)
+{
+    __m128i want[ByteScanner::MAX_SET_BYTES];
+    for (auto i = 0; i != nset; ++i)
+        want[i] = _mm_set1_epi8 ((char)set[i]);
+    size_t pos = 0;
+    for (; pos + 16 <= size; pos += 16) {
+        __m128i v = _mm_loadu_si128 ((const __m128i*)(buf + pos));
+        __m128i eq = _mm_cmpeq_epi8 (v, want[0]);
+        for (auto i = 1; i < nset; ++i)
+            eq = _mm_or_si128 (eq, _mm_cmpeq_epi8 (v, want[i]));
+        for (uint4 m = _mm_movemask_epi8 (eq); m != 0; m &= m - 1)
+            hits.push_back (pos + __builtin_ctz (m));
+    }
+    return pos;
+}
+
+// Offsets in "buf" of every byte in "set". Returns how far the vector loop
+// got, the tail is left to the caller.
+static size_t findSet (const uint1* buf, size_t size, const uint1* set,
+                       int4 nset, vector<uintb>& hits)
+{
+    static const bool avx2 = __builtin_cpu_supports ("avx2");
+    static const bool sse2 = __builtin_cpu_supports ("sse2");
+    if (avx2)
+        return findSetAvx2 (buf, size, set, nset, hits);
+    if (sse2)
+        return findSetSse2 (buf, size, set, nset, hits);
     return 0;
 }
+#else
+static size_t findSet (const uint1* buf, size_t size, const uint1* set,
+                       int4 nset, vector<uintb>& hits)
+{
+    return 0;
+}
+#endif
 
+void ByteScanner::scanSets (const uint1* buf, size_t size,
+                            vector<ByteMatch>& res) const
+{
+    vector<uintb> hits;
+    size_t pos = 0;
+    if (setbytes.size () <= MAX_SET_BYTES)
+        pos = findSet (buf, size, setbytes.data (), setbytes.size (), hits);
+    for (; pos < size; ++pos)
+        if (!byteids[buf[pos]].empty ())
+            hits.push_back (pos);
+    for (auto off : hits)
+        for (auto id : byteids[buf[off]])
+            res.push_back ({ off, id });
+}
+
+void ByteScanner::scanDirect (const uint1* buf, size_t size,
+                              vector<ByteMatch>& res) const
+{
+    for (const Pattern& pat : patterns) {
+        size_t len = pat.bytes.size ();
+        if (len > size)
+            continue;
+        // Look for the first byte of the anchor, then check the rest.
+        const uint1* anchor = pat.bytes.data () + pat.anchor;
+        const uint1* p = buf + pat.anchor;
+        const uint1* last = buf + (size - len) + pat.anchor;
+        while ((p <= last) &&
+               (p = (const uint1*)memchr (p, anchor[0], last - p + 1))) {
+            if ((memcmp (p, anchor, pat.anchorlen) == 0) &&
+                pat.matches (p - pat.anchor))
+                res.push_back ({ (uintb)(p - pat.anchor - buf), pat.id });
+            ++p;
+        }
+    }
+}
+
+void ByteScanner::scanAutomaton (const uint1* buf, size_t size,
+                                 vector<ByteMatch>& res) const
+{
+    int4 state = 0;
+    for (size_t pos = 0; pos != size; ++pos) {
+        state = delta[state * 256 + buf[pos]];
+        for (auto p : output[state]) {
+            const Pattern& pat = patterns[p];
+            // "pos" is the last byte of the anchor.
+            size_t anchorend = pat.anchor + pat.anchorlen;
+            if (pos + 1 < anchorend)
+                continue;
+            size_t start = pos + 1 - anchorend;
+            if ((start + pat.bytes.size () <= size) && pat.matches (buf + start))
+                res.push_back ({ start, pat.id });
+        }
+    }
+}
+
+size_t ByteScanner::scan (const uint1* buf, size_t size,
+                          vector<ByteMatch>& res) const
+{
+    if (!compiled)
+        throw LowlevelError ("ByteScanner: scan() before compile()");
+
+    size_t first = res.size ();
+    if (!setbytes.empty ())
+        scanSets (buf, size, res);
+    if (!patterns.empty ()) {
+        if (delta.empty ())
+            scanDirect (buf, size, res);
+        else
+            scanAutomaton (buf, size, res);
+    }
+    sort (res.begin () + first, res.end (),
+          [] (const ByteMatch& a, const ByteMatch& b) {
+              return (a.offset != b.offset) ? (a.offset < b.offset)
+                                            : (a.id < b.id);
+          });
+    return res.size () - first;
+}
 
 
 void printVarnodeData (ostream& s, VarnodeData* data)
@@ -56,8 +385,8 @@ void printVarnodeData (ostream& s, VarnodeData* data)
 
     const Translate* trans = data->space->getTrans ();
 
-    if (data->space->getName () == "register") {
-        s << trans->getRegisterName (data->space, data->offset, data->size);
+    if (data->space->getIndex () == trans->getRegisterSpaceIndex ()) {
+        s << trans->getRegisterNameView (data->space, data->offset, data->size);
     } else {
         data->space->printOffset (s, data->offset);
     }
@@ -101,19 +430,26 @@ static Element* findTag (string tag, Element* root) {
 void DefaultLoadImage::loadFill (uint1* ptr, int4 size,
                                  const Address& addr)
 {
-    auto start = addr.getOffset ();
-    auto max = baseaddr + (bufsize - 1);
-    for (auto i = 0; i < size; ++i) { // For every byte request
-        auto curoff = start + i;      // Calculate offset of byte.
-        if ((curoff < this->baseaddr) ||
-            (curoff > max)) { // if byte does not fall in window,
-            ptr[i] = 0;       // return 0
-            continue;
-        }
-        // Otherwise return data from our window.
-        auto diff = curoff - baseaddr;
-        ptr[i] = this->buf[(int4)diff];
+    uintb start = addr.getOffset ();
+    // Bytes outside of the window read as 0.
+    if ((start < baseaddr) || (start - baseaddr >= bufsize)) {
+        memset (ptr, 0, size);
+        return;
     }
+    uintb off = start - baseaddr;
+    uintb avail = min<uintb> (size, bufsize - off);
+    memcpy (ptr, buf + off, avail);
+    memset (ptr + avail, 0, size - avail);
+}
+
+const uint1* DefaultLoadImage::getDirect (const Address& addr,
+                                          int4 size) const
+{
+    uintb start = addr.getOffset ();
+    if ((start < baseaddr) || (start - baseaddr >= bufsize) ||
+        (bufsize - (start - baseaddr) < size))
+        return nullptr;
+    return buf + (start - baseaddr);
 }
 
 void DefaultLoadImage::adjustVma (long adjust)
@@ -121,6 +457,40 @@ void DefaultLoadImage::adjustVma (long adjust)
     // TODO
 }
 
+/*****************************************************************************/
+// * MappedLoadImage
+//
+MappedLoadImage::MappedLoadImage (const string& path, uintb baseaddr) :
+    DefaultLoadImage (baseaddr, nullptr, 0)
+{
+    this->filename = path;
+    int fd = open (path.c_str (), O_RDONLY);
+    if (fd < 0)
+        throw LowlevelError ("Unable to open image: " + path);
+    struct stat st;
+    if (fstat (fd, &st) < 0) {
+        close (fd);
+        throw LowlevelError ("Unable to stat image: " + path);
+    }
+    if (st.st_size != 0) {  // Zero length mappings are not allowed
+        void* map = mmap (nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            close (fd);
+            throw LowlevelError ("Unable to map image: " + path);
+        }
+        this->buf = (const uint1*)map;
+        this->bufsize = st.st_size;
+    }
+    // The mapping keeps the file alive on its own.
+    close (fd);
+}
+
+MappedLoadImage::~MappedLoadImage ()
+{
+    if (this->buf != nullptr)
+        munmap ((void*)this->buf, this->bufsize);
+}
+
 /*****************************************************************************/
 // * Hutch
 //
@@ -130,26 +500,118 @@ Hutch::Hutch (int4 arch, const uint1* buf, uintb bufsize)
     this->initialize (buf, bufsize, 0x00000000);
 }
 
+Hutch::Hutch (int4 arch, const string& path)
+{
+    this->preconfigure (arch);
+    this->initialize (path, 0x00000000);
+}
+
 void Hutch::initialize (const uint1* buf, uintb bufsize, uintb begaddr)
 {
     this->loader = make_unique<DefaultLoadImage>(begaddr, buf, bufsize);
+    setupTranslator ();
+}
+
+void Hutch::initialize (const string& path, uintb begaddr)
+{
+    this->loader = make_unique<MappedLoadImage> (path, begaddr);
+    setupTranslator ();
+}
+
+void Hutch::setupTranslator ()
+{
     this->trans = make_unique<Sleigh>(this->loader.get(), &this->context);
-    this->trans->initialize (this->docstorage);
+    if (this->docstorage.getTag ("sleigh") != nullptr) {
+        // Decision trees and p-code templates are restored the first time an
+        // instruction reaches them, straight from the packed elements.
+        this->trans->setLazyRestore (true);
+        this->trans->initialize (this->docstorage);
+    } else {
+        // A text specification is restored as it is parsed.
+        ifstream s (this->docname.c_str ());
+        if (!s)
+            throw LowlevelError ("Unable to open " + this->docname);
+        this->trans->initialize (s);
+    }
 
     for (auto [option, setting] : this->cpucontext)
         this->context.setVariableDefault (option, setting);
 }
 
-int4 Hutch::instructionLength (const uintb addr)
+// 64-bit FNV-1a of "size" bytes at "buf", continuing from "hash".
+static uint8 hashBytes (const uint1* buf, uintb size,
+                        uint8 hash = 0xcbf29ce484222325ULL)
 {
-    return trans->instructionLength(Address (trans->getDefaultSpace(),
-                                             this->loader->getBaseAddr() + addr));
+    for (uintb i = 0; i < size; ++i)
+        hash = (hash ^ buf[i]) * 0x100000001b3ULL;
+    return hash;
 }
 
-void Hutch::storeRawInstructionBytes (const Instruction& insn)
+// Hash of the file at "path" by name, size and modification time, so it is
+// never read.
+static uint8 hashFileStat (const string& path, uint8 hash)
 {
-    trans->getInstructionBytes( Address (trans->getDefaultSpace(), insn.address), insn.raw);
-    return;
+    struct stat st;
+    if (stat (path.c_str (), &st) != 0)
+        throw LowlevelError ("Unable to stat " + path);
+    hash = hashBytes ((const uint1*)path.data (), path.size (), hash);
+    hash = hashBytes ((const uint1*)&st.st_size, sizeof (st.st_size), hash);
+    return hashBytes ((const uint1*)&st.st_mtim, sizeof (st.st_mtim), hash);
+}
+
+// Hash of the size and of evenly spaced windows of "size" bytes at "buf".
+static uint8 hashSampled (const uint1* buf, uintb size, uint8 hash)
+{
+    const uintb WINDOWS = 64, WINDOW = 64;
+    hash = hashBytes ((const uint1*)&size, sizeof (size), hash);
+    if (size <= WINDOWS * WINDOW)
+        return hashBytes (buf, size, hash);
+    uintb stride = (size - WINDOW) / (WINDOWS - 1);
+    for (uintb i = 0; i < WINDOWS; ++i)
+        hash = hashBytes (buf + i * stride, WINDOW, hash);
+    return hash;
+}
+
+int4 Hutch::useDecodeCache (const string& path)
+{
+    // Neither file is read here. The specification is known by its file's
+    // name, size and mtime. The key need not prove the image unchanged, as
+    // every hit is checked against the bytes at its address before it is
+    // used, so a mapped image is known by its file the same way and an image
+    // in memory by a sample of its bytes.
+    uintb baseaddr = this->loader->getBaseAddr ();
+    uint8 key = hashFileStat (this->docname, 0xcbf29ce484222325ULL);
+    if (dynamic_cast<MappedLoadImage*> (this->loader.get ()) != nullptr)
+        key = hashFileStat (this->loader->getFileName (), key);
+    else
+        key = hashSampled (this->loader->getBuffer (),
+                           this->loader->getBufferSize (), key);
+    key = hashBytes ((const uint1*)&baseaddr, sizeof (baseaddr), key);
+
+    // Room for about one entry per byte of image, within reason.
+    int4 slots = 4096;
+    while ((slots < (1 << 24)) && (slots < this->loader->getBufferSize ()))
+        slots <<= 1;
+
+    this->decodecache = make_unique<SharedDecodeCache> (slots);
+    this->decodecachepath = path;
+    this->decodecachekey = key;
+    this->trans->setSharedCache (this->decodecache.get ());
+    return max (this->decodecache->loadFile (path, key, this->trans.get ()), 0);
+}
+
+int4 Hutch::saveDecodeCache ()
+{
+    if (!this->decodecache)
+        return 0;
+    return this->decodecache->saveFile (this->decodecachepath,
+                                        this->decodecachekey);
+}
+
+int4 Hutch::instructionLength (const uintb addr)
+{
+    return trans->instructionLength(Address (trans->getDefaultSpace(),
+                                             this->loader->getBaseAddr() + addr));
 }
 
 void Hutch::printInstructionBytes (const Instruction& insn)
@@ -161,7 +623,7 @@ void Hutch::printInstructionBytes (const Instruction& insn)
     return;
 }
 
-void Hutch::printInstructionBytes (vector<Instruction>::iterator instr)
+void Hutch::printInstructionBytes (Hutch_Instructions::iterator instr)
 {
     for (auto i = 0; i < instr->bytelength; ++i) {
         cout << "0x" << hex << (int)instr->raw[i] << " ";
@@ -186,63 +648,313 @@ uint Hutch::disassemble_iter(uintb offset, Hutch_Emit* emitter)
         // cout << "exceeded last available address\n";
         return 0;
     }
-    auto len = 0;
+    try {
+        this->trans->decodeInstruction (this->decoded, addr);
+    } catch (const BadDataError&) {
+        return 0;
+    } catch (const UnimplError&) {
+        // Decodes, but without pcode semantics. Skipped like bad data, as
+        // disassemble_parallel() and decodeCached() do too.
+        return 0;
+    }
+    emitter->dumpInstruction (addr, this->decoded);
 
+    return this->decoded.length;
+}
+
+/*****************************************************************************/
+// * Parallel sweep
+//
+// One chunk of the image as decoded by a disassemble_parallel() worker.
+struct SweepRange {
+    uintb start;                // First address to decode
+    uintb end;                  // Decoding stops at the first address >= end
+    uintb stop = 0;             // Address the worker actually stopped at
+    vector<Instruction> insns;
+    PcodeArena arena;
+    exception_ptr error;
+};
+
+// Decode one instruction at "addr" into "out". Returns how far a linear sweep
+// should advance, i.e. 1 for bytes that do not decode. Instructions without
+// pcode semantics are skipped the same way, as disassemble_iter() does.
+static uintb sweepOne (SleighDecoder& decoder, InstructionRecord& rec,
+                       const Address& addr, vector<Instruction>& out,
+                       PcodeArena& arena)
+{
     try {
-        len = this->trans->printAssembly(*emitter, addr);
-        this->trans->oneInstruction(*emitter, addr);
+        decoder.decodeInstruction (rec, addr);
     } catch (const BadDataError&) {
-        len = 0;
-        emitter->removeBadInstruction ();
+        return 1;
+    } catch (const UnimplError&) {
+        return 1;
     }
+    out.emplace_back ();
+    Instruction& instr = out.back ();
+    instr.address = addr.getOffset ();
+    instr.bytelength = rec.length;
+    instr.assembly = rec.mnem + " " + rec.body;
+    instr.pcode = arena.store (rec.pcode);
+    memcpy (instr.raw, rec.bytes, rec.length);
+    return rec.length;
+}
 
-    if (auto e = dynamic_cast<Hutch_Instructions*>(emitter))
-        storeRawInstructionBytes(*e->currentinsn);
+static void sweepRange (const SleighBase* spec, LoadImage* loader,
+                        const vector<pair<string, int4>>& cpucontext,
+                        SharedDecodeCache* shared, SweepRange& range)
+{
+    try {
+        // Context commits write to the database, so each worker needs its own.
+        ContextInternal context;
+        spec->registerContextFields (&context);
+        for (auto [option, setting] : cpucontext)
+            context.setVariableDefault (option, setting);
 
-    return len;
+        SleighDecoder decoder (spec, loader, &context);
+        decoder.setSharedCache (shared);
+        InstructionRecord rec;
+        AddrSpace* spc = spec->getDefaultSpace ();
+        uintb addr = range.start;
+        while (addr < range.end)
+            addr += sweepOne (decoder, rec, Address (spc, addr), range.insns,
+                              range.arena);
+        range.stop = addr;
+    } catch (...) {
+        range.error = current_exception ();
+    }
 }
 
-vector<Instruction>
-Hutch::inspectPreviousInstruction (uintb offset, uintb limit,
-                                   Hutch_Instructions& insn,
+uintb Hutch::disassemble_parallel (Hutch_Instructions& insn, uint4 nthreads)
+{
+    // Below this a worker costs more than it saves.
+    const uintb MIN_RANGE = 0x10000;
+
+    uintb baseaddr = this->loader->getBaseAddr ();
+    uintb bufsize = this->loader->getBufferSize ();
+    if (bufsize == 0)
+        return 0;
+
+    if (nthreads == 0)
+        nthreads = max (thread::hardware_concurrency (), 1u);
+    nthreads = min<uintb> (nthreads, max<uintb> (bufsize / MIN_RANGE, 1));
+
+    vector<SweepRange> ranges (nthreads);
+    uintb chunk = (bufsize + nthreads - 1) / nthreads;
+    for (auto i = 0; i != nthreads; ++i) {
+        ranges[i].start = baseaddr + min (bufsize, i * chunk);
+        ranges[i].end = baseaddr + min (bufsize, (i + 1) * chunk);
+    }
+
+    vector<thread> workers;
+    for (auto& range : ranges)
+        workers.emplace_back (sweepRange, this->trans.get (),
+                              this->loader.get (), cref (this->cpucontext),
+                              this->decodecache.get (), ref (range));
+    for (auto& w : workers)
+        w.join ();
+    for (auto& range : ranges)
+        if (range.error)
+            rethrow_exception (range.error);
+
+    // Stitch the ranges together. A range boundary can fall inside an
+    // instruction, so each range is re-decoded serially from where the
+    // previous one really ended until it lines up with an instruction the
+    // worker found. From that point on the worker's sweep is the serial one.
+    SleighDecoder decoder (this->trans.get (), this->loader.get (),
+                           &this->context);
+    decoder.setSharedCache (this->decodecache.get ());
+    InstructionRecord rec;
+    AddrSpace* spc = this->trans->getDefaultSpace ();
+    vector<Instruction> resync;
+    uintb count = 0;
+
+    auto adopt = [&] (const Instruction& instr) {
+        auto [handle, isnew] = insn.instructions.insert (instr.address);
+        if (isnew)
+            insn.instructions[handle] = instr;
+        insn.currentinsn = handle;
+        ++count;
+    };
+
+    uintb next = baseaddr;
+    for (auto& range : ranges) {
+        insn.arena.absorb (range.arena);
+        auto it = range.insns.begin ();
+        while (next < range.stop) {
+            while ((it != range.insns.end ()) && (it->address < next))
+                ++it;
+            if ((it != range.insns.end ()) && (it->address == next)) {
+                for (; it != range.insns.end (); ++it)
+                    adopt (*it);
+                next = range.stop;
+                break;
+            }
+            next += sweepOne (decoder, rec, Address (spc, next), resync,
+                              insn.arena);
+            for (auto& r : resync)
+                adopt (r);
+            resync.clear ();
+        }
+    }
+    return count;
+}
+
+// True if control always reaches the next instruction after "instr".
+// Branches to constant space are pcode relative and stay inside it.
+static bool fallsThrough (const Instruction& instr)
+{
+    for (auto& p : instr.pcode) {
+        switch (p.opc) {
+        case CPUI_BRANCH:
+        case CPUI_CBRANCH:
+            if (p.invar[0].space->getType () == IPTR_CONSTANT)
+                break;
+            return false;
+        case CPUI_BRANCHIND:
+        case CPUI_CALL:
+        case CPUI_CALLIND:
+        case CPUI_RETURN:
+            return false;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+static bool selects (const Instruction& instr, bool (*select) (PcodeData))
+{
+    if (select == nullptr)
+        return true;
+    for (auto p : instr.pcode)
+        if (select (p))
+            return true;
+    return false;
+}
+
+uint1 Hutch::decodeCached (uintb offset, Hutch_Instructions& insn)
+{
+    DecodeMap& map = insn.decodemap;
+    if (map.empty ())
+        map.reset (this->loader->getBufferSize ());
+    if (offset >= map.size ())
+        return DecodeMap::INVALID;
+    uint1& flags = map.flags (offset);
+    if (flags != DecodeMap::UNKNOWN)
+        return flags;
+
+    // Nothing can be said about an instruction without pcode semantics, so
+    // like bad data it is INVALID; disassemble_iter() skips both.
+    uint1 res = DecodeMap::INVALID;
+    if (disassemble_iter (offset, &insn) != 0) {
+        Instruction& instr = insn.instructions[insn.currentinsn];
+        map.length (offset) = instr.bytelength;
+        map.handle (offset) = insn.currentinsn;
+        res = DecodeMap::VALID;
+        if (fallsThrough (instr))
+            res |= DecodeMap::FALLTHRU;
+    }
+    flags = res;
+    return res;
+}
+
+uint2 Hutch::predecessors (uintb offset, Hutch_Instructions& insn)
+{
+    if ((decodeCached (offset, insn) & DecodeMap::VALID) == 0)
+        return 0;
+    DecodeMap& map = insn.decodemap;
+    if (map.flags (offset) & DecodeMap::PREDS)
+        return map.preds (offset);
+
+    uint2 mask = 0;
+    for (uintb k = 1; (k <= DecodeMap::MAX_BACK) && (k <= offset); ++k) {
+        uint1 f = decodeCached (offset - k, insn);
+        if ((f & DecodeMap::FALLTHRU) && (map.length (offset - k) == k))
+            mask |= (1 << k);
+    }
+    map.preds (offset) = mask;
+    map.flags (offset) |= DecodeMap::PREDS;
+    return mask;
+}
+
+vector<GadgetView> Hutch::gadgets (const vector<uintb>& ends, uintb limit,
+                                   uint4 depth, Hutch_Instructions& insn,
                                    bool (*select) (PcodeData))
 {
-    vector<Instruction> res;
-
-    resetMark (offset, insn);
-    if (insn.getMark ()->address - 1 == 0)
-        return {};
-
-    for (auto r = 1; (r != limit) && ((offset - r) > 0) &&
-                     disassemble_iter (offset - r, &insn);
-         ++r)
-        ;
-    for (auto rinsn = insn.getMark () - 1; rinsn != insn.current (); --rinsn) {
-        // For ROP:
-        // Need to determine whether the instruction ends immediately prior to
-        // the marked/c3(ret) instruction for instruction to be useful.
-        if (select == nullptr) {
-            if ((rinsn->address + rinsn->bytelength) ==
-                insn.getMark ()->address)
-                res.push_back (*rinsn);
+    vector<GadgetView> res;
+    DecodeMap& map = insn.decodemap;
+
+    uintb baseaddr = this->loader->getBaseAddr ();
+    vector<GadgetView> level, next;
+
+    for (auto end : ends) {
+        if ((depth < 2) || (predecessors (end, insn) == 0))
             continue;
-        }
-        // Only add those instructions that meet the alignment requirement
-        // described above AND satisfy whatever condition the fptr "select" imposes.
-        if (bool isSelected = false;
-            (rinsn->address + rinsn->bytelength) == insn.getMark ()->address) {
-            for (auto p : rinsn->pcode) {
-                isSelected = select (p);
-                if (isSelected) {
-                    res.push_back (*rinsn);
-                    break;
+        // Breadth first, so every chain is one instruction longer than the
+        // chain it was grown from and listed after it.
+        GadgetView tail;
+        tail.insn = &insn;
+        tail.first = insn.chains.size ();
+        tail.count = 1;
+        insn.chains.push_back (map.handle (end));
+        level.assign (1, tail);
+
+        for (uint4 len = 2; (len <= depth) && !level.empty (); ++len) {
+            next.clear ();
+            for (auto& chain : level) {
+                uintb head = chain.address () - baseaddr;
+                uint2 mask = predecessors (head, insn);
+                for (uintb k = 1; k <= DecodeMap::MAX_BACK; ++k) {
+                    if ((mask & (1 << k)) == 0)
+                        continue;
+                    uintb start = head - k;
+                    if ((end - start >= limit) ||
+                        !selects (insn.instructions[map.handle (start)],
+                                  select))
+                        continue;
+                    GadgetView longer = chain;
+                    longer.first = insn.chains.size ();
+                    longer.count = chain.count + 1;
+                    insn.chains.reserve (longer.first + longer.count);
+                    insn.chains.push_back (map.handle (start));
+                    for (auto j = 0; j != chain.count; ++j)
+                        insn.chains.push_back (insn.chains[chain.first + j]);
+                    next.push_back (longer);
                 }
             }
+            res.insert (res.end (), next.begin (), next.end ());
+            swap (level, next);
         }
     }
     return res;
 }
 
+vector<InstructionStore::Handle>
+Hutch::inspectPreviousInstruction (uintb offset, uintb limit,
+                                   Hutch_Instructions& insn,
+                                   bool (*select) (PcodeData))
+{
+    vector<InstructionStore::Handle> res;
+
+    uint2 mask = predecessors (offset, insn);
+    if (decodeCached (offset, insn) & DecodeMap::VALID)
+        insn.mark = insn.decodemap.handle (offset);
+
+    // For ROP:
+    // Only instructions that end immediately prior to the marked/c3(ret)
+    // instruction are useful, nearest first. Whatever condition the fptr
+    // "select" imposes has to hold as well.
+    for (uintb k = 1; (k < limit) && (k <= DecodeMap::MAX_BACK) && (k <= offset);
+         ++k) {
+        if ((mask & (1 << k)) == 0)
+            continue;
+        InstructionStore::Handle h = insn.decodemap.handle (offset - k);
+        if (selects (insn.instructions[h], select))
+            res.push_back (h);
+    }
+    return res;
+}
+
 void Hutch::preconfigure (int4 cpu_arch)
 {
     this->arch = cpu_arch;
@@ -258,8 +970,10 @@ void Hutch::preconfigure (int4 cpu_arch)
         break;
     }
 
-    Element* ast_root = docstorage.openDocument (this->docname)->getRoot ();
-    docstorage.registerTag (ast_root);
+    // Only a packed specification is kept in docstorage, see setupTranslator().
+    Document* doc = docstorage.openPackedDocument (this->docname);
+    if (doc != nullptr)
+        docstorage.registerTag (doc->getRoot ());
 }
 
 /*****************************************************************************/
@@ -291,6 +1005,17 @@ void Hutch_Emit::dumpAsm (const Address& addr, const string& mnem,
     cout << mnem << ' ' << body << endl;
 }
 
+/*****************************************************************************/
+// * Hutch_Emit
+//
+void Hutch_Emit::dumpInstruction (const Address& addr,
+                                  const InstructionRecord& rec)
+{
+    dumpAsm (addr, rec.mnem, rec.body);
+    for (auto& p : rec.pcode)
+        dumpPcode (addr, p.opc, p.outvar, p.invar, p.isize);
+}
+
 /*****************************************************************************/
 // * Hutch_Instructions
 //
@@ -298,9 +1023,7 @@ void Hutch_Instructions::dumpPcode (Address const& addr, OpCode opc,
                                     VarnodeData* outvar, VarnodeData* vars,
                                     int4 isize)
 {
-    PcodeData pcode (opc, outvar, vars, isize);
-    pcode.store(outvar, vars);
-    storeInstruction(addr, pcode);
+    storeInstruction(addr, PcodeData (opc, outvar, vars, isize));
 }
 
 void Hutch_Instructions::dumpAsm (const Address& addr, const string& mnem,
@@ -310,138 +1033,180 @@ void Hutch_Instructions::dumpAsm (const Address& addr, const string& mnem,
     storeInstruction(addr, assembly);
 }
 
-auto Hutch_Instructions::current () -> vector<Instruction>::iterator
+void Hutch_Instructions::dumpInstruction (const Address& addr,
+                                          const InstructionRecord& rec)
+{
+    auto [handle, isnew] = instructions.insert (addr.getOffset ());
+    this->currentinsn = handle;
+    if (!isnew)
+        return;
+
+    Instruction& instr = instructions[handle];
+    instr.bytelength = rec.length;
+    instr.assembly = rec.mnem + " " + rec.body;
+    instr.pcode = arena.store (rec.pcode);
+    memcpy (instr.raw, rec.bytes, rec.length);
+}
+
+auto Hutch_Instructions::current () -> iterator
 {
-    return instructions.begin() + distance(instructions.data(), currentinsn);
+    return instructions.at (currentinsn);
+}
+
+auto Hutch_Instructions::getMark () -> iterator
+{
+    return instructions.at (mark);
 }
 
 void Hutch_Instructions::storeInstruction (Address const& addr, any insn)
 {
-    auto len = addr.getSpace ()->getTrans ()->instructionLength (addr);
-
-    // Keep track of vector relocations for Hutch_Instructions::mark.
-    auto ofront = (!instructions.empty ()) ? instructions.data () : 0;
-    auto oback = (!instructions.empty ()) ?
-                     instructions.data () + instructions.size () - 1 :
-                     0;
-    size_t fdiff, bdiff;
-
-    // Do not need to track very initial run (when instructions.empty ())
-    if (instructions.empty ()) {
-        Instruction instr;
-        instr.bytelength = len;
-        instr.address = addr.getOffset ();
-        if (insn.type () == typeid (string)) {
+    auto [handle, isnew] = instructions.insert (addr.getOffset ());
+    Instruction& instr = instructions[handle];
+    this->currentinsn = handle;
+
+    if (isnew)
+        instr.bytelength =
+            addr.getSpace ()->getTrans ()->instructionLength (addr);
+
+    if (insn.type () == typeid (string)) {
+        if (instr.assembly == "")
             instr.assembly = any_cast<string> (insn);
-        }
-        if (insn.type () == typeid (PcodeData)) {
-            instr.pcode.push_back (any_cast<PcodeData> (insn));
-        }
-        instructions.push_back (instr);
-        this->currentinsn = &instructions.back ();
-        return;
-    } else if ((insn.type () == typeid (PcodeData)) and
-               (instructions.front ().pcode.empty ())) {
-        instructions.front ().pcode.push_back (any_cast<PcodeData> (insn));
-        instructions.front ().bytelength = len;
-        this->currentinsn = &instructions.front ();
-
-        // Move mark if vector instructions has moved.
-        fdiff = instructions.data () - ofront;
-        bdiff = (instructions.data () + instructions.size () - 1) - oback;
-        mark = (mark != nullptr) ?
-                     (fdiff != 0) || (bdiff != 0) ?
-                     (fdiff > bdiff) ? mark + fdiff : mark + bdiff :
-                     mark :
-                     nullptr;
         return;
     }
+    if (insn.type () == typeid (PcodeData)) {
+        auto& pcode = any_cast<PcodeData&> (insn);
+        // Re-decoding an address emits the same pcode again.
+        if (find (instr.pcode.begin (), instr.pcode.end (), pcode) ==
+            instr.pcode.end ())
+            arena.append (instr.pcode, pcode);
+    }
+}
 
-    for (auto i = 0; i != instructions.size (); ++i) {
-        if ((instructions[i].address == addr.getOffset ()) and
-            (insn.type () == typeid (string))) {
-            if (instructions[i].assembly == any_cast<string> (insn)) {
-                this->currentinsn = &instructions[i];
-                return;
-            }
-            if (instructions[i].assembly == "") {
-                instructions[i].assembly = any_cast<string> (insn);
-                instructions[i].bytelength = len;
-                this->currentinsn = &instructions[i];
-                return;
-            }
-        }
-        if ((instructions[i].address == addr.getOffset ()) and
-            (insn.type () == typeid (PcodeData))) {
-            auto pcode = any_cast<PcodeData> (insn);
-            if (find (instructions[i].pcode.begin (),
-                      instructions[i].pcode.end (),
-                      pcode) != instructions[i].pcode.end ()) {
-                pcode.release ();
-                this->currentinsn = &instructions[i];
-                return;
-            } else {
-                instructions[i].pcode.push_back (any_cast<PcodeData> (insn));
-                instructions[i].bytelength = len;
-                this->currentinsn = &instructions[i];
-                // Move mark if vector instructions has moved.
-                fdiff = instructions.data () - ofront;
-                bdiff =
-                    (instructions.data () + instructions.size () - 1) - oback;
-                mark = (mark != nullptr) ?
-                             (fdiff != 0) || (bdiff != 0) ?
-                             (fdiff > bdiff) ? mark + fdiff : mark + bdiff :
-                             mark :
-                             nullptr;
-                return;
-            }
-        }
+void Hutch_Instructions::clear ()
+{
+    instructions.clear ();
+    arena.release ();
+    decodemap.clear ();
+    chains.clear ();
+    currentinsn = mark = InstructionStore::invalid;
+}
+
+/*****************************************************************************/
+// * GadgetView
+//
+Instruction& GadgetView::operator[] (uint4 i) const
+{
+    return insn->instructions[insn->chains[first + i]];
+}
+
+/*****************************************************************************/
+// * PcodeArena
+//
+void PcodeArena::copyOp (PcodeData& dst, const PcodeData& op)
+{
+    // Output and inputs share one allocation.
+    auto nvars = op.isize + ((op.outvar != nullptr) ? 1 : 0);
+    VarnodeData* vars = varnodes.allocate (nvars);
+
+    dst.opc = op.opc;
+    dst.isize = op.isize;
+    dst.invar = vars;
+    for (auto i = 0; i < op.isize; ++i)
+        vars[i] = op.invar[i];
+    if (op.outvar != nullptr) {
+        dst.outvar = vars + op.isize;
+        *dst.outvar = *op.outvar;
+    } else {
+        dst.outvar = nullptr;
     }
+}
 
-    Instruction instr;
+PcodeSpan PcodeArena::store (const vector<PcodeData>& pcode)
+{
+    PcodeSpan span;
+    if (pcode.empty ())
+        return span;
+    span.ops = ops.allocate (pcode.size ());
+    span.count = pcode.size ();
+    for (auto i = 0; i != pcode.size (); ++i)
+        copyOp (span.ops[i], pcode[i]);
+    return span;
+}
 
-    instr.address = addr.getOffset ();
-    instr.bytelength = len;
-
-    if (insn.type () == typeid (string))
-        instr.assembly = any_cast<string> (insn);
-    if (insn.type () == typeid (PcodeData))
-        instr.pcode.push_back (any_cast<PcodeData> (insn));
-
-    auto index = distance (
-        instructions.begin (),
-        lower_bound (instructions.begin (), instructions.end (),
-                     addr.getOffset (),
-                     [](const Instruction& lhs, const uintb& rhs) -> bool {
-                         return lhs.address < rhs;
-                     }));
-
-    if (instructions[index].address != addr.getOffset ()) {
-        instructions.insert (instructions.begin () + index, instr);
-        if (index > 0)
-            this->currentinsn = &instructions[index - 1];
-        else
-            this->currentinsn = &instructions[index];
-        // Move mark if vector instructions has moved.
-        fdiff = instructions.data () - ofront;
-        bdiff = (instructions.data () + instructions.size () - 1) - oback;
-        mark = (mark != nullptr) ?
-                     (fdiff != 0) || (bdiff != 0) ?
-                     (fdiff > bdiff) ? mark + fdiff : mark + bdiff :
-                     mark :
-                     nullptr;
-        return;
+void PcodeArena::append (PcodeSpan& span, const PcodeData& op)
+{
+    if ((span.ops == nullptr) || !ops.extend (span.end (), 1)) {
+        // Not at the end of the slab anymore, relocate the span. The old
+        // copy is reclaimed when the arena is released.
+        PcodeData* moved = ops.allocate (span.count + 1);
+        copy (span.begin (), span.end (), moved);
+        span.ops = moved;
+    }
+    copyOp (span.ops[span.count++], op);
+}
+
+/*****************************************************************************/
+// * InstructionStore
+//
+bool InstructionStore::search (uintb address, uint4& chunk, uint4& pos) const
+{
+    // The first chunk not wholly below "address", or past the last one.
+    auto c = lower_bound (index.begin (), index.end (), address,
+                          [] (const Chunk& ch, uintb a) {
+                              return ch.back ().address < a;
+                          });
+    if (c == index.end ()) {
+        chunk = index.size ();
+        pos = 0;
+        return false;
     }
-    this->currentinsn = &instructions[index];
+    auto e = lower_bound (c->begin (), c->end (), address,
+                          [] (const Entry& en, uintb a) {
+                              return en.address < a;
+                          });
+    chunk = c - index.begin ();
+    pos = e - c->begin ();
+    return (e->address == address);
 }
 
-void Hutch_Instructions::removeBadInstruction ()
+auto InstructionStore::insert (uintb address) -> pair<Handle, bool>
 {
-    auto after = instructions.erase(current());
-    auto index = distance(instructions.begin(), after);
-    if (after == instructions.end()) {
-        currentinsn = instructions.data() + index - 1;
+    Handle h = storage.size ();
+    // Linear sweeps only ever append, so skip the search in that case.
+    if (index.empty () || (index.back ().back ().address < address)) {
+        if (index.empty () || (index.back ().size () >= CHUNK)) {
+            index.emplace_back ();
+            index.back ().reserve (CHUNK);
+        }
+        index.back ().push_back ({ address, h });
     } else {
-        currentinsn = instructions.data() + index;
+        uint4 c, pos;
+        if (search (address, c, pos))
+            return { index[c][pos].handle, false };
+        Chunk& chunk = index[c];
+        chunk.insert (chunk.begin () + pos, { address, h });
+        if (chunk.size () > CHUNK) {
+            // Split in half, leaving room in both for more inserts.
+            Chunk upper (chunk.begin () + CHUNK / 2, chunk.end ());
+            chunk.resize (CHUNK / 2);
+            index.insert (index.begin () + c + 1, move (upper));
+        }
     }
+    storage.emplace_back ();
+    storage.back ().address = address;
+    return { h, true };
+}
+
+auto InstructionStore::find (uintb address) const -> Handle
+{
+    uint4 c, pos;
+    return search (address, c, pos) ? index[c][pos].handle : invalid;
+}
+
+auto InstructionStore::at (Handle h) -> iterator
+{
+    uint4 c, pos;
+    if ((h == invalid) || !search (storage[h].address, c, pos))
+        return end ();
+    return iterator (this, c, pos);
 }
@@ -0,0 +1,246 @@
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include "hutch.hpp"
+#include "emulatejit.hh"
+
+// Checks EmulateJit against the interpreter in differential mode: every
+// instruction is compiled on first use, and each one compiled entirely inline
+// is run both ways and compared. Register and unique space live in flat banks,
+// so their ops take the inline paths.
+//
+// First a table of synthetic shift instructions covers the counts the host
+// shifts would mask (0, width-1, width, 64, past 64), with the count both in a
+// register and constant, and the results are also checked against the p-code
+// definition. Then, if an image is given, it is run until the step limit, an
+// unhooked userop or an undecodable instruction. Anything else, including a
+// difference, fails the test.
+
+static const uintb REGSIZE = 0x10000;
+static const uintb UNIQSIZE = 0x100000;
+
+static const uintb VALUE_REG = 0x8000;
+static const uintb COUNT_REG = 0x8008;
+static const uintb RESULT_REG = 0x9000;
+
+struct ShiftCase {
+    OpCode opc;
+    int4 size;
+    uintb value;
+    uintb count;
+    bool constcount;
+};
+
+// A translator whose instruction at offset 4*i runs shift case i:
+//   VALUE_REG = COPY value
+//   COUNT_REG = COPY count
+//   unique    = <shift> VALUE_REG, COUNT_REG (or the count as a constant)
+//   RESULT_REG + 8*i = COPY unique
+// and every instruction past the table is empty.
+class ShiftTranslate : public Sleigh {
+public:
+    vector<ShiftCase> cases;
+    ShiftTranslate (LoadImage* ld, ContextDatabase* c_db) : Sleigh (ld, c_db) {}
+    virtual int4 oneInstruction (PcodeEmit& emit, const Address& baseaddr) const override;
+};
+
+int4 ShiftTranslate::oneInstruction (PcodeEmit& emit, const Address& baseaddr) const
+{
+    uintb index = baseaddr.getOffset () / 4;
+    if (index >= cases.size ())
+        return 4;               // Past the table: an empty instruction
+    const ShiftCase& c = cases[index];
+    AddrSpace* cnst = getConstantSpace ();
+    AddrSpace* reg = getSpaceByName ("register");
+    AddrSpace* uniq = getUniqueSpace ();
+    VarnodeData out, in[2];
+
+    out = { reg, VALUE_REG, (uint4)c.size };
+    in[0] = { cnst, c.value & calc_mask (c.size), (uint4)c.size };
+    emit.dump (baseaddr, CPUI_COPY, &out, in, 1);
+    out = { reg, COUNT_REG, 8 };
+    in[0] = { cnst, c.count, 8 };
+    emit.dump (baseaddr, CPUI_COPY, &out, in, 1);
+
+    out = { uniq, 0x100, (uint4)c.size };
+    in[0] = { reg, VALUE_REG, (uint4)c.size };
+    in[1] = c.constcount ? VarnodeData { cnst, c.count, 8 }
+                         : VarnodeData { reg, COUNT_REG, 8 };
+    emit.dump (baseaddr, c.opc, &out, in, 2);
+
+    out = { reg, RESULT_REG + 8 * index, (uint4)c.size };
+    in[0] = { uniq, 0x100, (uint4)c.size };
+    emit.dump (baseaddr, CPUI_COPY, &out, in, 1);
+    return 4;
+}
+
+// The p-code definition of the shifts, written out independently.
+static uintb shiftReference (const ShiftCase& c)
+{
+    uintb mask = calc_mask (c.size);
+    uintb val = c.value & mask;
+    uintb width = 8 * c.size;
+    bool negative = ((val >> (width - 1)) & 1) != 0;
+    if (c.count >= width) {
+        if (c.opc == CPUI_INT_SRIGHT && negative)
+            return mask;
+        return 0;
+    }
+    switch (c.opc) {
+    case CPUI_INT_LEFT:
+        return (val << c.count) & mask;
+    case CPUI_INT_RIGHT:
+        return val >> c.count;
+    default:
+        {
+            uintb res = val >> c.count;
+            if (negative)
+                res |= mask ^ (mask >> c.count);
+            return res;
+        }
+    }
+}
+
+static int checkShifts (DocumentStorage& docstorage)
+{
+    ContextInternal context;
+    DefaultLoadImage loader (0, nullptr, 0);
+    ShiftTranslate trans (&loader, &context);
+    trans.initialize (docstorage);
+
+    const OpCode ops[] = { CPUI_INT_LEFT, CPUI_INT_RIGHT, CPUI_INT_SRIGHT };
+    const int4 sizes[] = { 1, 2, 4, 8 };
+    const uintb values[] = { 1, 0x7f, 0x80, 0x8000000000000000ULL,
+                             0x123456789abcdef0ULL, ~(uintb)0 };
+    for (OpCode opc : ops)
+        for (int4 size : sizes) {
+            uintb width = 8 * size;
+            const uintb counts[] = { 0, 1, width - 1, width, width + 1,
+                                     63, 64, 65, 200, 0x100000000ULL };
+            for (uintb value : values)
+                for (uintb count : counts)
+                    for (bool constcount : { false, true })
+                        trans.cases.push_back ({ opc, size, value, count, constcount });
+        }
+
+    AddrSpace* ram = trans.getDefaultSpace ();
+    MemoryFlatBank regbank (trans.getSpaceByName ("register"), 8, 4096, REGSIZE);
+    MemoryFlatBank uniqbank (trans.getUniqueSpace (), 8, 4096, UNIQSIZE);
+    MemoryState state (&trans);
+    state.setMemoryBank (&regbank);
+    state.setMemoryBank (&uniqbank);
+
+    BreakTableCallBack breaktable (&trans);
+    EmulateJit emu (&trans, &state, &breaktable);
+    breaktable.setEmulate (&emu);
+    emu.setThreshold (1);
+    emu.setDifferential (true);
+    emu.setExecuteAddress (Address (ram, 0));
+    emu.setHalt (false);
+    try {
+        if (emu.run (trans.cases.size ()) != trans.cases.size ()) {
+            cout << "shift cases: stopped early" << endl;
+            return 1;
+        }
+    } catch (const LowlevelError& err) {
+        cout << "shift cases: " << err.explain << endl;
+        return 1;
+    }
+
+    int bad = 0;
+    for (size_t i = 0; i < trans.cases.size (); ++i) {
+        const ShiftCase& c = trans.cases[i];
+        uintb res = regbank.getValue (RESULT_REG + 8 * i, c.size);
+        if (res != shiftReference (c)) {
+            cout << "shift case " << get_opname (c.opc) << " size " << dec << c.size
+                 << " value 0x" << hex << c.value << " count 0x" << c.count
+                 << (c.constcount ? " (constant)" : "") << ": got 0x" << res
+                 << ", expected 0x" << shiftReference (c) << endl;
+            bad += 1;
+        }
+    }
+    cout << dec << trans.cases.size () << " shift cases, " << bad << " wrong" << endl;
+    return bad != 0;
+}
+
+static int runImage (DocumentStorage& docstorage, const char* path,
+                     int argc, char* argv[])
+{
+    ifstream file (path, ios::in | ios::binary);
+    vector<uint1> img ((istreambuf_iterator<char> (file)), istreambuf_iterator<char> ());
+
+    ContextInternal context;
+    DefaultLoadImage loader (0, img.data (), img.size ());
+    Sleigh trans (&loader, &context);
+    trans.initialize (docstorage);
+    for (int i = 0; i < argc; ++i) {
+        string var (argv[i]);
+        string::size_type eq = var.find ('=');
+        context.setVariableDefault (var.substr (0, eq), stoul (var.substr (eq + 1)));
+    }
+
+    AddrSpace* ram = trans.getDefaultSpace ();
+    MemoryImage image (ram, 8, 4096, &loader);
+    MemoryPageTable rambank (ram, 8, 4096, &image);
+    MemoryFlatBank regbank (trans.getSpaceByName ("register"), 8, 4096, REGSIZE);
+    MemoryFlatBank uniqbank (trans.getUniqueSpace (), 8, 4096, UNIQSIZE);
+    MemoryState state (&trans);
+    state.setMemoryBank (&rambank);
+    state.setMemoryBank (&regbank);
+    state.setMemoryBank (&uniqbank);
+
+    BreakTableCallBack breaktable (&trans);
+    EmulateJit emu (&trans, &state, &breaktable);
+    breaktable.setEmulate (&emu);
+    emu.setThreshold (1);
+    emu.setDifferential (true);
+    emu.setExecuteAddress (Address (ram, 0));
+    emu.setHalt (false);
+
+    uintb steps = 0;
+    try {
+        steps = emu.run (1000000);
+    } catch (const UnimplError& err) {
+        cout << "stopped at an unimplemented instruction: " << err.explain << endl;
+        return 0;
+    } catch (const BadDataError& err) {
+        cout << "stopped at an undecodable instruction: " << err.explain << endl;
+        return 0;
+    } catch (const LowlevelError& err) {
+        cout << "stopped at ";
+        emu.getExecuteAddress ().printRaw (cout);
+        cout << ": " << err.explain << endl;
+        return (err.explain == "Userop not hooked") ? 0 : 1;
+    }
+    cout << steps << " instructions, no differences" << endl;
+    return 0;
+}
+
+int main (int argc, char* argv[])
+{
+    if (argc < 2) {
+        cerr << "usage: jitDiff <spec.sla> [image [var=value...]]" << endl;
+        return 2;
+    }
+    if (!EmulateJit::isSupported ()) {
+        cout << "no code generation on this host" << endl;
+        return 0;
+    }
+    try {
+        DocumentStorage docstorage;
+        Element* root = docstorage.openDocument (argv[1])->getRoot ();
+        docstorage.registerTag (root);
+
+        int res = checkShifts (docstorage);
+        if (argc > 2)
+            res |= runImage (docstorage, argv[2], argc - 3, argv + 3);
+        return res;
+    } catch (const LowlevelError& err) {
+        cout << "error: " << err.explain << endl;
+    } catch (const XmlError& err) {
+        cout << "error: " << err.explain << endl;
+    } catch (const std::exception& err) {
+        cout << "error: " << err.what () << endl;
+    }
+    return 1;
+}
@@ -0,0 +1,196 @@
+#include <iostream>
+#include <random>
+#include "hutch.hpp"
+#include "emulatelanes.hh"
+
+// Checks the lane-wide evaluation of the common integer ops, including the
+// vector paths, against OpBehavior. Each synthetic instruction computes one
+// op from registers holding random values per lane, then a CBRANCH on a
+// random flag skips the write of the result in some lanes, so writes run
+// masked. Lane counts that are not a multiple of the vector width check the
+// leftover lanes.
+
+static const uintb REGSIZE = 0x2000;
+
+static const uintb A_REG = 0x0;      // First input, 8 bytes
+static const uintb B_REG = 0x8;      // Second input, 8 bytes
+static const uintb SKIP_REG = 0x10;  // Nonzero to skip the write, 1 byte
+static const uintb BOOLA_REG = 0x11; // Boolean inputs, 1 byte each
+static const uintb BOOLB_REG = 0x12;
+static const uintb OUT_REG = 0x100;  // Result of case i at OUT_REG + 8*i
+
+struct OpCase {
+    OpCode opc;
+    int4 numin;
+    int4 insize;
+    int4 outsize;
+    bool boolean;
+};
+
+// A translator whose instruction at offset 4*i runs case i:
+//   unique = <op> A_REG[, B_REG]      (or BOOLA_REG, BOOLB_REG)
+//   CBRANCH <end>, SKIP_REG
+//   OUT_REG + 8*i = COPY unique
+// and every instruction past the table is empty.
+class OpTranslate : public Sleigh {
+public:
+    vector<OpCase> cases;
+    OpTranslate (LoadImage* ld, ContextDatabase* c_db) : Sleigh (ld, c_db) {}
+    virtual int4 oneInstruction (PcodeEmit& emit, const Address& baseaddr) const override;
+};
+
+int4 OpTranslate::oneInstruction (PcodeEmit& emit, const Address& baseaddr) const
+{
+    uintb index = baseaddr.getOffset () / 4;
+    if (index >= cases.size ())
+        return 4;
+    const OpCase& c = cases[index];
+    AddrSpace* cnst = getConstantSpace ();
+    AddrSpace* reg = getSpaceByName ("register");
+    AddrSpace* uniq = getUniqueSpace ();
+    VarnodeData out, in[2];
+
+    out = { uniq, 0x100, (uint4)c.outsize };
+    in[0] = { reg, c.boolean ? BOOLA_REG : A_REG, (uint4)c.insize };
+    in[1] = { reg, c.boolean ? BOOLB_REG : B_REG, (uint4)c.insize };
+    emit.dump (baseaddr, c.opc, &out, in, c.numin);
+
+    in[0] = { cnst, 2, 8 };     // Past the COPY, ending the instruction
+    in[1] = { reg, SKIP_REG, 1 };
+    emit.dump (baseaddr, CPUI_CBRANCH, nullptr, in, 2);
+
+    out = { reg, OUT_REG + 8 * index, (uint4)c.outsize };
+    in[0] = { uniq, 0x100, (uint4)c.outsize };
+    emit.dump (baseaddr, CPUI_COPY, &out, in, 1);
+    return 4;
+}
+
+static int checkLanes (OpTranslate& trans, int4 numlanes, mt19937_64& rand)
+{
+    AddrSpace* ram = trans.getDefaultSpace ();
+    AddrSpace* reg = trans.getSpaceByName ("register");
+    MemoryState shared (&trans);
+    EmulateLanes lanes (&trans, &shared, numlanes);
+    LaneBank* regs = lanes.addLaneBank (reg, REGSIZE);
+    lanes.addLaneBank (trans.getUniqueSpace (), 0x1000);
+
+    // Small values and equal inputs turn up often enough to reach the
+    // shift counts past the width and both sides of each compare.
+    for (int4 l = 0; l < numlanes; ++l) {
+        uintb a = rand ();
+        uintb b = rand ();
+        switch (rand () % 4) {
+        case 0: b = rand () % 80; break;
+        case 1: b = a; break;
+        case 2: a = rand () % 4; b = rand () % 4; break;
+        }
+        regs->setValue (l, A_REG, 8, a);
+        regs->setValue (l, B_REG, 8, b);
+        regs->setValue (l, SKIP_REG, 1, rand () % 2);
+        regs->setValue (l, BOOLA_REG, 1, rand () % 2);
+        regs->setValue (l, BOOLB_REG, 1, rand () % 2);
+        for (size_t i = 0; i < trans.cases.size (); ++i)
+            regs->setValue (l, OUT_REG + 8 * i, 8, rand ());
+    }
+    vector<uintb> before (numlanes * trans.cases.size ());
+    for (int4 l = 0; l < numlanes; ++l)
+        for (size_t i = 0; i < trans.cases.size (); ++i)
+            before[l * trans.cases.size () + i] = regs->getValue (l, OUT_REG + 8 * i, 8);
+
+    lanes.addStop (Address (ram, 4 * trans.cases.size ()));
+    lanes.setExecuteAddress (Address (ram, 0));
+    lanes.run (trans.cases.size () + 1);
+
+    vector<OpBehavior*> inst;
+    OpBehavior::registerInstructions (inst, &trans);
+    int bad = 0;
+    for (int4 l = 0; l < numlanes; ++l) {
+        if (lanes.getStatus (l) != EmulateLanes::lane_stopped) {
+            cout << numlanes << " lanes: lane " << l << " did not reach the end" << endl;
+            bad += 1;
+            continue;
+        }
+        bool skip = regs->getValue (l, SKIP_REG, 1) != 0;
+        for (size_t i = 0; i < trans.cases.size (); ++i) {
+            const OpCase& c = trans.cases[i];
+            uintb a = regs->getValue (l, c.boolean ? BOOLA_REG : A_REG, c.insize);
+            uintb b = regs->getValue (l, c.boolean ? BOOLB_REG : B_REG, c.insize);
+            uintb old = before[l * trans.cases.size () + i];
+            uintb want;
+            if (skip)
+                want = old;
+            else {
+                OpBehavior* behave = inst[c.opc];
+                want = (c.numin == 1) ? behave->evaluateUnary (c.outsize, c.insize, a)
+                                      : behave->evaluateBinary (c.outsize, c.insize, a, b);
+                if (c.outsize < 8)
+                    want |= old & ~calc_mask (c.outsize);
+            }
+            uintb got = regs->getValue (l, OUT_REG + 8 * i, 8);
+            if (got != want) {
+                cout << numlanes << " lanes: lane " << l << " " << get_opname (c.opc)
+                     << " size " << c.insize << " of 0x" << hex << a << ", 0x" << b
+                     << ": got 0x" << got << ", expected 0x" << want << dec << endl;
+                bad += 1;
+            }
+        }
+    }
+    for (OpBehavior* behave : inst)
+        delete behave;
+    return bad;
+}
+
+int main (int argc, char* argv[])
+{
+    if (argc < 2) {
+        cerr << "usage: lanesOps <spec.sla>" << endl;
+        return 2;
+    }
+    try {
+        DocumentStorage docstorage;
+        Element* root = docstorage.openDocument (argv[1])->getRoot ();
+        docstorage.registerTag (root);
+
+        ContextInternal context;
+        DefaultLoadImage loader (0, nullptr, 0);
+        OpTranslate trans (&loader, &context);
+        trans.initialize (docstorage);
+
+        const OpCode unary[] = { CPUI_COPY, CPUI_INT_ZEXT, CPUI_INT_SEXT,
+                                 CPUI_INT_2COMP, CPUI_INT_NEGATE };
+        const OpCode binary[] = { CPUI_INT_ADD, CPUI_INT_SUB, CPUI_INT_MULT,
+                                  CPUI_INT_AND, CPUI_INT_OR, CPUI_INT_XOR,
+                                  CPUI_INT_EQUAL, CPUI_INT_NOTEQUAL, CPUI_INT_LESS,
+                                  CPUI_INT_LESSEQUAL, CPUI_INT_SLESS, CPUI_INT_CARRY,
+                                  CPUI_INT_LEFT, CPUI_INT_RIGHT, CPUI_INT_SRIGHT };
+        const OpCode boolean[] = { CPUI_BOOL_AND, CPUI_BOOL_OR, CPUI_BOOL_XOR };
+        for (int4 size : { 1, 2, 4, 8 }) {
+            for (OpCode opc : unary) {
+                bool extend = (opc == CPUI_INT_ZEXT || opc == CPUI_INT_SEXT);
+                if (extend && size == 8)
+                    continue;
+                trans.cases.push_back ({ opc, 1, size, extend ? 8 : size, false });
+            }
+            for (OpCode opc : binary) {
+                bool compare = (opc >= CPUI_INT_EQUAL && opc <= CPUI_INT_LESSEQUAL)
+                               || opc == CPUI_INT_CARRY;
+                trans.cases.push_back ({ opc, 2, size, compare ? 1 : size, false });
+            }
+        }
+        trans.cases.push_back ({ CPUI_BOOL_NEGATE, 1, 1, 1, true });
+        for (OpCode opc : boolean)
+            trans.cases.push_back ({ opc, 2, 1, 1, true });
+
+        mt19937_64 rand (1);
+        int bad = 0;
+        for (int4 numlanes : { 1, 3, 4, 5, 8, 13, 64, 67 })
+            bad += checkLanes (trans, numlanes, rand);
+        cout << trans.cases.size () << " ops, " << bad << " wrong" << endl;
+        return (bad != 0) ? 1 : 0;
+    } catch (const LowlevelError& err) {
+        cout << "error: " << err.explain << endl;
+    } catch (const XmlError& err) {
+        cout << "error: " << err.explain << endl;
+    }
+    return 1;
+}
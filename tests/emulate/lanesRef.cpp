@@ -0,0 +1,90 @@
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include "hutch.hpp"
+#include "emulatelanes.hh"
+
+// Runs a raw image from offset 0 to a stop offset under EmulateLanes, with
+// every lane's registers randomized, then replays each lane on its own with
+// EmulatePcodeCache, whose OpBehavior evaluation is the reference, and
+// compares the registers.
+
+static const int4 LANES = 64;
+static const uintb REGSIZE = 0x2000;
+
+int main(int argc, char *argv[])
+{
+    if (argc < 4) {
+        cerr << "usage: lanesRef <spec.sla> <image> <stop> [var=value...]" << endl;
+        return 2;
+    }
+    ifstream file (argv[2], ios::in | ios::binary);
+    vector<uint1> img ((istreambuf_iterator<char> (file)), istreambuf_iterator<char> ());
+    uintb stop = stoul (argv[3], nullptr, 0);
+
+    DocumentStorage docstorage;
+    Element* root = docstorage.openDocument (argv[1])->getRoot ();
+    docstorage.registerTag (root);
+
+    ContextInternal context;
+    DefaultLoadImage loader (0, img.data (), img.size ());
+    Sleigh trans (&loader, &context);
+    trans.initialize (docstorage);
+    for (int i = 4; i < argc; ++i) {
+        string var (argv[i]);
+        string::size_type eq = var.find ('=');
+        context.setVariableDefault (var.substr (0, eq), stoul (var.substr (eq + 1)));
+    }
+
+    AddrSpace* ram = trans.getDefaultSpace ();
+    AddrSpace* reg = trans.getSpaceByName ("register");
+    AddrSpace* uniq = trans.getSpaceByName ("unique");
+    MemoryImage image (ram, 8, 4096, &loader);
+    MemoryState shared (&trans);
+    shared.setMemoryBank (&image);
+
+    EmulateLanes lanes (&trans, &shared, LANES);
+    LaneBank* regs = lanes.addLaneBank (reg, REGSIZE);
+    lanes.addLaneBank (uniq, 0x100000);
+    mt19937_64 rand (1);
+    vector<uintb> initial (LANES * REGSIZE / 8);
+    for (int4 l = 0; l < LANES; ++l) {
+        for (uintb off = 0; off < REGSIZE; off += 8) {
+            initial[(l * REGSIZE + off) / 8] = rand ();
+            regs->setValue (l, off, 8, initial[(l * REGSIZE + off) / 8]);
+        }
+    }
+    lanes.addStop (Address (ram, stop));
+    lanes.setExecuteAddress (Address (ram, 0));
+    lanes.run (100000);
+
+    int4 bad = 0;
+    for (int4 l = 0; l < LANES; ++l) {
+        MemoryPageOverlay rambank (ram, 8, 4096, &image);
+        MemoryFlatBank regbank (reg, 8, 4096, REGSIZE);
+        MemoryHashOverlay uniqbank (uniq, 8, 4096, 4096, nullptr);
+        MemoryState state (&trans);
+        state.setMemoryBank (&rambank);
+        state.setMemoryBank (&regbank);
+        state.setMemoryBank (&uniqbank);
+        for (uintb off = 0; off < REGSIZE; off += 8)
+            regbank.setValue (off, 8, initial[(l * REGSIZE + off) / 8]);
+
+        BreakTableCallBack breaktable (&trans);
+        EmulatePcodeCache emu (&trans, &state, &breaktable);
+        emu.setExecuteAddress (Address (ram, 0));
+        for (int4 i = 0; i < 100000 && emu.getExecuteAddress ().getOffset () != stop; ++i)
+            emu.executeInstruction ();
+
+        for (uintb off = 0; off < REGSIZE; off += 8) {
+            if (regbank.getValue (off, 8) != regs->getValue (l, off, 8)) {
+                cout << "lane " << l << " differs at register offset 0x" << hex << off << dec << endl;
+                bad += 1;
+                break;
+            }
+        }
+    }
+    cout << LANES - bad << " of " << LANES << " lanes match" << endl;
+    return (bad != 0) ? 1 : 0;
+}
@@ -0,0 +1,74 @@
+#include <iostream>
+#include <random>
+#include "hutch.hpp"
+
+// Wide INT_MULT gives the full product truncated to the output size. Random
+// 16 and 32 byte operands, and the carry-heavy all-ones and single top-bit
+// values, are multiplied through OpBehaviorIntMult::evaluateBinaryWide() and
+// compared with a byte at a time schoolbook product.
+
+static void byteProduct (int4 size, const uint1* a, const uint1* b, uint1* out)
+{
+    vector<uint4> acc (size, 0);
+    for (int4 i = 0; i < size; ++i)
+        for (int4 j = 0; i + j < size; ++j)
+            acc[i + j] += (uint4)a[i] * b[j];
+    uint4 carry = 0;
+    for (int4 k = 0; k < size; ++k) {
+        uint8 val = (uint8)acc[k] + carry;
+        out[k] = (uint1)val;
+        carry = (uint4)(val >> 8);
+    }
+}
+
+static int check (const OpBehaviorIntMult& mult, int4 size, const vector<uint1>& a,
+                  const vector<uint1>& b)
+{
+    vector<uint1> got (size), want (size);
+    mult.evaluateBinaryWide (size, size, size, a.data (), b.data (), got.data ());
+    byteProduct (size, a.data (), b.data (), want.data ());
+    if (got == want)
+        return 0;
+    cout << size << " byte multiply of 0x";
+    for (int4 i = size - 1; i >= 0; --i)
+        cout << hex << (a[i] >> 4) << (a[i] & 0xf);
+    cout << " by 0x";
+    for (int4 i = size - 1; i >= 0; --i)
+        cout << (b[i] >> 4) << (b[i] & 0xf);
+    cout << dec << " is wrong" << endl;
+    return 1;
+}
+
+int main (int argc, char* argv[])
+{
+    OpBehaviorIntMult mult;
+    mt19937_64 rand (1);
+    int bad = 0;
+    int count = 0;
+    for (int4 size : { 16, 32, 12 }) {
+        vector<uint1> ones (size, 0xff);
+        vector<uint1> top (size, 0);
+        top[size - 1] = 0x80;
+        vector<uint1> small (size, 0);
+        small[0] = 3;
+        bad += check (mult, size, ones, ones);
+        bad += check (mult, size, ones, small);
+        bad += check (mult, size, top, small);
+        count += 3;
+        for (int4 trial = 0; trial < 1000; ++trial) {
+            vector<uint1> a (size), b (size);
+            for (int4 i = 0; i < size; ++i) {
+                a[i] = (uint1)rand ();
+                b[i] = (uint1)rand ();
+            }
+            // Operands that fill only the low half carry into the high half
+            if (trial % 3 == 0)
+                for (int4 i = size / 2; i < size; ++i)
+                    b[i] = 0;
+            bad += check (mult, size, a, b);
+            count += 1;
+        }
+    }
+    cout << count << " products, " << bad << " wrong" << endl;
+    return (bad != 0) ? 1 : 0;
+}
@@ -0,0 +1,63 @@
+#include <iostream>
+#include <map>
+#include <random>
+#include "hutch.hpp"
+
+// InstructionStore keeps the same address order as a std::map under a linear
+// sweep, then under inserts scattered all over it that split its chunks.
+// Walking forwards and backwards, find() and at() all agree with the map, and
+// every Handle still names the instruction it was handed out for.
+
+static bool agrees (InstructionStore& store, map<uintb, InstructionStore::Handle>& want)
+{
+    if (store.size () != want.size ())
+        return false;
+    auto iter = store.begin ();
+    for (auto& [address, h] : want) {
+        if ((iter == store.end ()) || (iter->address != address) ||
+            (iter.handle () != h) || (store[h].address != address) ||
+            (store.find (address) != h) || (store.at (h) != iter))
+            return false;
+        ++iter;
+    }
+    if (iter != store.end ())
+        return false;
+    auto riter = store.rbegin ();
+    for (auto w = want.rbegin (); w != want.rend (); ++w, ++riter)
+        if ((riter == store.rend ()) || (riter->address != w->first))
+            return false;
+    return (riter == store.rend ());
+}
+
+int main (int argc, char* argv[])
+{
+    InstructionStore store;
+    map<uintb, InstructionStore::Handle> want;
+    bool ok = true;
+
+    for (uintb address = 0x1000; address < 0x1000 + 3000 * 4; address += 4) {
+        auto [h, isnew] = store.insert (address);
+        ok = ok && isnew;
+        want[address] = h;
+    }
+    ok = agrees (store, want) && ok;
+
+    mt19937 rand (1);
+    for (int i = 0; i < 20000; ++i) {
+        uintb address = rand () % 0x6000;
+        auto [h, isnew] = store.insert (address);
+        if (isnew != (want.find (address) == want.end ()) ||
+            (!isnew && (want[address] != h))) {
+            cout << "insert of 0x" << hex << address << dec << " is wrong" << endl;
+            ok = false;
+            break;
+        }
+        want[address] = h;
+    }
+    ok = agrees (store, want) && ok;
+    ok = (store.find (0x7000) == InstructionStore::invalid) && ok;
+    ok = (store.at (InstructionStore::invalid) == store.end ()) && ok;
+
+    cout << store.size () << " instructions, " << (ok ? "ok" : "failed") << endl;
+    return ok ? 0 : 1;
+}
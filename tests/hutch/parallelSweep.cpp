@@ -0,0 +1,64 @@
+#include <iostream>
+#include <random>
+#include "hutch.hpp"
+
+// disassemble_parallel() stores the same listing as a serial sweep with
+// disassemble_iter() over the same image, stepping one byte past anything it
+// rejects. The image is random bytes, so it is full of bad data, instructions
+// without pcode semantics and worker ranges that split an instruction.
+//
+// Run from this directory, preconfigure() finds the x86 specification
+// relative to it.
+
+static bool same (Instruction& a, Instruction& b)
+{
+    if ((a.address != b.address) || (a.bytelength != b.bytelength) ||
+        (a.assembly != b.assembly) || (a.pcode.size () != b.pcode.size ()))
+        return false;
+    for (auto i = 0; i != a.pcode.size (); ++i)
+        if (!(a.pcode[i] == b.pcode[i]))
+            return false;
+    return true;
+}
+
+int main (int argc, char* argv[])
+{
+    // Large enough for four workers, see disassemble_parallel()
+    vector<uint1> image (0x40000);
+    mt19937 rand (1);
+    for (auto& b : image)
+        b = (uint1)rand ();
+
+    Hutch hutch_h;
+    hutch_h.preconfigure (IA32);
+    hutch_h.initialize (image.data (), image.size (), 0x00000000);
+
+    Hutch_Instructions serial;
+    for (uintb offset = 0; offset < image.size ();) {
+        uint len = hutch_h.disassemble_iter (offset, &serial);
+        offset += (len != 0) ? len : 1;
+    }
+
+    Hutch_Instructions parallel;
+    uintb count = hutch_h.disassemble_parallel (parallel, 4);
+
+    int bad = 0;
+    if ((count != serial.count ()) || (parallel.count () != serial.count ())) {
+        cout << "serial sweep found " << serial.count ()
+             << " instructions, parallel " << count << endl;
+        bad += 1;
+    }
+    auto a = serial.begin ();
+    auto b = parallel.begin ();
+    for (; (a != serial.end ()) && (b != parallel.end ()) && (bad < 10); ++a, ++b) {
+        if (!same (*a, *b)) {
+            cout << "serial 0x" << hex << a->address << " " << a->assembly
+                 << ", parallel 0x" << b->address << " " << b->assembly << dec
+                 << endl;
+            bad += 1;
+        }
+    }
+    cout << serial.count () << " instructions, "
+         << ((bad == 0) ? "ok" : "failed") << endl;
+    return (bad != 0) ? 1 : 0;
+}
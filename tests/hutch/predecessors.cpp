@@ -0,0 +1,57 @@
+#include <iostream>
+#include "hutch.hpp"
+
+// Backward decoding from a ret: the instruction before it is found whether
+// it starts at the first byte of the image or further in, and
+// inspectPreviousInstruction(), predecessors() and gadgets() agree.
+//
+// Run from this directory, preconfigure() finds the x86 specification
+// relative to it.
+
+// nop          \x90    offset 0
+// ret          \xc3    offset 1
+// pop ebp      \x5d    offset 2
+// ret          \xc3    offset 3
+static uint1 code[] = { 0x90, 0xc3, 0x5d, 0xc3 };
+
+static int check (Hutch& hutch_h, Hutch_Instructions& insn, uintb ret,
+                  uintb expect)
+{
+    int bad = 0;
+    uint2 mask = hutch_h.predecessors (ret, insn);
+    if (mask != (1 << (ret - expect))) {
+        cout << "ret at " << ret << ": predecessor mask 0x" << hex << mask
+             << dec << endl;
+        bad += 1;
+    }
+
+    vector<InstructionStore::Handle> prev =
+        hutch_h.inspectPreviousInstruction (ret, 15, insn, nullptr);
+    if ((prev.size () != 1) || (insn[prev[0]].address != expect)) {
+        cout << "ret at " << ret << ": inspectPreviousInstruction found "
+             << prev.size () << " instructions" << endl;
+        bad += 1;
+    }
+
+    vector<GadgetView> chains = hutch_h.gadgets ({ ret }, 15, 2, insn);
+    if ((chains.size () != 1) || (chains[0].size () != 2) ||
+        (chains[0][0].address != expect)) {
+        cout << "ret at " << ret << ": gadgets found " << chains.size ()
+             << " chains" << endl;
+        bad += 1;
+    }
+    return bad;
+}
+
+int main (int argc, char* argv[])
+{
+    Hutch hutch_h;
+    Hutch_Instructions insn;
+
+    hutch_h.preconfigure (IA32);
+    hutch_h.initialize (code, sizeof (code), 0x00000000);
+
+    int bad = check (hutch_h, insn, 1, 0) + check (hutch_h, insn, 3, 2);
+    cout << ((bad == 0) ? "ok" : "failed") << endl;
+    return (bad != 0) ? 1 : 0;
+}
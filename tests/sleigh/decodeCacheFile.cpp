@@ -0,0 +1,131 @@
+#include <iostream>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "hutch.hpp"
+
+// A decode cache file whose last record was cut short, as by a process killed
+// while saving, loads the records before it, and the next save appends after
+// them rather than after the torn bytes, so the file reloads completely.
+// Entries loaded from a file read from its mapping, so they must survive the
+// file being written over under another key.
+
+static const char* spec =
+    "<sleigh version=\"2\" bigendian=\"false\" align=\"1\" uniqbase=\"0x1000\">\n"
+    "<spaces defaultspace=\"ram\">\n"
+    "<space_unique name=\"unique\" index=\"1\" bigendian=\"false\" delay=\"0\" size=\"4\"/>\n"
+    "<space name=\"ram\" index=\"2\" bigendian=\"false\" delay=\"1\" size=\"4\" wordsize=\"1\" physical=\"true\"/>\n"
+    "<space name=\"register\" index=\"3\" bigendian=\"false\" delay=\"0\" size=\"4\" physical=\"true\"/>\n"
+    "</spaces>\n"
+    "<symbol_table scopesize=\"1\" symbolsize=\"0\">\n"
+    "<scope id=\"0x0\" parent=\"0x0\"/>\n"
+    "</symbol_table>\n"
+    "</sleigh>\n";
+
+static const uint8 KEY = 0x1234;
+
+static DecodedInstruction* makeEntry (AddrSpace* ram, uintb offset)
+{
+    InstructionRecord rec;
+    rec.length = 1;
+    rec.fallthrough = 1;
+    rec.mnem = "OP" + to_string (offset);
+    rec.body = "body of " + to_string (offset);
+    rec.bytes[0] = (uint1)offset;
+    return new DecodedInstruction (Address (ram, offset), nullptr, 0, rec);
+}
+
+// Every entry in [0,num) is present, with the text it was made with.
+static bool hasEntries (SharedDecodeCache& cache, AddrSpace* ram, uintb num)
+{
+    for (uintb offset = 0; offset < num; ++offset) {
+        const DecodedInstruction* insn = cache.find (Address (ram, offset), nullptr, 0);
+        InstructionRecord rec;
+        vector<VarnodeData> scratch;
+        if (insn != nullptr)
+            insn->fill (rec, scratch);
+        if ((insn == nullptr) || (rec.mnem != "OP" + to_string (offset)) ||
+            (rec.body != "body of " + to_string (offset)) ||
+            (rec.bytes[0] != (uint1)offset)) {
+            cout << "entry " << offset << " is missing or wrong" << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main (int argc, char* argv[])
+{
+    string path = "decodeCacheFile.tmp";
+    try {
+        DocumentStorage docstorage;
+        istringstream s (spec);
+        Element* root = docstorage.parseDocument (s)->getRoot ();
+        docstorage.registerTag (root);
+        ContextInternal context;
+        DefaultLoadImage loader (0, nullptr, 0);
+        Sleigh trans (&loader, &context);
+        trans.initialize (docstorage);
+        AddrSpace* ram = trans.getDefaultSpace ();
+        unlink (path.c_str ());
+
+        bool ok = true;
+        {
+            SharedDecodeCache cache (64);
+            for (uintb offset = 0; offset < 3; ++offset)
+                cache.insert (makeEntry (ram, offset));
+            ok = ok && (cache.saveFile (path, KEY) == 3);
+        }
+
+        // Tear the last record
+        struct stat st;
+        stat (path.c_str (), &st);
+        if (truncate (path.c_str (), st.st_size - 5) != 0) {
+            cout << "unable to truncate " << path << endl;
+            return 1;
+        }
+
+        {
+            SharedDecodeCache cache (64);
+            int4 loaded = cache.loadFile (path, KEY, &trans);
+            if (loaded != 2) {
+                cout << "loaded " << loaded << " entries from the torn file" << endl;
+                ok = false;
+            }
+            for (uintb offset = 2; offset < 5; ++offset)
+                cache.insert (makeEntry (ram, offset));
+            ok = ok && (cache.saveFile (path, KEY) == 3);
+        }
+
+        {
+            SharedDecodeCache cache (64);
+            int4 loaded = cache.loadFile (path, KEY, &trans);
+            if (loaded != 5) {
+                cout << "loaded " << loaded << " entries after appending" << endl;
+                ok = false;
+            }
+            ok = hasEntries (cache, ram, 5) && ok;
+            ok = (cache.saveFile (path, KEY + 1) == 5) && ok;
+            ok = hasEntries (cache, ram, 5) && ok;
+        }
+
+        {
+            SharedDecodeCache cache (64);
+            int4 loaded = cache.loadFile (path, KEY + 1, &trans);
+            if (loaded != 5) {
+                cout << "loaded " << loaded << " entries after rewriting" << endl;
+                ok = false;
+            }
+            ok = hasEntries (cache, ram, 5) && ok;
+        }
+        unlink (path.c_str ());
+        cout << (ok ? "ok" : "failed") << endl;
+        return ok ? 0 : 1;
+    } catch (const LowlevelError& err) {
+        cout << "error: " << err.explain << endl;
+    } catch (const XmlError& err) {
+        cout << "error: " << err.explain << endl;
+    }
+    unlink (path.c_str ());
+    return 1;
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <sstream>
+#include "hutch.hpp"
+
+// An operand bound to epsilon prints as "0". The specification below has a
+// single instruction, byte 0x01, displayed as "ZERO" followed by such an
+// operand. Its constructor has no p-code, so building p-code fails with the
+// text of the stream printer (printMnemonic/printBody), which has to match
+// what printAssembly() and decodeInstruction() produce through AsmPieces.
+
+static const char* spec =
+    "<sleigh version=\"2\" bigendian=\"false\" align=\"1\" uniqbase=\"0x1000\">\n"
+    "<spaces defaultspace=\"ram\">\n"
+    "<space_unique name=\"unique\" index=\"1\" bigendian=\"false\" delay=\"0\" size=\"4\"/>\n"
+    "<space name=\"ram\" index=\"2\" bigendian=\"false\" delay=\"1\" size=\"4\" wordsize=\"1\" physical=\"true\"/>\n"
+    "<space name=\"register\" index=\"3\" bigendian=\"false\" delay=\"0\" size=\"4\" physical=\"true\"/>\n"
+    "</spaces>\n"
+    "<symbol_table scopesize=\"2\" symbolsize=\"3\">\n"
+    "<scope id=\"0x0\" parent=\"0x0\"/>\n"
+    "<scope id=\"0x1\" parent=\"0x0\"/>\n"
+    "<epsilon_sym_head name=\"epsilon\" id=\"0x0\" scope=\"0x0\"/>\n"
+    "<subtable_sym_head name=\"instruction\" id=\"0x1\" scope=\"0x0\"/>\n"
+    "<operand_sym_head name=\"zero\" id=\"0x2\" scope=\"0x1\"/>\n"
+    "<epsilon_sym name=\"epsilon\" id=\"0x0\" scope=\"0x0\"/>\n"
+    "<subtable_sym name=\"instruction\" id=\"0x1\" scope=\"0x0\" numct=\"1\">\n"
+    "<constructor parent=\"0x1\" first=\"1\" length=\"1\" line=\"1\">\n"
+    "<oper id=\"0x2\"/>\n"
+    "<print piece=\"ZERO\"/>\n"
+    "<print piece=\" \"/>\n"
+    "<opprint id=\"0\"/>\n"
+    "</constructor>\n"
+    "<decision number=\"0\" context=\"false\" start=\"0\" size=\"0\">\n"
+    "<pair id=\"0\"><instruct_pat><pat_block offset=\"0\" nonzero=\"1\">"
+    "<mask_word mask=\"0xff000000\" val=\"0x1000000\"/></pat_block></instruct_pat></pair>\n"
+    "</decision>\n"
+    "</subtable_sym>\n"
+    "<operand_sym name=\"zero\" id=\"0x2\" scope=\"0x1\" subsym=\"0x0\" off=\"0\" base=\"-1\" minlen=\"0\" index=\"0\">\n"
+    "<operand_exp index=\"0\" table=\"0x1\" ct=\"0x0\"/>\n"
+    "</operand_sym>\n"
+    "</symbol_table>\n"
+    "</sleigh>\n";
+
+class AssemblyText : public AssemblyEmit {
+public:
+    string text;
+    virtual void dump (const Address& addr, const string& mnem,
+                       const string& body) override
+    {
+        text = mnem + "  " + body;
+    }
+};
+
+class PcodeIgnore : public PcodeEmit {
+public:
+    virtual void dump (const Address& addr, OpCode opc, VarnodeData* outvar,
+                       VarnodeData* vars, int4 isize) override
+    {
+    }
+};
+
+int main (int argc, char* argv[])
+{
+    static uint1 code[] = { 0x01 };
+    try {
+        DocumentStorage docstorage;
+        istringstream s (spec);
+        Element* root = docstorage.parseDocument (s)->getRoot ();
+        docstorage.registerTag (root);
+
+        ContextInternal context;
+        DefaultLoadImage loader (0, code, sizeof (code));
+        Sleigh trans (&loader, &context);
+        trans.initialize (docstorage);
+        Address addr (trans.getDefaultSpace (), 0);
+
+        AssemblyText printed;
+        trans.printAssembly (printed, addr);
+
+        // The text is filled in before the p-code is built
+        InstructionRecord rec;
+        try {
+            trans.decodeInstruction (rec, addr);
+        } catch (const UnimplError&) {
+        }
+        string decoded = rec.mnem + "  " + rec.body;
+
+        string old;
+        PcodeIgnore pcode;
+        try {
+            trans.oneInstruction (pcode, addr);
+        } catch (const UnimplError& err) {
+            old = err.explain.substr (err.explain.find (": ") + 2);
+        }
+
+        cout << "stream printer:     \"" << old << "\"" << endl;
+        cout << "printAssembly:      \"" << printed.text << "\"" << endl;
+        cout << "decodeInstruction:  \"" << decoded << "\"" << endl;
+        bool ok = (old == "ZERO  0") && (printed.text == old) && (decoded == old);
+        cout << (ok ? "ok" : "failed") << endl;
+        return ok ? 0 : 1;
+    } catch (const LowlevelError& err) {
+        cout << "error: " << err.explain << endl;
+    } catch (const XmlError& err) {
+        cout << "error: " << err.explain << endl;
+    }
+    return 1;
+}
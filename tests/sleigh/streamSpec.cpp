@@ -0,0 +1,158 @@
+#include <iostream>
+#include <sstream>
+#include "hutch.hpp"
+
+// A specification restored with Sleigh::initialize(istream&), which restores
+// each symbol as soon as its elements are parsed and frees them again,
+// decodes exactly as the same text restored from a DocumentStorage tree. A
+// specification of the wrong version is refused either way.
+
+static const char* spec =
+    "<sleigh version=\"2\" bigendian=\"false\" align=\"1\" uniqbase=\"0x1000\">\n"
+    "<spaces defaultspace=\"ram\">\n"
+    "<space_unique name=\"unique\" index=\"1\" bigendian=\"false\" delay=\"0\" size=\"4\"/>\n"
+    "<space name=\"ram\" index=\"2\" bigendian=\"false\" delay=\"1\" size=\"4\" wordsize=\"1\" physical=\"true\"/>\n"
+    "<space name=\"register\" index=\"3\" bigendian=\"false\" delay=\"0\" size=\"4\" physical=\"true\"/>\n"
+    "</spaces>\n"
+    "<symbol_table scopesize=\"2\" symbolsize=\"3\">\n"
+    "<scope id=\"0x0\" parent=\"0x0\"/>\n"
+    "<scope id=\"0x1\" parent=\"0x0\"/>\n"
+    "<epsilon_sym_head name=\"epsilon\" id=\"0x0\" scope=\"0x0\"/>\n"
+    "<subtable_sym_head name=\"instruction\" id=\"0x1\" scope=\"0x0\"/>\n"
+    "<operand_sym_head name=\"zero\" id=\"0x2\" scope=\"0x1\"/>\n"
+    "<epsilon_sym name=\"epsilon\" id=\"0x0\" scope=\"0x0\"/>\n"
+    "<subtable_sym name=\"instruction\" id=\"0x1\" scope=\"0x0\" numct=\"2\">\n"
+    // 0x01: ZERO 0, register[0:4] = COPY 5:4
+    "<constructor parent=\"0x1\" first=\"1\" length=\"1\" line=\"1\">\n"
+    "<oper id=\"0x2\"/>\n"
+    "<print piece=\"ZERO\"/>\n"
+    "<print piece=\" \"/>\n"
+    "<opprint id=\"0\"/>\n"
+    "<construct_tpl>\n<null/>\n"
+    "<op_tpl code=\"COPY\">"
+    "<varnode_tpl><const_tpl type=\"spaceid\" name=\"register\"/>"
+    "<const_tpl type=\"real\" val=\"0x0\"/><const_tpl type=\"real\" val=\"0x4\"/></varnode_tpl>\n"
+    "<varnode_tpl><const_tpl type=\"spaceid\" name=\"const\"/>"
+    "<const_tpl type=\"real\" val=\"0x5\"/><const_tpl type=\"real\" val=\"0x4\"/></varnode_tpl>\n"
+    "</op_tpl>\n"
+    "</construct_tpl>\n"
+    "</constructor>\n"
+    // 0x02: TWO <more>, register[4:4] = INT_ADD register[0:4], 7:4
+    "<constructor parent=\"0x1\" first=\"1\" length=\"1\" line=\"2\">\n"
+    "<print piece=\"TWO\"/>\n"
+    "<print piece=\" \"/>\n"
+    "<print piece=\"&lt;more&gt;\"/>\n"
+    "<construct_tpl>\n<null/>\n"
+    "<op_tpl code=\"INT_ADD\">"
+    "<varnode_tpl><const_tpl type=\"spaceid\" name=\"register\"/>"
+    "<const_tpl type=\"real\" val=\"0x4\"/><const_tpl type=\"real\" val=\"0x4\"/></varnode_tpl>\n"
+    "<varnode_tpl><const_tpl type=\"spaceid\" name=\"register\"/>"
+    "<const_tpl type=\"real\" val=\"0x0\"/><const_tpl type=\"real\" val=\"0x4\"/></varnode_tpl>\n"
+    "<varnode_tpl><const_tpl type=\"spaceid\" name=\"const\"/>"
+    "<const_tpl type=\"real\" val=\"0x7\"/><const_tpl type=\"real\" val=\"0x4\"/></varnode_tpl>\n"
+    "</op_tpl>\n"
+    "</construct_tpl>\n"
+    "</constructor>\n"
+    "<decision number=\"0\" context=\"false\" start=\"0\" size=\"0\">\n"
+    "<pair id=\"0\"><instruct_pat><pat_block offset=\"0\" nonzero=\"1\">"
+    "<mask_word mask=\"0xff000000\" val=\"0x1000000\"/></pat_block></instruct_pat></pair>\n"
+    "<pair id=\"1\"><instruct_pat><pat_block offset=\"0\" nonzero=\"1\">"
+    "<mask_word mask=\"0xff000000\" val=\"0x2000000\"/></pat_block></instruct_pat></pair>\n"
+    "</decision>\n"
+    "</subtable_sym>\n"
+    "<operand_sym name=\"zero\" id=\"0x2\" scope=\"0x1\" subsym=\"0x0\" off=\"0\" base=\"-1\" minlen=\"0\" index=\"0\">\n"
+    "<operand_exp index=\"0\" table=\"0x1\" ct=\"0x0\"/>\n"
+    "</operand_sym>\n"
+    "</symbol_table>\n"
+    "</sleigh>\n";
+
+static uint1 code[] = { 0x01, 0x02, 0x01 };
+
+static void printVarnode (ostream& s, const VarnodeData* vn)
+{
+    s << vn->space->getName () << "[0x" << hex << vn->offset << dec << ":" << vn->size << "]";
+}
+
+// Disassembly and p-code of every instruction in the image, as text.
+static string decodeAll (Sleigh& trans)
+{
+    ostringstream s;
+    for (uintb offset = 0; offset < sizeof (code); ++offset) {
+        InstructionRecord rec;
+        trans.decodeInstruction (rec, Address (trans.getDefaultSpace (), offset));
+        s << offset << ": " << rec.length << " " << rec.mnem << " " << rec.body << "\n";
+        for (const PcodeData& op : rec.pcode) {
+            s << "    " << get_opname (op.opc);
+            if (op.outvar != nullptr) {
+                s << " ";
+                printVarnode (s, op.outvar);
+                s << " =";
+            }
+            for (int4 i = 0; i < op.isize; ++i) {
+                s << " ";
+                printVarnode (s, &op.invar[i]);
+            }
+            s << "\n";
+        }
+    }
+    return s.str ();
+}
+
+static string decodeTree (const string& text)
+{
+    DocumentStorage docstorage;
+    istringstream s (text);
+    docstorage.registerTag (docstorage.parseDocument (s)->getRoot ());
+    ContextInternal context;
+    DefaultLoadImage loader (0, code, sizeof (code));
+    Sleigh trans (&loader, &context);
+    trans.initialize (docstorage);
+    return decodeAll (trans);
+}
+
+static string decodeStream (const string& text, bool lazy)
+{
+    istringstream s (text);
+    ContextInternal context;
+    DefaultLoadImage loader (0, code, sizeof (code));
+    Sleigh trans (&loader, &context);
+    trans.setLazyRestore (lazy);
+    trans.initialize (s);
+    return decodeAll (trans);
+}
+
+int main (int argc, char* argv[])
+{
+    bool ok = true;
+    try {
+        string want = decodeTree (spec);
+        ok = (want.find ("TWO <more>") != string::npos);
+        // Lazy restore cannot apply, the elements are gone once restored
+        for (bool lazy : { false, true }) {
+            string got = decodeStream (spec, lazy);
+            if (got != want) {
+                cout << "streamed" << (lazy ? ", lazy" : "") << ":\n" << got;
+                ok = false;
+            }
+        }
+        if (!ok)
+            cout << "expected:\n" << want;
+
+        string bad (spec);
+        bad.replace (bad.find ("version=\"2\""), 11, "version=\"1\"");
+        try {
+            decodeStream (bad, false);
+            cout << "wrong version accepted" << endl;
+            ok = false;
+        } catch (const LowlevelError& err) {
+        }
+    } catch (const LowlevelError& err) {
+        cout << "error: " << err.explain << endl;
+        ok = false;
+    } catch (const XmlError& err) {
+        cout << "error: " << err.explain << endl;
+        ok = false;
+    }
+    cout << (ok ? "ok" : "failed") << endl;
+    return ok ? 0 : 1;
+}